@@ -26,6 +26,7 @@ QUANTUM_SRC += \
     $(QUANTUM_DIR)/keymap_common.c \
     $(QUANTUM_DIR)/keycode_config.c \
     $(QUANTUM_DIR)/sync_timer.c \
+    $(QUANTUM_DIR)/timeouts.c \
     $(QUANTUM_DIR)/logging/debug.c \
     $(QUANTUM_DIR)/logging/sendchar.c \
     $(QUANTUM_DIR)/process_keycode/process_default_layer.c \
@@ -191,12 +192,12 @@ ifneq ($(strip $(EEPROM_DRIVER)),none)
       # External I2C EEPROM implementation
       OPT_DEFS += -DEEPROM_DRIVER -DEEPROM_I2C
       I2C_DRIVER_REQUIRED = yes
-      SRC += eeprom_driver.c eeprom_i2c.c
+      SRC += eeprom_driver.c eeprom_i2c.c eeprom_write_queue.c
     else ifeq ($(strip $(EEPROM_DRIVER)), spi)
       # External SPI EEPROM implementation
       OPT_DEFS += -DEEPROM_DRIVER -DEEPROM_SPI
       SPI_DRIVER_REQUIRED = yes
-      SRC += eeprom_driver.c eeprom_spi.c
+      SRC += eeprom_driver.c eeprom_spi.c eeprom_write_queue.c
     else ifeq ($(strip $(EEPROM_DRIVER)), legacy_stm32_flash)
       # STM32 Emulated EEPROM, backed by MCU flash (soon to be deprecated)
       OPT_DEFS += -DEEPROM_DRIVER -DEEPROM_LEGACY_EMULATED_FLASH
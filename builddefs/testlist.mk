@@ -1,9 +1,16 @@
 TEST_LIST = $(sort $(patsubst %/test.mk,%, $(shell find $(ROOT_DIR)tests -type f -name test.mk)))
-FULL_TESTS := $(notdir $(TEST_LIST))
+# Feature benchmarks are built like the feature tests, but are marked with benchmark.mk rather than test.mk
+FULL_BENCHMARK_LIST := $(sort $(patsubst %/benchmark.mk,%, $(shell find $(ROOT_DIR)tests -type f -name benchmark.mk)))
+FULL_TESTS := $(notdir $(TEST_LIST) $(FULL_BENCHMARK_LIST))
+# Benchmarks are only built and run when named explicitly, e.g. `make test:qp_benchmark`
+BENCHMARK_LIST := $(FULL_BENCHMARK_LIST)
 
+include $(DRIVER_PATH)/eeprom/tests/testlist.mk
 include $(QUANTUM_PATH)/debounce/tests/testlist.mk
 include $(QUANTUM_PATH)/encoder/tests/testlist.mk
+include $(QUANTUM_PATH)/nvm/kv/tests/testlist.mk
 include $(QUANTUM_PATH)/os_detection/tests/testlist.mk
+include $(QUANTUM_PATH)/painter/tests/testlist.mk
 include $(QUANTUM_PATH)/sequencer/tests/testlist.mk
 include $(QUANTUM_PATH)/wear_leveling/tests/testlist.mk
 include $(PLATFORM_PATH)/test/testlist.mk
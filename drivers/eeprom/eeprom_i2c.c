@@ -33,19 +33,25 @@
     there is nothing to override during linkage.
 */
 
-#include "wait.h"
+#include "timer.h"
 #include "i2c_master.h"
 #include "eeprom.h"
 #include "eeprom_driver.h"
 #include "eeprom_i2c.h"
+#include "eeprom_write_queue.h"
 
 // #define DEBUG_EEPROM_OUTPUT
 
 #if defined(CONSOLE_ENABLE) && defined(DEBUG_EEPROM_OUTPUT)
-#    include "timer.h"
 #    include "debug.h"
 #endif // DEBUG_EEPROM_OUTPUT
 
+#if EXTERNAL_EEPROM_WRITE_TIME > 0
+static bool     write_in_progress = false;
+static uint8_t  write_device      = 0;
+static uint32_t write_start       = 0;
+#endif
+
 static inline void fill_target_address(uint8_t *buffer, const void *addr) {
     uintptr_t p = (uintptr_t)addr;
     for (int i = 0; i < EXTERNAL_EEPROM_ADDRESS_SIZE; ++i) {
@@ -54,6 +60,72 @@ static inline void fill_target_address(uint8_t *buffer, const void *addr) {
     }
 }
 
+static inline void write_protect(bool protect) {
+#if defined(EXTERNAL_EEPROM_WP_PIN)
+    if (protect) {
+        /* We are setting the WP pin to high in a way that requires at least two bit-flips to change back to 0 */
+        gpio_write_pin(EXTERNAL_EEPROM_WP_PIN, 1);
+        gpio_set_pin_input_high(EXTERNAL_EEPROM_WP_PIN);
+    } else {
+        gpio_set_pin_output(EXTERNAL_EEPROM_WP_PIN);
+        gpio_write_pin(EXTERNAL_EEPROM_WP_PIN, 0);
+    }
+#endif
+}
+
+bool eeprom_device_is_busy(void) {
+#if EXTERNAL_EEPROM_WRITE_TIME > 0
+    if (!write_in_progress) {
+        return false;
+    }
+
+    // ACK polling -- the EEPROM doesn't acknowledge its address until the write cycle has completed
+    uint8_t dummy;
+    if (i2c_receive(write_device, &dummy, 1, EXTERNAL_EEPROM_I2C_POLL_TIMEOUT) != I2C_STATUS_SUCCESS) {
+        if (timer_elapsed32(write_start) < EXTERNAL_EEPROM_WRITE_TIMEOUT) {
+            return true;
+        }
+#    if defined(CONSOLE_ENABLE) && defined(DEBUG_EEPROM_OUTPUT)
+        dprintf("[EEPROM] timed out waiting for write to complete\n");
+#    endif // DEBUG_EEPROM_OUTPUT
+    }
+
+    write_in_progress = false;
+    write_protect(true);
+#endif // EXTERNAL_EEPROM_WRITE_TIME > 0
+    return false;
+}
+
+void eeprom_device_wait_while_busy(void) {
+    while (eeprom_device_is_busy()) {
+    }
+}
+
+void eeprom_device_write_page(uintptr_t addr, const uint8_t *data, size_t len) {
+    uint8_t complete_packet[EXTERNAL_EEPROM_ADDRESS_SIZE + EXTERNAL_EEPROM_PAGE_SIZE];
+    fill_target_address(complete_packet, (const void *)addr);
+    memcpy(&complete_packet[EXTERNAL_EEPROM_ADDRESS_SIZE], data, len);
+
+#if defined(CONSOLE_ENABLE) && defined(DEBUG_EEPROM_OUTPUT)
+    dprintf("[EEPROM W] 0x%04X: ", ((int)addr));
+    for (size_t i = 0; i < len; i++) {
+        dprintf(" %02X", (int)(data[i]));
+    }
+    dprintf("\n");
+#endif // DEBUG_EEPROM_OUTPUT
+
+    write_protect(false);
+    i2c_transmit(EXTERNAL_EEPROM_I2C_ADDRESS(addr), complete_packet, EXTERNAL_EEPROM_ADDRESS_SIZE + len, 100);
+
+#if EXTERNAL_EEPROM_WRITE_TIME > 0
+    write_in_progress = true;
+    write_device      = EXTERNAL_EEPROM_I2C_ADDRESS(addr);
+    write_start       = timer_read32();
+#else
+    write_protect(true);
+#endif
+}
+
 void eeprom_driver_init(void) {
     i2c_init();
 #if defined(EXTERNAL_EEPROM_WP_PIN)
@@ -90,9 +162,15 @@ void eeprom_read_block(void *buf, const void *addr, size_t len) {
     uint8_t complete_packet[EXTERNAL_EEPROM_ADDRESS_SIZE];
     fill_target_address(complete_packet, addr);
 
+    // The EEPROM doesn't respond until any in-flight write cycle has completed
+    eeprom_device_wait_while_busy();
+
     i2c_transmit(EXTERNAL_EEPROM_I2C_ADDRESS((uintptr_t)addr), complete_packet, EXTERNAL_EEPROM_ADDRESS_SIZE, 100);
     i2c_receive(EXTERNAL_EEPROM_I2C_ADDRESS((uintptr_t)addr), buf, len, 100);
 
+    // Writes still waiting in the queue are newer than what the EEPROM holds
+    eeprom_write_queue_overlay(buf, (uintptr_t)addr, len);
+
 #if defined(CONSOLE_ENABLE) && defined(DEBUG_EEPROM_OUTPUT)
     dprintf("[EEPROM R] 0x%04X: ", ((int)addr));
     for (size_t i = 0; i < len; ++i) {
@@ -103,46 +181,20 @@ void eeprom_read_block(void *buf, const void *addr, size_t len) {
 }
 
 void eeprom_write_block(const void *buf, void *addr, size_t len) {
-    uint8_t   complete_packet[EXTERNAL_EEPROM_ADDRESS_SIZE + EXTERNAL_EEPROM_PAGE_SIZE];
-    uint8_t * read_buf    = (uint8_t *)buf;
-    uintptr_t target_addr = (uintptr_t)addr;
-
-#if defined(EXTERNAL_EEPROM_WP_PIN)
-    gpio_set_pin_output(EXTERNAL_EEPROM_WP_PIN);
-    gpio_write_pin(EXTERNAL_EEPROM_WP_PIN, 0);
-#endif
+    const uint8_t *read_buf    = (const uint8_t *)buf;
+    uintptr_t      target_addr = (uintptr_t)addr;
 
     while (len > 0) {
         uintptr_t page_offset  = target_addr % EXTERNAL_EEPROM_PAGE_SIZE;
-        int       write_length = EXTERNAL_EEPROM_PAGE_SIZE - page_offset;
+        size_t    write_length = EXTERNAL_EEPROM_PAGE_SIZE - page_offset;
         if (write_length > len) {
             write_length = len;
         }
 
-        fill_target_address(complete_packet, (const void *)target_addr);
-        for (uint8_t i = 0; i < write_length; i++) {
-            complete_packet[EXTERNAL_EEPROM_ADDRESS_SIZE + i] = read_buf[i];
-        }
-
-#if defined(CONSOLE_ENABLE) && defined(DEBUG_EEPROM_OUTPUT)
-        dprintf("[EEPROM W] 0x%04X: ", ((int)target_addr));
-        for (uint8_t i = 0; i < write_length; i++) {
-            dprintf(" %02X", (int)(read_buf[i]));
-        }
-        dprintf("\n");
-#endif // DEBUG_EEPROM_OUTPUT
-
-        i2c_transmit(EXTERNAL_EEPROM_I2C_ADDRESS((uintptr_t)addr), complete_packet, EXTERNAL_EEPROM_ADDRESS_SIZE + write_length, 100);
-        wait_ms(EXTERNAL_EEPROM_WRITE_TIME);
+        eeprom_write_queue_push(target_addr, read_buf, write_length);
 
         read_buf += write_length;
         target_addr += write_length;
         len -= write_length;
     }
-
-#if defined(EXTERNAL_EEPROM_WP_PIN)
-    /* We are setting the WP pin to high in a way that requires at least two bit-flips to change back to 0 */
-    gpio_write_pin(EXTERNAL_EEPROM_WP_PIN, 1);
-    gpio_set_pin_input_high(EXTERNAL_EEPROM_WP_PIN);
-#endif
 }
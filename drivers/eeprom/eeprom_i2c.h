@@ -123,3 +123,19 @@
 #ifndef EXTERNAL_EEPROM_WRITE_TIME
 #    define EXTERNAL_EEPROM_WRITE_TIME 5
 #endif
+
+/*
+    The maximum time in milliseconds to wait for a write cycle to complete
+    before giving up. Completion is detected by ACK polling, so this is only
+    reached if the EEPROM stops responding.
+*/
+#ifndef EXTERNAL_EEPROM_WRITE_TIMEOUT
+#    define EXTERNAL_EEPROM_WRITE_TIMEOUT ((EXTERNAL_EEPROM_WRITE_TIME) * 2 + 5)
+#endif
+
+/*
+    The I2C timeout in milliseconds for each ACK poll of the EEPROM.
+*/
+#ifndef EXTERNAL_EEPROM_I2C_POLL_TIMEOUT
+#    define EXTERNAL_EEPROM_I2C_POLL_TIMEOUT 1
+#endif
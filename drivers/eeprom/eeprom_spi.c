@@ -37,6 +37,7 @@
 #include "eeprom.h"
 #include "eeprom_driver.h"
 #include "eeprom_spi.h"
+#include "eeprom_write_queue.h"
 
 #define CMD_WREN 6
 #define CMD_WRDI 4
@@ -53,11 +54,17 @@
 #    define EXTERNAL_EEPROM_SPI_TIMEOUT 100
 #endif
 
+static bool write_in_progress = false;
+
 static bool spi_eeprom_start(void) {
     return spi_start(EXTERNAL_EEPROM_SPI_SLAVE_SELECT_PIN, EXTERNAL_EEPROM_SPI_LSBFIRST, EXTERNAL_EEPROM_SPI_MODE, EXTERNAL_EEPROM_SPI_CLOCK_DIVISOR);
 }
 
 static spi_status_t spi_eeprom_wait_while_busy(int timeout) {
+    if (!write_in_progress) {
+        return SPI_STATUS_SUCCESS;
+    }
+
     uint32_t     deadline = timer_read32() + timeout;
     spi_status_t response = SR_WIP;
     while (response & SR_WIP) {
@@ -73,6 +80,7 @@ static spi_status_t spi_eeprom_wait_while_busy(int timeout) {
             return SPI_STATUS_TIMEOUT;
         }
     }
+    write_in_progress = false;
     return SPI_STATUS_SUCCESS;
 }
 
@@ -89,6 +97,77 @@ static void spi_eeprom_transmit_address(uintptr_t addr) {
 
 //----------------------------------------------------------------------------------------------------------------------
 
+bool eeprom_device_is_busy(void) {
+    if (!write_in_progress) {
+        return false;
+    }
+
+    if (!spi_eeprom_start()) {
+        return true;
+    }
+
+    spi_write(CMD_RDSR);
+    spi_status_t response = spi_read();
+    spi_stop();
+
+    if (response < 0 || (response & SR_WIP)) {
+        return true;
+    }
+
+    write_in_progress = false;
+    return false;
+}
+
+void eeprom_device_wait_while_busy(void) {
+    if (spi_eeprom_wait_while_busy(EXTERNAL_EEPROM_SPI_TIMEOUT) != SPI_STATUS_SUCCESS) {
+        spi_stop();
+        dprint("SPI timeout for WIP check\n");
+        // Give up on the previous write rather than blocking forever
+        write_in_progress = false;
+    }
+}
+
+void eeprom_device_write_page(uintptr_t addr, const uint8_t *data, size_t len) {
+    bool res;
+
+    //-------------------------------------------------
+    // Enable writes
+    res = spi_eeprom_start();
+    if (!res) {
+        spi_stop();
+        dprint("failed to start SPI for write-enable\n");
+        return;
+    }
+
+    spi_write(CMD_WREN);
+    spi_stop();
+
+    //-------------------------------------------------
+    // Perform the write
+    res = spi_eeprom_start();
+    if (!res) {
+        spi_stop();
+        dprint("failed to start SPI for write\n");
+        return;
+    }
+
+#if defined(CONSOLE_ENABLE) && defined(DEBUG_EEPROM_OUTPUT)
+    dprintf("[EEPROM W] 0x%08lX: ", ((uint32_t)(uintptr_t)addr));
+    for (size_t i = 0; i < len; i++) {
+        dprintf(" %02X", (int)(uint8_t)(data[i]));
+    }
+    dprintf("\n");
+#endif // DEBUG_EEPROM_OUTPUT
+
+    spi_write(CMD_WRITE);
+    spi_eeprom_transmit_address(addr);
+    spi_transmit(data, len);
+    spi_stop();
+
+    // The write enable latch is reset by the EEPROM once the write cycle completes, completion is polled lazily
+    write_in_progress = true;
+}
+
 void eeprom_driver_init(void) {
     spi_init();
 }
@@ -141,6 +220,9 @@ void eeprom_read_block(void *buf, const void *addr, size_t len) {
     spi_eeprom_transmit_address((uintptr_t)addr);
     spi_receive(buf, len);
 
+    // Writes still waiting in the queue are newer than what the EEPROM holds
+    eeprom_write_queue_overlay(buf, (uintptr_t)addr, len);
+
 #if defined(CONSOLE_ENABLE) && defined(DEBUG_EEPROM_OUTPUT)
     dprintf("[EEPROM R] 0x%08lX: ", ((uint32_t)(uintptr_t)addr));
     for (size_t i = 0; i < len; ++i) {
@@ -153,73 +235,20 @@ void eeprom_read_block(void *buf, const void *addr, size_t len) {
 }
 
 void eeprom_write_block(const void *buf, void *addr, size_t len) {
-    bool      res;
-    uint8_t * read_buf    = (uint8_t *)buf;
-    uintptr_t target_addr = (uintptr_t)addr;
+    const uint8_t *read_buf    = (const uint8_t *)buf;
+    uintptr_t      target_addr = (uintptr_t)addr;
 
     while (len > 0) {
         uintptr_t page_offset  = target_addr % EXTERNAL_EEPROM_PAGE_SIZE;
-        int       write_length = EXTERNAL_EEPROM_PAGE_SIZE - page_offset;
+        size_t    write_length = EXTERNAL_EEPROM_PAGE_SIZE - page_offset;
         if (write_length > len) {
             write_length = len;
         }
 
-        //-------------------------------------------------
-        // Wait for the write-in-progress bit to be cleared
-        spi_status_t response = spi_eeprom_wait_while_busy(EXTERNAL_EEPROM_SPI_TIMEOUT);
-        if (response != SPI_STATUS_SUCCESS) {
-            spi_stop();
-            dprint("SPI timeout for WIP check\n");
-            return;
-        }
-
-        //-------------------------------------------------
-        // Enable writes
-        res = spi_eeprom_start();
-        if (!res) {
-            spi_stop();
-            dprint("failed to start SPI for write-enable\n");
-            return;
-        }
-
-        spi_write(CMD_WREN);
-        spi_stop();
-
-        //-------------------------------------------------
-        // Perform the write
-        res = spi_eeprom_start();
-        if (!res) {
-            spi_stop();
-            dprint("failed to start SPI for write\n");
-            return;
-        }
-
-#if defined(CONSOLE_ENABLE) && defined(DEBUG_EEPROM_OUTPUT)
-        dprintf("[EEPROM W] 0x%08lX: ", ((uint32_t)(uintptr_t)target_addr));
-        for (size_t i = 0; i < write_length; i++) {
-            dprintf(" %02X", (int)(uint8_t)(read_buf[i]));
-        }
-        dprintf("\n");
-#endif // DEBUG_EEPROM_OUTPUT
-
-        spi_write(CMD_WRITE);
-        spi_eeprom_transmit_address(target_addr);
-        spi_transmit(read_buf, write_length);
-        spi_stop();
+        eeprom_write_queue_push(target_addr, read_buf, write_length);
 
         read_buf += write_length;
         target_addr += write_length;
         len -= write_length;
     }
-
-    //-------------------------------------------------
-    // Disable writes
-    res = spi_eeprom_start();
-    if (!res) {
-        dprint("failed to start SPI for write-disable\n");
-        return;
-    }
-
-    spi_write(CMD_WRDI);
-    spi_stop();
 }
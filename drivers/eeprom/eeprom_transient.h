@@ -20,6 +20,10 @@
     The size of the transient EEPROM buffer size.
 */
 #ifndef TRANSIENT_EEPROM_SIZE
-#    include "nvm_eeprom_eeconfig_internal.h"
-#    define TRANSIENT_EEPROM_SIZE (((EECONFIG_SIZE + 3) / 4) * 4) // based off eeconfig's current usage, aligned to 4-byte sizes, to deal with LTO
+#    if defined(NVM_DRIVER_KV)
+#        define TRANSIENT_EEPROM_SIZE 64 // eeconfig lives in the kv store, only keyboard-level code accesses EEPROM directly
+#    else
+#        include "nvm_eeprom_eeconfig_internal.h"
+#        define TRANSIENT_EEPROM_SIZE (((EECONFIG_SIZE + 3) / 4) * 4) // based off eeconfig's current usage, aligned to 4-byte sizes, to deal with LTO
+#    endif
 #endif
@@ -0,0 +1,126 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <stdint.h>
+#include <string.h>
+
+#include "eeprom_driver.h"
+#include "eeprom_write_queue.h"
+#if defined(EEPROM_I2C)
+#    include "eeprom_i2c.h"
+#elif defined(EEPROM_SPI)
+#    include "eeprom_spi.h"
+#endif
+
+#if EXTERNAL_EEPROM_WRITE_QUEUE_SIZE > 0
+
+typedef struct eeprom_queued_page_t {
+    uintptr_t address;
+    uint16_t  length;
+    uint8_t   data[EXTERNAL_EEPROM_PAGE_SIZE];
+} eeprom_queued_page_t;
+
+static eeprom_queued_page_t queue[EXTERNAL_EEPROM_WRITE_QUEUE_SIZE];
+static uint8_t              queue_head  = 0;
+static uint8_t              queue_count = 0;
+
+static inline eeprom_queued_page_t *queue_entry(uint8_t index) {
+    return &queue[(queue_head + index) % EXTERNAL_EEPROM_WRITE_QUEUE_SIZE];
+}
+
+// Writes the oldest queued page, waiting for the EEPROM to become ready first
+static void queue_write_head(void) {
+    eeprom_queued_page_t *entry = queue_entry(0);
+    eeprom_device_wait_while_busy();
+    eeprom_device_write_page(entry->address, entry->data, entry->length);
+    queue_head = (queue_head + 1) % EXTERNAL_EEPROM_WRITE_QUEUE_SIZE;
+    --queue_count;
+}
+
+// Extends the most recently queued page with the supplied data, if it ends up as a single contiguous span
+static bool queue_merge_tail(uintptr_t addr, const uint8_t *data, size_t len) {
+    if (queue_count == 0) {
+        return false;
+    }
+
+    eeprom_queued_page_t *tail = queue_entry(queue_count - 1);
+    if ((tail->address / EXTERNAL_EEPROM_PAGE_SIZE) != (addr / EXTERNAL_EEPROM_PAGE_SIZE)) {
+        return false;
+    }
+    if (addr + len < tail->address || addr > tail->address + tail->length) {
+        return false;
+    }
+
+    uintptr_t start = addr < tail->address ? addr : tail->address;
+    uintptr_t end   = (addr + len) > (tail->address + tail->length) ? (addr + len) : (tail->address + tail->length);
+    memmove(&tail->data[tail->address - start], tail->data, tail->length);
+    memcpy(&tail->data[addr - start], data, len);
+    tail->address = start;
+    tail->length  = end - start;
+    return true;
+}
+
+void eeprom_write_queue_push(uintptr_t addr, const uint8_t *data, size_t len) {
+    if (queue_merge_tail(addr, data, len)) {
+        return;
+    }
+
+    // Nothing ahead of this write, start it straight away if the EEPROM is ready
+    if (queue_count == 0 && !eeprom_device_is_busy()) {
+        eeprom_device_write_page(addr, data, len);
+        return;
+    }
+
+    while (queue_count >= EXTERNAL_EEPROM_WRITE_QUEUE_SIZE) {
+        queue_write_head();
+    }
+
+    eeprom_queued_page_t *entry = queue_entry(queue_count++);
+    entry->address              = addr;
+    entry->length               = len;
+    memcpy(entry->data, data, len);
+}
+
+void eeprom_write_queue_overlay(void *buf, uintptr_t addr, size_t len) {
+    // Later entries take precedence, so apply in queue order
+    for (uint8_t i = 0; i < queue_count; ++i) {
+        eeprom_queued_page_t *entry = queue_entry(i);
+        uintptr_t             start = entry->address > addr ? entry->address : addr;
+        uintptr_t             end   = (entry->address + entry->length) < (addr + len) ? (entry->address + entry->length) : (addr + len);
+        if (start < end) {
+            memcpy(&((uint8_t *)buf)[start - addr], &entry->data[start - entry->address], end - start);
+        }
+    }
+}
+
+void eeprom_driver_task(void) {
+    if (queue_count > 0 && !eeprom_device_is_busy()) {
+        queue_write_head();
+    }
+}
+
+void eeprom_driver_flush(void) {
+    while (queue_count > 0) {
+        queue_write_head();
+    }
+    eeprom_device_wait_while_busy();
+}
+
+#else // EXTERNAL_EEPROM_WRITE_QUEUE_SIZE > 0
+
+void eeprom_write_queue_push(uintptr_t addr, const uint8_t *data, size_t len) {
+    eeprom_device_wait_while_busy();
+    eeprom_device_write_page(addr, data, len);
+}
+
+void eeprom_write_queue_overlay(void *buf, uintptr_t addr, size_t len) {}
+
+void eeprom_driver_task(void) {
+    // Poll the EEPROM so that the next access doesn't have to wait for the write cycle
+    eeprom_device_is_busy();
+}
+
+void eeprom_driver_flush(void) {
+    eeprom_device_wait_while_busy();
+}
+
+#endif // EXTERNAL_EEPROM_WRITE_QUEUE_SIZE > 0
@@ -0,0 +1,61 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/*
+    Page write queue shared by the external I2C and SPI EEPROM drivers.
+
+    Each page write only starts the EEPROM's internal write cycle; completion is
+    polled lazily (I2C ACK polling, SPI RDSR WIP bit) before the next access,
+    rather than waiting for the worst-case write time. Pages which can't be
+    written straight away are queued, and started from housekeeping as the
+    EEPROM becomes ready, so multi-page writes don't stall the main loop.
+*/
+
+/*
+    The number of pages which may be queued for writing. Each queued page uses
+    EXTERNAL_EEPROM_PAGE_SIZE bytes of RAM. Set to 0 to disable queuing, so
+    that multi-page writes wait for each page in turn.
+*/
+#ifndef EXTERNAL_EEPROM_WRITE_QUEUE_SIZE
+#    if defined(__AVR__)
+#        define EXTERNAL_EEPROM_WRITE_QUEUE_SIZE 0
+#    else
+#        define EXTERNAL_EEPROM_WRITE_QUEUE_SIZE 4
+#    endif
+#endif
+
+/**
+ * \brief Write data within a single EEPROM page, queuing it if the EEPROM is still busy.
+ *
+ * Blocks only when the queue is full, until the oldest queued page can be written.
+ */
+void eeprom_write_queue_push(uintptr_t addr, const uint8_t *data, size_t len);
+
+/**
+ * \brief Overlay any queued data onto a buffer that was just read from the EEPROM.
+ */
+void eeprom_write_queue_overlay(void *buf, uintptr_t addr, size_t len);
+
+/*
+    Device access, implemented by the EEPROM driver using the queue.
+*/
+
+/**
+ * \brief Start writing data within a single page, without waiting for the write cycle to complete.
+ */
+void eeprom_device_write_page(uintptr_t addr, const uint8_t *data, size_t len);
+
+/**
+ * \brief Check once, without blocking, whether a previously started write cycle is still in progress.
+ */
+bool eeprom_device_is_busy(void);
+
+/**
+ * \brief Wait until any previously started write cycle has completed, or has timed out.
+ */
+void eeprom_device_wait_while_busy(void);
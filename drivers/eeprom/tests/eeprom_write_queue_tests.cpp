@@ -0,0 +1,273 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <array>
+#include <cstring>
+#include <utility>
+#include <vector>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "timer.h"
+#include "i2c_master.h"
+#include "eeprom.h"
+#include "eeprom_driver.h"
+#include "eeprom_i2c.h"
+#include "eeprom_write_queue.h"
+
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+};
+
+/**
+ * Emulates an I2C EEPROM, which doesn't acknowledge its address while a page write cycle is in progress.
+ */
+class MockI2cEeprom {
+   public:
+    using page_write_t = std::pair<std::uint32_t, std::uint32_t>;
+
+    static MockI2cEeprom& Instance() {
+        static MockI2cEeprom instance;
+        return instance;
+    }
+
+    void reset_instance() {
+        memory.fill(0xFF);
+        page_writes.clear();
+        busy_until    = 0;
+        stuck         = false;
+        read_address  = 0;
+        receive_count = 0;
+    }
+
+    bool is_busy() const {
+        return stuck || timer_read32() < busy_until;
+    }
+
+    std::array<std::uint8_t, EXTERNAL_EEPROM_BYTE_COUNT> memory;
+    std::vector<page_write_t>                            page_writes;
+    std::uint32_t                                        busy_until;
+    bool                                                 stuck;
+    std::uint32_t                                        read_address;
+    std::uint32_t                                        receive_count;
+};
+
+extern "C" {
+void i2c_init(void) {}
+
+i2c_status_t i2c_transmit(uint8_t address, const uint8_t* data, uint16_t length, uint16_t timeout) {
+    auto& inst = MockI2cEeprom::Instance();
+    if (inst.is_busy()) {
+        ADD_FAILURE() << "EEPROM accessed during a write cycle";
+        return I2C_STATUS_ERROR;
+    }
+
+    std::uint32_t target = 0;
+    for (int i = 0; i < EXTERNAL_EEPROM_ADDRESS_SIZE; ++i) {
+        target = (target << 8) | data[i];
+    }
+    inst.read_address = target;
+
+    std::uint32_t count = length - EXTERNAL_EEPROM_ADDRESS_SIZE;
+    if (count > 0) {
+        if ((target / EXTERNAL_EEPROM_PAGE_SIZE) != ((target + count - 1) / EXTERNAL_EEPROM_PAGE_SIZE)) {
+            ADD_FAILURE() << "Page write of " << count << " bytes at " << target << " crosses a page boundary";
+            return I2C_STATUS_ERROR;
+        }
+        memcpy(&inst.memory[target], &data[EXTERNAL_EEPROM_ADDRESS_SIZE], count);
+        inst.page_writes.emplace_back(target, count);
+        inst.busy_until = timer_read32() + EXTERNAL_EEPROM_WRITE_TIME;
+    }
+    return I2C_STATUS_SUCCESS;
+}
+
+i2c_status_t i2c_receive(uint8_t address, uint8_t* data, uint16_t length, uint16_t timeout) {
+    auto& inst = MockI2cEeprom::Instance();
+    ++inst.receive_count;
+    if (inst.is_busy()) {
+        // No acknowledgement, so the transfer takes the whole timeout
+        advance_time(timeout);
+        return I2C_STATUS_TIMEOUT;
+    }
+
+    memcpy(data, &inst.memory[inst.read_address], length);
+    inst.read_address += length;
+    return I2C_STATUS_SUCCESS;
+}
+};
+
+class EepromWriteQueue : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        // Complete anything left over from the previous test, before starting afresh
+        auto& inst = MockI2cEeprom::Instance();
+        inst.stuck = false;
+        eeprom_driver_flush();
+        set_time(0);
+        inst.reset_instance();
+    }
+
+    static std::vector<std::uint8_t> read(std::uint32_t address, std::uint32_t length) {
+        std::vector<std::uint8_t> data(length);
+        eeprom_read_block(data.data(), (const void*)(uintptr_t)address, length);
+        return data;
+    }
+
+    static void write(std::uint32_t address, std::vector<std::uint8_t> data) {
+        eeprom_write_block(data.data(), (void*)(uintptr_t)address, data.size());
+    }
+
+    static std::vector<std::uint8_t> stored(std::uint32_t address, std::uint32_t length) {
+        auto& memory = MockI2cEeprom::Instance().memory;
+        return std::vector<std::uint8_t>(memory.begin() + address, memory.begin() + address + length);
+    }
+};
+
+using page_writes_t = std::vector<MockI2cEeprom::page_write_t>;
+
+/**
+ * This test verifies that a write spanning a page boundary is split into a page write for each page.
+ */
+TEST_F(EepromWriteQueue, WriteAcrossPageBoundary_SplitsPages) {
+    auto&                     inst = MockI2cEeprom::Instance();
+    std::vector<std::uint8_t> data(20);
+    for (std::uint8_t i = 0; i < data.size(); ++i) {
+        data[i] = i + 1;
+    }
+
+    write(10, data);
+    EXPECT_EQ(inst.page_writes, (page_writes_t{{10, 6}})) << "Only the first page should have been written straight away";
+
+    eeprom_driver_flush();
+    EXPECT_EQ(inst.page_writes, (page_writes_t{{10, 6}, {16, 14}})) << "Second page was not written separately";
+    EXPECT_EQ(stored(10, 20), data) << "EEPROM contents did not match";
+}
+
+/**
+ * This test verifies that overlapping and adjacent writes within a page are merged into a single queued page write,
+ * with later data taking precedence.
+ */
+TEST_F(EepromWriteQueue, OverlappingWrites_Merge) {
+    auto& inst = MockI2cEeprom::Instance();
+
+    write(0, {0x01, 0x02, 0x03, 0x04});
+    write(20, {0x11, 0x12, 0x13, 0x14});
+    write(22, {0x21, 0x22, 0x23, 0x24, 0x25, 0x26});
+    write(18, {0x31, 0x32, 0x33});
+    EXPECT_EQ(inst.page_writes.size(), 1) << "Writes should have been queued behind the first";
+
+    eeprom_driver_flush();
+    EXPECT_EQ(inst.page_writes, (page_writes_t{{0, 4}, {18, 10}})) << "Queued writes were not merged";
+    EXPECT_EQ(stored(18, 10), (std::vector<std::uint8_t>{0x31, 0x32, 0x33, 0x12, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26})) << "EEPROM contents did not match";
+}
+
+/**
+ * This test verifies that writes to a different page, or which leave a gap, aren't merged.
+ */
+TEST_F(EepromWriteQueue, DisjointWrites_NotMerged) {
+    auto& inst = MockI2cEeprom::Instance();
+
+    write(0, {0x01});
+    write(16, {0x02});
+    write(18, {0x03});
+    write(32, {0x04});
+
+    eeprom_driver_flush();
+    EXPECT_EQ(inst.page_writes, (page_writes_t{{0, 1}, {16, 1}, {18, 1}, {32, 1}})) << "Disjoint writes should not have been merged";
+    EXPECT_EQ(inst.memory[17], 0xFF) << "Gap between writes should have been left untouched";
+}
+
+/**
+ * This test verifies that reads return queued data which hasn't been written to the EEPROM yet.
+ */
+TEST_F(EepromWriteQueue, Read_OverlaysQueuedBytes) {
+    auto& inst = MockI2cEeprom::Instance();
+
+    write(0, {0x01, 0x02});
+    write(36, {0x11, 0x12, 0x13});
+    write(38, {0x21, 0x22, 0x23});
+    EXPECT_EQ(read(34, 8), (std::vector<std::uint8_t>{0xFF, 0xFF, 0x11, 0x12, 0x21, 0x22, 0x23, 0xFF})) << "Read did not include queued bytes";
+    EXPECT_EQ(stored(36, 5), (std::vector<std::uint8_t>(5, 0xFF))) << "Queued bytes should not have been written yet";
+    EXPECT_EQ(inst.page_writes.size(), 1) << "Read should not have written queued pages";
+
+    eeprom_driver_flush();
+    EXPECT_EQ(read(34, 8), (std::vector<std::uint8_t>{0xFF, 0xFF, 0x11, 0x12, 0x21, 0x22, 0x23, 0xFF})) << "Readback did not match after flush";
+}
+
+/**
+ * This test verifies that housekeeping starts queued page writes without blocking, once the EEPROM is ready.
+ */
+TEST_F(EepromWriteQueue, Task_StartsQueuedWritesWhenReady) {
+    auto& inst = MockI2cEeprom::Instance();
+
+    write(0, std::vector<std::uint8_t>(48, 0x5A));
+    EXPECT_EQ(inst.page_writes.size(), 1) << "Only the first page should have been written straight away";
+
+    eeprom_driver_task();
+    EXPECT_EQ(inst.page_writes.size(), 1) << "Task should not have written while the EEPROM is busy";
+    EXPECT_LT(timer_read32(), EXTERNAL_EEPROM_WRITE_TIME) << "Task should not have waited for the EEPROM";
+
+    advance_time(EXTERNAL_EEPROM_WRITE_TIME);
+    eeprom_driver_task();
+    EXPECT_EQ(inst.page_writes, (page_writes_t{{0, 16}, {16, 16}})) << "Task did not start the next queued page";
+
+    advance_time(EXTERNAL_EEPROM_WRITE_TIME);
+    eeprom_driver_task();
+    EXPECT_EQ(inst.page_writes, (page_writes_t{{0, 16}, {16, 16}, {32, 16}})) << "Task did not start the last queued page";
+    EXPECT_EQ(stored(0, 48), (std::vector<std::uint8_t>(48, 0x5A))) << "EEPROM contents did not match";
+}
+
+/**
+ * This test verifies that writing more pages than the queue holds waits for the oldest queued page to be written.
+ */
+TEST_F(EepromWriteQueue, FullQueue_WritesOldestPage) {
+    auto& inst = MockI2cEeprom::Instance();
+
+    write(0, std::vector<std::uint8_t>(16 * (EXTERNAL_EEPROM_WRITE_QUEUE_SIZE + 2), 0xA5));
+    EXPECT_EQ(inst.page_writes.size(), 2) << "Only the pages which didn't fit in the queue should have been written";
+
+    eeprom_driver_flush();
+    EXPECT_EQ(inst.page_writes.size(), EXTERNAL_EEPROM_WRITE_QUEUE_SIZE + 2) << "Flush did not write all queued pages";
+}
+
+/**
+ * This test verifies that flushing, as done on shutdown and suspend, writes all queued pages and waits for the last
+ * write cycle to complete.
+ */
+TEST_F(EepromWriteQueue, Flush_DrainsQueue) {
+    auto& inst = MockI2cEeprom::Instance();
+
+    write(0, {0x01});
+    write(16, {0x02});
+    write(32, {0x03});
+
+    eeprom_driver_flush();
+    EXPECT_EQ(inst.page_writes, (page_writes_t{{0, 1}, {16, 1}, {32, 1}})) << "Flush did not write all queued pages";
+    EXPECT_FALSE(inst.is_busy()) << "Flush returned before the last write cycle completed";
+
+    auto receives = inst.receive_count;
+    eeprom_driver_flush();
+    EXPECT_EQ(inst.receive_count, receives) << "Flush with nothing queued should not have polled the EEPROM";
+}
+
+/**
+ * This test verifies that an EEPROM which never acknowledges after a write is given up on after the write timeout,
+ * rather than stalling forever.
+ */
+TEST_F(EepromWriteQueue, AckPollTimeout_GivesUp) {
+    auto& inst = MockI2cEeprom::Instance();
+
+    write(0, {0x01});
+    inst.stuck = true;
+
+    std::uint32_t start = timer_read32();
+    eeprom_driver_flush();
+    std::uint32_t elapsed = timer_read32() - start;
+    EXPECT_GE(elapsed, EXTERNAL_EEPROM_WRITE_TIMEOUT) << "Gave up waiting before the write timeout";
+    EXPECT_LE(elapsed, EXTERNAL_EEPROM_WRITE_TIMEOUT + EXTERNAL_EEPROM_I2C_POLL_TIMEOUT) << "Kept polling after the write timeout";
+
+    // Subsequent accesses carry on once the EEPROM recovers
+    inst.stuck = false;
+    write(16, {0x02});
+    EXPECT_EQ(inst.page_writes, (page_writes_t{{0, 1}, {16, 1}})) << "Write after the timeout was not started";
+    EXPECT_EQ(read(16, 1), (std::vector<std::uint8_t>{0x02})) << "Readback did not match after the timeout";
+}
@@ -0,0 +1,16 @@
+eeprom_i2c_write_queue_DEFS := \
+	-DEEPROM_I2C \
+	-DEXTERNAL_EEPROM_BYTE_COUNT=256 \
+	-DEXTERNAL_EEPROM_PAGE_SIZE=16 \
+	-DEXTERNAL_EEPROM_ADDRESS_SIZE=1 \
+	-DEXTERNAL_EEPROM_WRITE_TIME=5 \
+	-DEXTERNAL_EEPROM_WRITE_QUEUE_SIZE=2
+eeprom_i2c_write_queue_SRC := \
+	$(DRIVER_PATH)/eeprom/eeprom_i2c.c \
+	$(DRIVER_PATH)/eeprom/eeprom_write_queue.c \
+	$(DRIVER_PATH)/eeprom/tests/eeprom_write_queue_tests.cpp \
+	$(PLATFORM_PATH)/timer.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c
+eeprom_i2c_write_queue_INC := \
+	$(DRIVER_PATH) \
+	$(DRIVER_PATH)/eeprom
@@ -0,0 +1,2 @@
+TEST_LIST += \
+	eeprom_i2c_write_queue
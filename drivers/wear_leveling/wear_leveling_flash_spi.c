@@ -42,6 +42,30 @@ bool backing_store_erase(void) {
     return ret;
 }
 
+#ifdef BACKING_STORE_ERASE_RANGE
+bool backing_store_erase_range(uint32_t address, uint32_t length) {
+#    ifdef WEAR_LEVELING_DEBUG_OUTPUT
+    uint32_t start = timer_read32();
+#    endif
+
+    // Banks are erased sector-by-sector, so that each one can be erased without touching the other.
+    STATIC_ASSERT((WEAR_LEVELING_BANK_SIZE) % (EXTERNAL_FLASH_SECTOR_SIZE) == 0, "Bank size must be a multiple of EXTERNAL_FLASH_SECTOR_SIZE");
+
+    bool     ret    = true;
+    uint32_t offset = (WEAR_LEVELING_EXTERNAL_FLASH_BLOCK_OFFSET) * (EXTERNAL_FLASH_BLOCK_SIZE) + address;
+    for (uint32_t i = 0; i < length; i += (EXTERNAL_FLASH_SECTOR_SIZE)) {
+        flash_status_t status = flash_erase_sector(offset + i);
+        if (status != FLASH_STATUS_SUCCESS) {
+            ret = false;
+            break;
+        }
+    }
+
+    bs_dprintf("Backing store range erase took %ldms to complete\n", ((long)(timer_read32() - start)));
+    return ret;
+}
+#endif // BACKING_STORE_ERASE_RANGE
+
 bool backing_store_write(uint32_t address, backing_store_int_t value) {
     return backing_store_write_bulk(address, &value, 1);
 }
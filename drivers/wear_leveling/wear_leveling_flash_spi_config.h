@@ -30,5 +30,14 @@
 
 // Use half of the backing size for logical EEPROM
 #ifndef WEAR_LEVELING_LOGICAL_SIZE
-#    define WEAR_LEVELING_LOGICAL_SIZE ((WEAR_LEVELING_BACKING_SIZE) / 2)
+#    ifdef WEAR_LEVELING_DOUBLE_BANK
+#        define WEAR_LEVELING_LOGICAL_SIZE ((WEAR_LEVELING_BACKING_SIZE) / 4)
+#    else
+#        define WEAR_LEVELING_LOGICAL_SIZE ((WEAR_LEVELING_BACKING_SIZE) / 2)
+#    endif
 #endif // WEAR_LEVELING_LOGICAL_SIZE
+
+// Double-bank consolidation erases one flash sector per step
+#ifndef WEAR_LEVELING_ERASE_SECTOR_SIZE
+#    define WEAR_LEVELING_ERASE_SECTOR_SIZE (EXTERNAL_FLASH_SECTOR_SIZE)
+#endif // WEAR_LEVELING_ERASE_SECTOR_SIZE
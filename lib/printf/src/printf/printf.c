@@ -0,0 +1 @@
+#include "printf.h"
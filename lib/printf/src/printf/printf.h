@@ -0,0 +1,9 @@
+#pragma once
+#include <stdio.h>
+#ifdef __cplusplus
+extern "C" {
+#endif
+void putchar_(char c);
+#ifdef __cplusplus
+}
+#endif
@@ -13,7 +13,7 @@
 # limitations under the License.
 """Python program to make autocorrect_data.h.
 This program reads from a prepared dictionary file and generates a C source file
-"autocorrect_data.h" with a serialized trie embedded as an array. Run this
+"autocorrect_data.h" with a serialized DAWG embedded as an array. Run this
 program and pass it as the first argument like:
 $ qmk generate-autocorrect-data autocorrect_dict.txt
 Each line of the dict file defines one typo and its correction with the syntax
@@ -165,80 +165,139 @@ def check_typo_against_dictionary(typo: str, line_number: int, correct_words) ->
                 cli.log.warning('{fg_yellow}Warning:%d:{fg_reset} Typo "{fg_cyan}%s{fg_reset}" would falsely trigger on correctly spelled word "{fg_cyan}%s{fg_reset}".', line_number, typo, word)
 
 
+def make_leaf_data(typo: str, correction: str) -> List[int]:
+    """Encodes the backspace count and correction text of a leaf node."""
+    word_boundary_ending = typo[-1] == ':'
+    typo = typo.strip(':')
+    i = 0  # Skip the prefix that the typo and correction have in common.
+    while i < min(len(typo), len(correction)) and typo[i] == correction[i]:
+        i += 1
+    backspaces = len(typo) - i - 1 + word_boundary_ending
+    assert 0 <= backspaces <= 63
+    return [backspaces + 128] + list(bytes(correction[i:], 'ascii')) + [0]
+
+
+def minimize_trie(trie: Dict[str, Any]) -> Tuple[int, Dict[int, Any]]:
+    """Merges equivalent subtrees of the trie, turning it into a DAWG.
+  Two nodes are equivalent when they are leaves with the same serialized
+  correction, or when they have the same keycodes leading to equivalent
+  children. Since the trie is stored reversed, this shares common word
+  prefixes, e.g. every typo of "return" ending in the same correction tail.
+  Args:
+    trie: Dict of dicts, as returned by make_trie().
+  Returns:
+    Tuple of the root node id and a dict mapping node id to either leaf data
+    (a tuple of bytes) or a sorted tuple of (char, child id) edges.
+  """
+    nodes = {}
+    registry = {}
+
+    def visit(trie_node) -> int:
+        if 'LEAF' in trie_node:
+            signature = ('leaf', tuple(make_leaf_data(*trie_node['LEAF'])))
+        else:
+            edges = tuple(sorted(((c, visit(child)) for c, child in trie_node.items()), key=lambda e: TYPO_CHARS[e[0]]))
+            signature = ('edges', edges)
+        if signature not in registry:
+            registry[signature] = len(nodes)
+            nodes[registry[signature]] = signature[1] if signature[0] == 'edges' else bytes(signature[1])
+        return registry[signature]
+
+    return visit(trie), nodes
+
+
 def serialize_trie(autocorrections: List[Tuple[str, str]], trie: Dict[str, Any]) -> List[int]:
     """Serializes trie and correction data in a form readable by the C code.
+  The trie is first minimized into a DAWG, then written out depth first as
+  leaf, chain and branch entries linked by 24-bit byte offsets. See the
+  appendix of docs/features/autocorrect.md for the format.
   Args:
     autocorrections: List of (typo, correction) tuples.
     trie: Dict of dicts.
   Returns:
     List of ints in the range 0-255.
   """
-    table = []
+    root, nodes = minimize_trie(trie)
+
+    # Chains may only swallow nodes that nothing else links to.
+    in_degree = {node_id: 0 for node_id in nodes}
+    for node in nodes.values():
+        if isinstance(node, tuple):
+            for _, child in node:
+                in_degree[child] += 1
 
-    # Traverse trie in depth first order.
-    def traverse(trie_node):
-        if 'LEAF' in trie_node:  # Handle a leaf trie node.
-            typo, correction = trie_node['LEAF']
-            word_boundary_ending = typo[-1] == ':'
-            typo = typo.strip(':')
-            i = 0  # Make the autocorrection data for this entry and serialize it.
-            while i < min(len(typo), len(correction)) and typo[i] == correction[i]:
-                i += 1
-            backspaces = len(typo) - i - 1 + word_boundary_ending
-            assert 0 <= backspaces <= 63
-            correction = correction[i:]
-            bs_count = [backspaces + 128]
-            data = bs_count + list(bytes(correction, 'ascii')) + [0]
-
-            entry = {'data': data, 'links': [], 'byte_offset': 0}
+    def is_chain_link(node_id: int) -> bool:
+        node = nodes[node_id]
+        return isinstance(node, tuple) and len(node) == 1 and in_degree[node_id] == 1
+
+    table = []
+    entries = {}
+
+    # Traverse the DAWG in depth first order, emitting each node once.
+    def traverse(node_id: int) -> None:
+        if node_id in entries:
+            return
+        node = nodes[node_id]
+        if isinstance(node, bytes):  # Handle a leaf node.
+            entry = {'data': list(node), 'links': []}
+            entries[node_id] = entry
             table.append(entry)
-        elif len(trie_node) == 1:  # Handle trie node with a single child.
-            c, trie_node = next(iter(trie_node.items()))
-            entry = {'chars': c, 'byte_offset': 0}
-
-            # It's common for a trie to have long chains of single-child nodes. We
-            # find the whole chain so that we can serialize it more efficiently.
-            while len(trie_node) == 1 and 'LEAF' not in trie_node:
-                c, trie_node = next(iter(trie_node.items()))
+        elif len(node) == 1:  # Handle a node with a single child.
+            c, child = node[0]
+            entry = {'chars': c, 'links': [], 'inline': False}
+            entries[node_id] = entry
+
+            # Follow the run of single-child nodes so that it can be serialized
+            # as a single chain entry.
+            while len(entry['chars']) < 31 and is_chain_link(child):
+                c, child = nodes[child][0]
                 entry['chars'] += c
 
             table.append(entry)
-            entry['links'] = [traverse(trie_node)]
-        else:  # Handle trie node with multiple children.
-            entry = {'chars': ''.join(sorted(trie_node.keys())), 'byte_offset': 0}
+            entry['links'] = [child]
+            if child not in entries:
+                # The child is emitted right after the chain, so the link can be
+                # left implicit.
+                entry['inline'] = True
+                traverse(child)
+        else:  # Handle a node with multiple children.
+            assert len(node) <= 31
+            entry = {'chars': ''.join(c for c, _ in node), 'links': [child for _, child in node]}
+            entries[node_id] = entry
             table.append(entry)
-            entry['links'] = [traverse(trie_node[c]) for c in entry['chars']]
-        return entry
+            # As with chains, the first child may follow the branch without a link.
+            entry['inline'] = entry['links'][0] not in entries
+            for child in entry['links']:
+                traverse(child)
 
-    traverse(trie)
+    traverse(root)
 
     def serialize(e: Dict[str, Any]) -> List[int]:
         if not e['links']:  # Handle a leaf table entry.
             return e['data']
         elif len(e['links']) == 1:  # Handle a chain table entry.
-            return [TYPO_CHARS[c] for c in e['chars']] + [0]  # + encode_link(e['links'][0]))
+            data = [len(e['chars']) | (32 if e['inline'] else 0)] + [TYPO_CHARS[c] for c in e['chars']]
         else:  # Handle a branch table entry.
-            data = []
-            for c, link in zip(e['chars'], e['links']):
-                data += [TYPO_CHARS[c] | (0 if data else 64)] + encode_link(link)
-            return data + [0]
+            data = [len(e['chars']) | (32 if e['inline'] else 0) | 64] + [TYPO_CHARS[c] for c in e['chars']]
+        for link in e['links'][1 if e['inline'] else 0:]:
+            data += encode_link(entries[link])
+        return data
 
     byte_offset = 0
     for e in table:  # To encode links, first compute byte offset of each entry.
         e['byte_offset'] = byte_offset
         byte_offset += len(serialize(e))
-        assert 0 <= byte_offset <= 0xffff
 
     return [b for e in table for b in serialize(e)]  # Serialize final table.
 
 
 def encode_link(link: Dict[str, Any]) -> List[int]:
-    """Encodes a node link as two bytes."""
-    byte_offset = link['byte_offset']
-    if not (0 <= byte_offset <= 0xffff):
-        cli.log.error('{fg_red}Error:{fg_reset} The autocorrection table is too large, a node link exceeds 64KB limit. Try reducing the autocorrection dict to fewer entries.')
+    """Encodes a node link as three bytes."""
+    byte_offset = link.get('byte_offset', 0)
+    if not (0 <= byte_offset <= 0xffffff):
+        cli.log.error('{fg_red}Error:{fg_reset} The autocorrection table is too large, a node link exceeds 16MB limit. Try reducing the autocorrection dict to fewer entries.')
         maybe_exit(1)
-    return [byte_offset & 255, byte_offset >> 8]
+    return [byte_offset & 255, (byte_offset >> 8) & 255, byte_offset >> 16]
 
 
 def typo_len(e: Tuple[str, str]) -> int:
@@ -281,6 +340,7 @@ def generate_autocorrect_data(cli):
     autocorrect_data_h_lines.append('')
     autocorrect_data_h_lines.append(f'#define AUTOCORRECT_MIN_LENGTH {len(min_typo)} // "{min_typo}"')
     autocorrect_data_h_lines.append(f'#define AUTOCORRECT_MAX_LENGTH {len(max_typo)} // "{max_typo}"')
+    autocorrect_data_h_lines.append('#define AUTOCORRECT_DATA_VERSION 2')
     autocorrect_data_h_lines.append(f'#define DICTIONARY_SIZE {len(data)}')
     autocorrect_data_h_lines.append('')
     autocorrect_data_h_lines.append('static const uint8_t autocorrect_data[DICTIONARY_SIZE] PROGMEM = {')
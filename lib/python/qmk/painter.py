@@ -128,8 +128,14 @@ def _render_image_metadata(metadata):
             delta_px = (r - l) * (b - t)
             px = size["width"] * size["height"]
 
+            # Frames split into dirty rectangles only send the pixels within them
+            rects = ""
+            if "delta_rects" in v:
+                delta_px = sum((r - l + 1) * (b - t + 1) for l, t, r, b in v["delta_rects"])
+                rects = f" in {len(v['delta_rects'])} rects"
+
             # FIXME: May need need more chars here too
-            deltas.append(f"// Frame {i:3d}: ({l:3d}, {t:3d}) - ({r:3d}, {b:3d}) >> {delta_px:4d}/{px:4d} pixels ({100*delta_px/px:.2f}%)")
+            deltas.append(f"// Frame {i:3d}: ({l:3d}, {t:3d}) - ({r:3d}, {b:3d}) >> {delta_px:4d}/{px:4d} pixels ({100*delta_px/px:.2f}%){rects}")
 
         if deltas:
             lines.append("// Areas on delta frames")
@@ -6,6 +6,7 @@
 # See https://docs.qmk.fm/#/quantum_painter_qgf for more information.
 
 import functools
+import math
 from colorsys import rgb_to_hsv
 from types import FunctionType
 from PIL import Image, ImageFile, ImageChops
@@ -147,6 +148,17 @@ class QGFFrameDescriptorV1:
         else:
             self.flags &= ~0x02
 
+    @property
+    def has_delta_rects(self):
+        return (self.flags & 0x04) == 0x04
+
+    @has_delta_rects.setter
+    def has_delta_rects(self, val):
+        if val:
+            self.flags |= 0x04
+        else:
+            self.flags &= ~0x04
+
 
 ########################################################################################################################
 
@@ -208,6 +220,30 @@ class QGFFrameDeltaDescriptorV1:
 ########################################################################################################################
 
 
+class QGFFrameDeltaRectsDescriptorV1:
+    type_id = 0x06
+    rect_length = 8
+
+    def __init__(self):
+        self.header = QGFBlockHeader()
+        self.header.type_id = QGFFrameDeltaRectsDescriptorV1.type_id
+        self.rects = []
+
+    def write(self, fp):
+        self.header.length = len(self.rects) * QGFFrameDeltaRectsDescriptorV1.rect_length
+        self.header.write(fp)
+        for left, top, right, bottom in self.rects:
+            fp.write(b''  # start off with empty bytes...
+                     + o16(left)  # left
+                     + o16(top)  # top
+                     + o16(right)  # right
+                     + o16(bottom)  # bottom
+                     )
+
+
+########################################################################################################################
+
+
 class QGFFrameDataDescriptorV1:
     type_id = 0x05
 
@@ -260,10 +296,61 @@ def _for_all_frames(x: FunctionType, /, images):
             frame_num += 1
 
 
+def _find_dirty_rects(diff, bbox, *, merge_gap):
+    """Splits the bounding box of a frame difference into tight dirty rectangles.
+
+    Each row is reduced to spans of changed pixels, skipping runs of unchanged pixels longer than `merge_gap`. Identical
+    spans on consecutive rows are merged into a single rectangle. Returned rectangles use inclusive coordinates.
+    """
+    width = diff.width
+    data = diff.tobytes()
+    changed = [data[i] | data[i + 1] | data[i + 2] for i in range(0, len(data), 3)]
+
+    left, top, right, bottom = bbox
+    rects = []
+    open_rects = {}
+    for y in range(top, bottom):
+        row = changed[y * width:(y + 1) * width]
+
+        # Find the spans of changed pixels on this row
+        spans = []
+        x = left
+        while x < right:
+            if not row[x]:
+                x += 1
+                continue
+            start = end = x
+            while x < right and x - end <= merge_gap:
+                if row[x]:
+                    end = x
+                x += 1
+            spans.append((start, end))
+
+        # Extend rectangles that had the same span on the previous row, otherwise start new ones
+        next_open_rects = {}
+        for span in spans:
+            rect = open_rects.get(span)
+            if rect is None:
+                rect = [span[0], y, span[1], y]
+                rects.append(rect)
+            rect[3] = y
+            next_open_rects[span] = rect
+        open_rects = next_open_rects
+
+    return rects
+
+
+def _compress_data(data, use_rle):
+    rle_data = qmk.painter.compress_bytes_qmk_rle(data) if use_rle else None
+    use_raw = not use_rle or len(data) <= len(rle_data)
+    return (data if use_raw else rle_data), use_raw
+
+
 def _compress_image(frame, last_frame, *, use_rle, use_deltas, format_, **_kwargs):
     # Convert the original frame so we can do comparisons
     converted = qmk.painter.convert_requested_format(frame, format_)
     graphic_data = qmk.painter.convert_image_bytes(converted, format_)
+    graphic_data_full = graphic_data
 
     # Convert the raw data to RLE-encoded if requested
     raw_data = graphic_data[1]
@@ -274,6 +361,7 @@ def _compress_image(frame, last_frame, *, use_rle, use_deltas, format_, **_kwarg
 
     # Work out if a delta frame is smaller than injecting it directly
     use_delta_this_frame = False
+    delta_rects = None
     bbox = None
     if use_deltas and last_frame is not None:
         # If we want to use deltas, then find the difference
@@ -310,6 +398,28 @@ def _compress_image(frame, last_frame, *, use_rle, use_deltas, format_, **_kwarg
                 image_data = delta_image_data
                 use_delta_this_frame = True
 
+        # If the changes are scattered, try only encoding the dirty rectangles within the bounding box. Each rectangle
+        # costs a descriptor entry plus byte alignment, so only skip runs of unchanged pixels that outweigh that.
+        if bbox:
+            bits_per_pixel = max(1, int(math.log2(format_['num_colors'])))
+            merge_gap = max(1, (QGFFrameDeltaRectsDescriptorV1.rect_length * 8) // bits_per_pixel)
+            rects = _find_dirty_rects(diff, bbox, merge_gap=merge_gap)
+            if len(rects) > 1:
+                # Crop from the full-frame conversion so that all rects share the same palette
+                rects_data = []
+                for l, t, r, b in rects:
+                    rects_data.extend(qmk.painter.convert_image_bytes(converted.crop((l, t, r + 1, b + 1)), format_)[1])
+                rects_image_data, rects_use_raw = _compress_data(rects_data, use_rle)
+
+                rects_size = len(rects_image_data) + QGFFrameDeltaDescriptorV1.length + QGFBlockHeader.block_size + len(rects) * QGFFrameDeltaRectsDescriptorV1.rect_length
+                best_size = len(image_data) + (QGFFrameDeltaDescriptorV1.length if use_delta_this_frame else 0)
+                if rects_size < best_size:
+                    graphic_data = (graphic_data_full[0], rects_data)
+                    use_raw_this_frame = rects_use_raw
+                    image_data = rects_image_data
+                    use_delta_this_frame = True
+                    delta_rects = rects
+
         # Default to whole image
         bbox = bbox or [0, 0, *frame.size]
         # Fix sze (as per #20296), we need to cast first as tuples are inmutable
@@ -319,6 +429,7 @@ def _compress_image(frame, last_frame, *, use_rle, use_deltas, format_, **_kwarg
 
     return {
         "bbox": bbox,
+        "delta_rects": delta_rects,
         "graphic_data": graphic_data,
         "image_data": image_data,
         "use_delta_this_frame": use_delta_this_frame,
@@ -335,6 +446,7 @@ def _write_frame(idx, frame, last_frame, *, fp, frame_offsets, metadata, **kwarg
     # (potentially) Apply RLE and/or delta, and work out output image's information
     outputs = _compress_image(frame, last_frame, **kwargs)
     bbox = outputs["bbox"]
+    delta_rects = outputs["delta_rects"]
     graphic_data = outputs["graphic_data"]
     image_data = outputs["image_data"]
     use_delta_this_frame = outputs["use_delta_this_frame"]
@@ -345,6 +457,7 @@ def _write_frame(idx, frame, last_frame, *, fp, frame_offsets, metadata, **kwarg
     vprint(f'{f"Frame {idx:3d} base":26s} {fp.tell():5d}d / {fp.tell():04X}h')
     frame_descriptor = QGFFrameDescriptorV1()
     frame_descriptor.is_delta = use_delta_this_frame
+    frame_descriptor.has_delta_rects = delta_rects is not None
     frame_descriptor.is_transparent = False
     frame_descriptor.format = format_['image_format_byte']
     frame_descriptor.compression = 0x00 if use_raw_this_frame else 0x01  # See qp.h, painter_compression_t
@@ -371,6 +484,14 @@ def _write_frame(idx, frame, last_frame, *, fp, frame_offsets, metadata, **kwarg
         vprint(f'{f"Frame {idx:3d} delta":26s} {fp.tell():5d}d / {fp.tell():04X}h')
         delta_descriptor.write(fp)
 
+    # Write out the dirty rectangles if required
+    if delta_rects:
+        delta_rects_descriptor = QGFFrameDeltaRectsDescriptorV1()
+        delta_rects_descriptor.rects = delta_rects
+
+        vprint(f'{f"Frame {idx:3d} delta rects":26s} {fp.tell():5d}d / {fp.tell():04X}h')
+        delta_rects_descriptor.write(fp)
+
     # Store metadata, showed later in a comment in the generated file
     frame_metadata = {
         "compression": frame_descriptor.compression,
@@ -384,6 +505,8 @@ def _write_frame(idx, frame, last_frame, *, fp, frame_offsets, metadata, **kwarg
             delta_descriptor.right,
             delta_descriptor.bottom,
         ]})
+    if delta_rects:
+        frame_metadata.update({"delta_rects": delta_rects})
     metadata.append(frame_metadata)
 
     # Write out the data for this frame to the output
@@ -20,6 +20,7 @@
 
 #include <stdio.h>
 #include <stdbool.h>
+#include <string.h>
 #include "util.h"
 #include "debug.h"
 #include "eeprom_legacy_emulated_flash.h"
@@ -65,13 +66,14 @@
  * *** General Algorithm ***
  *
  * During initialization:
- * The contents of the Compacted-flash area are loaded and the 1's complement value
+ * The contents of the Compacted-flash area are loaded a 32-bit word at a time and the 1's complement value
  * is cached into memory (e.g. 0xFFFF in Flash represents 0x0000 in cache).
  * Write log entries are processed until a 0xFFFF is reached.
  * Each log entry updates a byte or word in the cache.
+ * Compaction erases the write log, so only the changes made since the last compaction are replayed.
  *
  * During reads:
- * EEPROM contents are given back directly from the cache in memory.
+ * EEPROM contents are given back directly from the cache in memory, copying whole blocks at once.
  *
  * During writes:
  * The contents of the cache is updated first.
@@ -150,7 +152,7 @@
 
 /* In-memory contents of emulated eeprom for faster access */
 /* *TODO: Implement page swapping */
-static uint16_t WordBuf[FEE_DENSITY_BYTES / 2];
+static uint32_t WordBuf[(FEE_DENSITY_BYTES + 3) / 4];
 static uint8_t *DataBuf = (uint8_t *)WordBuf;
 
 /* Pointer to the first available slot within the write log */
@@ -216,11 +218,15 @@ void print_eeprom(void) {
 
 uint16_t EEPROM_Init(void) {
     /* Load emulated eeprom contents from compacted flash into memory */
-    uint16_t *src  = (uint16_t *)FEE_COMPACTED_BASE_ADDRESS;
-    uint16_t *dest = (uint16_t *)DataBuf;
-    for (; src < (uint16_t *)FEE_COMPACTED_LAST_ADDRESS; ++src, ++dest) {
+    uint32_t *src  = (uint32_t *)FEE_COMPACTED_BASE_ADDRESS;
+    uint32_t *dest = WordBuf;
+    for (; src < (uint32_t *)FEE_COMPACTED_BASE_ADDRESS + (FEE_DENSITY_BYTES / 4); ++src, ++dest) {
         *dest = ~*src;
     }
+#if (FEE_DENSITY_BYTES % 4)
+    /* FEE_DENSITY_BYTES is only required to be even, pick up the trailing half-word */
+    *(uint16_t *)dest = ~*(uint16_t *)src;
+#endif
 
     if (debug_eeprom) {
         println("EEPROM_Init Compacted Pages:");
@@ -576,33 +582,19 @@ void eeprom_driver_erase(void) {
 }
 
 void eeprom_read_block(void *buf, const void *addr, size_t len) {
-    const uint8_t *src  = (const uint8_t *)addr;
-    uint8_t *      dest = (uint8_t *)buf;
-
-    /* Check word alignment */
-    if (len && (uintptr_t)src % 2) {
-        /* Read the unaligned first byte */
-        *dest++ = EEPROM_ReadDataByte((const uintptr_t)src++);
-        --len;
+    uintptr_t src  = (uintptr_t)addr;
+    uint8_t * dest = (uint8_t *)buf;
+
+    /* Copy the in-range part straight out of the cache */
+    if (src < FEE_DENSITY_BYTES) {
+        size_t count = MIN(len, FEE_DENSITY_BYTES - src);
+        memcpy(dest, &DataBuf[src], count);
+        dest += count;
+        len -= count;
     }
 
-    uint16_t value;
-    bool     aligned = ((uintptr_t)dest % 2 == 0);
-    while (len > 1) {
-        value = EEPROM_ReadDataWord((const uintptr_t)((uint16_t *)src));
-        if (aligned) {
-            *(uint16_t *)dest = value;
-            dest += 2;
-        } else {
-            *dest++ = value;
-            *dest++ = value >> 8;
-        }
-        src += 2;
-        len -= 2;
-    }
-    if (len) {
-        *dest = EEPROM_ReadDataByte((const uintptr_t)src);
-    }
+    /* Out-of-bounds addresses read back as unprogrammed */
+    memset(dest, 0xFF, len);
 }
 
 void eeprom_write_block(const void *buf, void *addr, size_t len) {
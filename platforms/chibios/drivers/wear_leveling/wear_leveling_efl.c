@@ -3,6 +3,7 @@
 #include <stdbool.h>
 #include <hal.h>
 #include "timer.h"
+#include "util.h"
 #include "wear_leveling.h"
 #include "wear_leveling_efl_config.h"
 #include "wear_leveling_internal.h"
@@ -19,6 +20,10 @@ static flash_sector_t first_sector = UINT16_MAX;
 #    define WEAR_LEVELING_EFL_OMIT_LAST_SECTOR_COUNT 0
 #endif // WEAR_LEVELING_EFL_OMIT_LAST_SECTOR_COUNT
 
+#if !defined(WEAR_LEVELING_EFL_BULK_COUNT)
+#    define WEAR_LEVELING_EFL_BULK_COUNT 64
+#endif // WEAR_LEVELING_EFL_BULK_COUNT
+
 static flash_sector_t sector_count = UINT16_MAX;
 static BaseFlash *    flash;
 static bool           flash_erased_is_one;
@@ -134,14 +139,74 @@ bool backing_store_erase(void) {
     return ret;
 }
 
+#ifdef BACKING_STORE_ERASE_RANGE
+bool backing_store_erase_range(uint32_t address, uint32_t length) {
+#    ifdef WEAR_LEVELING_DEBUG_OUTPUT
+    uint32_t start = timer_read32();
+#    endif
+
+    bool          ret = true;
+    flash_error_t status;
+    for (int i = 0; i < sector_count; ++i) {
+        // Only erase the sectors within the range -- sectors straddling its boundaries can't be erased without losing data outside of it
+        uint32_t sector_start = flashGetSectorOffset(flash, first_sector + i) - base_offset;
+        uint32_t sector_end   = sector_start + flashGetSectorSize(flash, first_sector + i);
+        if (sector_end <= address || sector_start >= address + length) {
+            continue;
+        }
+        if (sector_start < address || sector_end > address + length) {
+            bs_dprintf("Sector %d straddles the erase range, banks must be aligned to sector boundaries\n", (int)(first_sector + i));
+            ret = false;
+            continue;
+        }
+
+        // Kick off the sector erase
+        status = flashStartEraseSector(flash, first_sector + i);
+        if (status != FLASH_NO_ERROR && status != FLASH_BUSY_ERASING) {
+            ret = false;
+        }
+
+        // Wait for the erase to complete
+        status = flashWaitErase(flash);
+        if (status != FLASH_NO_ERROR && status != FLASH_BUSY_ERASING) {
+            ret = false;
+        }
+    }
+
+    bs_dprintf("Backing store range erase took %ldms to complete\n", ((long)(timer_read32() - start)));
+    return ret;
+}
+#endif // BACKING_STORE_ERASE_RANGE
+
 bool backing_store_write(uint32_t address, backing_store_int_t value) {
+    return backing_store_write_bulk(address, &value, 1);
+}
+
+bool backing_store_write_bulk(uint32_t address, backing_store_int_t *values, size_t item_count) {
     uint32_t offset = (base_offset + address);
     bs_dprintf("Write ");
-    wl_dump(offset, &value, sizeof(value));
-    if (flash_erased_is_one) {
-        value = ~value;
+    wl_dump(offset, values, sizeof(backing_store_int_t) * item_count);
+
+    // No transformation needed, program the whole lot in one go
+    if (!flash_erased_is_one) {
+        return flashProgram(flash, offset, sizeof(backing_store_int_t) * item_count, (const uint8_t *)values) == FLASH_NO_ERROR;
+    }
+
+    // Otherwise complement the data in batches, without modifying the caller's buffer
+    backing_store_int_t temp[WEAR_LEVELING_EFL_BULK_COUNT];
+    while (item_count > 0) {
+        size_t this_loop = MIN(item_count, WEAR_LEVELING_EFL_BULK_COUNT);
+        for (size_t i = 0; i < this_loop; ++i) {
+            temp[i] = ~values[i];
+        }
+        if (flashProgram(flash, offset, sizeof(backing_store_int_t) * this_loop, (const uint8_t *)temp) != FLASH_NO_ERROR) {
+            return false;
+        }
+        offset += sizeof(backing_store_int_t) * this_loop;
+        values += this_loop;
+        item_count -= this_loop;
     }
-    return flashProgram(flash, offset, sizeof(value), (const uint8_t *)&value) == FLASH_NO_ERROR;
+    return true;
 }
 
 bool backing_store_lock(void) {
@@ -150,31 +215,34 @@ bool backing_store_lock(void) {
     return true;
 }
 
-static backing_store_int_t backing_store_safe_read_from_location(backing_store_int_t *loc) {
-    backing_store_int_t value;
-    is_issuing_read    = true;
-    ecc_error_occurred = false;
-    value              = flash_erased_is_one ? ~(*loc) : (*loc);
-    is_issuing_read    = false;
-    return value;
+bool backing_store_read(uint32_t address, backing_store_int_t *value) {
+    return backing_store_read_bulk(address, value, 1);
 }
 
-bool backing_store_read(uint32_t address, backing_store_int_t *value) {
-    uint32_t             offset = (base_offset + address);
-    backing_store_int_t *loc    = (backing_store_int_t *)flashGetOffsetAddress(flash, offset);
-    backing_store_int_t  tmp    = backing_store_safe_read_from_location(loc);
+bool backing_store_read_bulk(uint32_t address, backing_store_int_t *values, size_t item_count) {
+    uint32_t offset = (base_offset + address);
+
+    // Flash is memory-mapped, so copy it out directly -- any ECC error raised during the copy is caught by the NMI handler
+    is_issuing_read    = true;
+    ecc_error_occurred = false;
+    memcpy(values, flashGetOffsetAddress(flash, offset), sizeof(backing_store_int_t) * item_count);
+    is_issuing_read = false;
 
     if (ecc_error_occurred) {
         bs_dprintf("Failed to read from backing store, ECC error detected\n");
         ecc_error_occurred = false;
-        *value             = 0;
+        memset(values, 0, sizeof(backing_store_int_t) * item_count);
         return false;
     }
 
-    *value = tmp;
+    if (flash_erased_is_one) {
+        for (size_t i = 0; i < item_count; ++i) {
+            values[i] = ~values[i];
+        }
+    }
 
     bs_dprintf("Read  ");
-    wl_dump(offset, value, sizeof(backing_store_int_t));
+    wl_dump(offset, values, sizeof(backing_store_int_t) * item_count);
     return true;
 }
 
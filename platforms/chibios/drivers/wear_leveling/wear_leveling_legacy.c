@@ -37,6 +37,29 @@ bool backing_store_erase(void) {
     return ret;
 }
 
+#ifdef BACKING_STORE_ERASE_RANGE
+bool backing_store_erase_range(uint32_t address, uint32_t length) {
+#    ifdef WEAR_LEVELING_DEBUG_OUTPUT
+    uint32_t start = timer_read32();
+#    endif
+
+    // Ensure each bank can be erased without touching the other.
+    STATIC_ASSERT((WEAR_LEVELING_BANK_SIZE) % (WEAR_LEVELING_LEGACY_EMULATION_PAGE_SIZE) == 0, "Bank size must be a multiple of WEAR_LEVELING_LEGACY_EMULATION_PAGE_SIZE");
+
+    bool         ret = true;
+    FLASH_Status status;
+    for (uint32_t i = 0; i < length; i += (WEAR_LEVELING_LEGACY_EMULATION_PAGE_SIZE)) {
+        status = FLASH_ErasePage(WEAR_LEVELING_LEGACY_EMULATION_BASE_PAGE_ADDRESS + address + i);
+        if (status != FLASH_COMPLETE) {
+            ret = false;
+        }
+    }
+
+    bs_dprintf("Backing store range erase took %ldms to complete\n", ((long)(timer_read32() - start)));
+    return ret;
+}
+#endif // BACKING_STORE_ERASE_RANGE
+
 bool backing_store_write(uint32_t address, backing_store_int_t value) {
     uint32_t offset = ((WEAR_LEVELING_LEGACY_EMULATION_BASE_PAGE_ADDRESS) + address);
     bs_dprintf("Write ");
@@ -65,3 +65,8 @@
 #ifndef WEAR_LEVELING_LOGICAL_SIZE
 #    define WEAR_LEVELING_LOGICAL_SIZE 1024
 #endif
+
+// Double-bank consolidation erases one flash page per step
+#ifndef WEAR_LEVELING_ERASE_SECTOR_SIZE
+#    define WEAR_LEVELING_ERASE_SECTOR_SIZE (WEAR_LEVELING_LEGACY_EMULATION_PAGE_SIZE)
+#endif // WEAR_LEVELING_ERASE_SECTOR_SIZE
@@ -190,6 +190,24 @@ bool backing_store_erase(void) {
     return true;
 }
 
+#ifdef BACKING_STORE_ERASE_RANGE
+bool backing_store_erase_range(uint32_t address, uint32_t length) {
+#    ifdef WEAR_LEVELING_DEBUG_OUTPUT
+    uint32_t start = timer_read32();
+#    endif
+
+    // Ensure each bank can be erased without touching the other.
+    STATIC_ASSERT((WEAR_LEVELING_BANK_SIZE) % (FLASH_SECTOR_SIZE) == 0, "Bank size must be a multiple of FLASH_SECTOR_SIZE");
+
+    interrupts = save_and_disable_interrupts();
+    flash_range_erase((WEAR_LEVELING_RP2040_FLASH_BASE) + address, length);
+    restore_interrupts(interrupts);
+
+    bs_dprintf("Backing store range erase took %ldms to complete\n", ((long)(timer_read32() - start)));
+    return true;
+}
+#endif // BACKING_STORE_ERASE_RANGE
+
 bool backing_store_write(uint32_t address, backing_store_int_t value) {
     return backing_store_write_bulk(address, &value, 1);
 }
@@ -18,7 +18,11 @@
 
 // 32kB logical EEPROM
 #ifndef WEAR_LEVELING_LOGICAL_SIZE
-#    define WEAR_LEVELING_LOGICAL_SIZE ((WEAR_LEVELING_BACKING_SIZE) / 2)
+#    ifdef WEAR_LEVELING_DOUBLE_BANK
+#        define WEAR_LEVELING_LOGICAL_SIZE ((WEAR_LEVELING_BACKING_SIZE) / 4)
+#    else
+#        define WEAR_LEVELING_LOGICAL_SIZE ((WEAR_LEVELING_BACKING_SIZE) / 2)
+#    endif
 #endif // WEAR_LEVELING_LOGICAL_SIZE
 
 // Define how much flash space we have (defaults to lib/pico-sdk/src/boards/include/boards/***)
@@ -30,3 +34,8 @@
 #ifndef WEAR_LEVELING_RP2040_FLASH_BASE
 #    define WEAR_LEVELING_RP2040_FLASH_BASE ((WEAR_LEVELING_RP2040_FLASH_SIZE) - (WEAR_LEVELING_BACKING_SIZE))
 #endif
+
+// Double-bank consolidation erases one flash sector per step
+#ifndef WEAR_LEVELING_ERASE_SECTOR_SIZE
+#    define WEAR_LEVELING_ERASE_SECTOR_SIZE (FLASH_SECTOR_SIZE)
+#endif // WEAR_LEVELING_ERASE_SECTOR_SIZE
@@ -0,0 +1,39 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <iostream>
+
+#include "eeprom_legacy_emulated_flash_tests.cpp"
+
+TEST_F(EepromStm32Test, TestInitAndReadTiming) {
+    using clock = std::chrono::steady_clock;
+    fill_write_log();
+    EXPECT_NE(*(uint16_t*)&FlashBuf[LOG_BASE + LOG_SIZE - 8], 0xFFFF) << "Write log should be nearly full";
+
+    /* Take the best of several runs, to reduce noise */
+    constexpr int        runs      = 10;
+    clock::duration      init_time = clock::duration::max(), block_time = clock::duration::max(), byte_time = clock::duration::max();
+    std::vector<uint8_t> block(EEPROM_SIZE), bytes(EEPROM_SIZE);
+    for (int run = 0; run < runs; ++run) {
+        auto start = clock::now();
+        EEPROM_Init();
+        init_time = std::min(init_time, clock::now() - start);
+
+        start = clock::now();
+        eeprom_read_block(block.data(), (void*)0, EEPROM_SIZE);
+        block_time = std::min(block_time, clock::now() - start);
+
+        start = clock::now();
+        for (uint16_t i = 0; i < EEPROM_SIZE; ++i) {
+            bytes[i] = EEPROM_ReadDataByte(i);
+        }
+        byte_time = std::min(byte_time, clock::now() - start);
+
+        EXPECT_EQ(block, bytes) << "Block read did not match byte reads";
+    }
+
+    auto us = [](clock::duration d) { return std::chrono::duration<double, std::micro>(d).count(); };
+    std::cout << "EEPROM_Init with a full write log: " << us(init_time) << "us" << std::endl;
+    std::cout << "eeprom_read_block of " << EEPROM_SIZE << " bytes: " << us(block_time) << "us, byte-wise: " << us(byte_time) << "us" << std::endl;
+}
@@ -14,6 +14,8 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <cstring>
+#include <vector>
 #include "gtest/gtest.h"
 
 extern "C" {
@@ -435,3 +437,93 @@ TEST_F(EepromStm32Test, TestCompaction) {
     EXPECT_EQ(*(uint16_t*)&FlashBuf[LOG_BASE], 0xFFFF);
     EXPECT_EQ(*(uint16_t*)&FlashBuf[LOG_BASE + LOG_SIZE - 2], 0xFFFF);
 }
+
+/* Deterministic pseudo-random sequence, so that failures are reproducible */
+static uint32_t next_random(uint32_t& state) {
+    state = state * 1664525 + 1013904223;
+    return state >> 8;
+}
+
+/* Fills the write log with word entries, stopping just short of a compaction */
+static void fill_write_log(void) {
+    uint32_t state = 0x1234;
+    uint16_t addr  = 0x80;
+    /* Prime the compacted area, so that subsequent writes go to the log */
+    for (uint16_t a = 0x80; a < EEPROM_SIZE; a += 2) {
+        EEPROM_WriteDataWord(a, 0xFFFF);
+    }
+    for (uint32_t i = 0; i < (LOG_SIZE / 4) - 1; ++i) {
+        EEPROM_WriteDataWord(addr, (next_random(state) & 0xFFFC) | 2);
+        addr += 2;
+        if (addr >= EEPROM_SIZE) addr = 0x80;
+    }
+}
+
+TEST_F(EepromStm32Test, TestBlockReadMatchesBytes) {
+    uint32_t state = 0xbeef;
+    for (uint16_t i = 0; i < EEPROM_SIZE; ++i) {
+        EEPROM_WriteDataByte(i, next_random(state));
+    }
+    EEPROM_Init();
+
+    uint8_t buf[64 + 3];
+    for (uint16_t start : {0, 1, 2, 3, 0x7F, 0x80, 0x81, EEPROM_SIZE - 33, EEPROM_SIZE - 8, EEPROM_SIZE - 1, EEPROM_SIZE, EEPROM_SIZE + 5}) {
+        for (size_t len : {0, 1, 2, 3, 4, 7, 32, 64}) {
+            for (size_t dst_offset = 0; dst_offset < 4; ++dst_offset) {
+                memset(buf, 0x5a, sizeof(buf));
+                eeprom_read_block(&buf[dst_offset], (void*)(uintptr_t)start, len);
+                for (size_t i = 0; i < len; ++i) {
+                    EXPECT_EQ(buf[dst_offset + i], EEPROM_ReadDataByte(start + i)) << "Mismatch reading " << len << " bytes from " << start << " at offset " << i;
+                }
+                /* Nothing outside of the requested range should have been touched */
+                for (size_t i = 0; i < dst_offset; ++i) {
+                    EXPECT_EQ(buf[i], 0x5a) << "Block read wrote before the destination";
+                }
+                for (size_t i = dst_offset + len; i < sizeof(buf); ++i) {
+                    EXPECT_EQ(buf[i], 0x5a) << "Block read wrote past the end of the destination";
+                }
+            }
+        }
+    }
+}
+
+TEST_F(EepromStm32Test, TestReplayMatchesCache) {
+    std::vector<uint8_t> expected(EEPROM_SIZE, 0);
+    std::vector<uint8_t> actual(EEPROM_SIZE);
+    uint32_t             state = 0xc0ffee;
+    /* Enough writes to pass through several compactions */
+    for (uint32_t i = 0; i < LOG_SIZE * 2; ++i) {
+        uint16_t addr  = next_random(state) % (EEPROM_SIZE - 1);
+        uint32_t kind  = next_random(state) % 4;
+        uint16_t value = kind == 0 ? 0 : kind == 1 ? 1 : next_random(state);
+        if (kind == 3) {
+            EEPROM_WriteDataByte(addr, value);
+            expected[addr] = value;
+        } else {
+            EEPROM_WriteDataWord(addr, value);
+            expected[addr]     = value;
+            expected[addr + 1] = value >> 8;
+        }
+        if (i % (LOG_SIZE / 8) == 0) {
+            EEPROM_Init();
+            eeprom_read_block(actual.data(), (void*)0, EEPROM_SIZE);
+            ASSERT_EQ(actual, expected) << "Contents did not match after replaying the log, " << i << " writes in";
+        }
+    }
+    EEPROM_Init();
+    eeprom_read_block(actual.data(), (void*)0, EEPROM_SIZE);
+    EXPECT_EQ(actual, expected) << "Contents did not match after replaying the log";
+}
+
+TEST_F(EepromStm32Test, TestInitAndReadWithFullLog) {
+    fill_write_log();
+    EXPECT_NE(*(uint16_t*)&FlashBuf[LOG_BASE + LOG_SIZE - 8], 0xFFFF) << "Write log should be nearly full";
+
+    std::vector<uint8_t> block(EEPROM_SIZE), bytes(EEPROM_SIZE);
+    EEPROM_Init();
+    eeprom_read_block(block.data(), (void*)0, EEPROM_SIZE);
+    for (uint16_t i = 0; i < EEPROM_SIZE; ++i) {
+        bytes[i] = EEPROM_ReadDataByte(i);
+    }
+    EXPECT_EQ(block, bytes) << "Block read did not match byte reads";
+}
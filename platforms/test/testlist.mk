@@ -1 +1,3 @@
 TEST_LIST += eeprom_legacy_emulated_flash_tiny eeprom_legacy_emulated_flash_large
+
+BENCHMARK_LIST += eeprom_legacy_emulated_flash_benchmark
@@ -15,6 +15,7 @@
 #include <stdint.h>
 #include "caps_word.h"
 #include "timer.h"
+#include "timeouts.h"
 #include "action.h"
 #include "action_util.h"
 
@@ -39,6 +40,7 @@ void caps_word_task(void) {
 
 void caps_word_reset_idle_timer(void) {
     idle_timer = timer_read() + CAPS_WORD_IDLE_TIMEOUT;
+    timeout_schedule_in(TIMEOUT_CAPS_WORD, CAPS_WORD_IDLE_TIMEOUT);
 }
 #else
 void caps_word_task(void) {}
@@ -39,6 +39,125 @@ static inline deferred_token allocate_token(deferred_executor_t *table, size_t t
     return current_token;
 }
 
+/* Each table is kept as a binary min-heap ordered by trigger time. Occupied entries are packed at the start of the table,
+ * so a zero-initialised table is an empty heap and the number of entries can be found by bisecting for the first free
+ * slot. */
+
+static inline bool triggers_before(const deferred_executor_t *a, const deferred_executor_t *b) {
+    return ((int32_t)TIMER_DIFF_32(a->trigger_time, b->trigger_time)) < 0;
+}
+
+static inline size_t heap_size(deferred_executor_t *table, size_t table_count) {
+    size_t lo = 0, hi = table_count;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (table[mid].token != INVALID_DEFERRED_TOKEN) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+static inline void heap_swap(deferred_executor_t *table, size_t a, size_t b) {
+    deferred_executor_t tmp = table[a];
+    table[a]                = table[b];
+    table[b]                = tmp;
+}
+
+static size_t heap_sift_up(deferred_executor_t *table, size_t index) {
+    while (index > 0) {
+        size_t parent = (index - 1) / 2;
+        if (!triggers_before(&table[index], &table[parent])) {
+            break;
+        }
+        heap_swap(table, index, parent);
+        index = parent;
+    }
+    return index;
+}
+
+static void heap_sift_down(deferred_executor_t *table, size_t size, size_t index) {
+    while (1) {
+        size_t child = 2 * index + 1;
+        if (child >= size) {
+            break;
+        }
+        if (child + 1 < size && triggers_before(&table[child + 1], &table[child])) {
+            ++child;
+        }
+        if (!triggers_before(&table[child], &table[index])) {
+            break;
+        }
+        heap_swap(table, index, child);
+        index = child;
+    }
+}
+
+// Restores the heap after the trigger time of the entry at the given index has changed
+static inline void heap_update(deferred_executor_t *table, size_t size, size_t index) {
+    heap_sift_down(table, size, heap_sift_up(table, index));
+}
+
+static void heap_remove(deferred_executor_t *table, size_t size, size_t index) {
+    table[index] = table[size - 1];
+
+    deferred_executor_t *last = &table[size - 1];
+    last->token               = INVALID_DEFERRED_TOKEN;
+    last->trigger_time        = 0;
+    last->callback            = NULL;
+    last->cb_arg              = NULL;
+
+    if (index < size - 1) {
+        heap_update(table, size - 1, index);
+    }
+}
+
+// Returns the index of the entry with the given token, or size if it isn't queued
+static inline size_t heap_find(deferred_executor_t *table, size_t size, deferred_token token) {
+    for (size_t i = 0; i < size; ++i) {
+        if (table[i].token == token) {
+            return i;
+        }
+    }
+    return size;
+}
+
+// Set of tokens, one bit per possible deferred_token value
+typedef uint8_t token_set_t[(1 << (8 * sizeof(deferred_token))) / 8];
+
+static inline bool token_set_contains(const token_set_t set, deferred_token token) {
+    return set[token / 8] & (1 << (token % 8));
+}
+
+static inline void token_set_add(token_set_t set, deferred_token token) {
+    set[token / 8] |= 1 << (token % 8);
+}
+
+static inline bool is_due(const deferred_executor_t *entry, uint32_t now) {
+    return ((int32_t)TIMER_DIFF_32(entry->trigger_time, now)) <= 0;
+}
+
+// Returns the index of the earliest due entry that hasn't run yet, or size if there is none
+static size_t heap_next_due(deferred_executor_t *table, size_t size, uint32_t now, const token_set_t ran) {
+    if (size == 0 || !is_due(&table[0], now)) {
+        return size;
+    }
+    if (!token_set_contains(ran, table[0].token)) {
+        return 0;
+    }
+
+    // An executor that already ran is still due, so the remaining ones have to be searched for
+    size_t next = size;
+    for (size_t i = 1; i < size; ++i) {
+        if (is_due(&table[i], now) && !token_set_contains(ran, table[i].token) && (next == size || triggers_before(&table[i], &table[next]))) {
+            next = i;
+        }
+    }
+    return next;
+}
+
 //------------------------------------
 // Advanced API: used when a custom-allocated table is used, primarily for core code.
 //
@@ -49,27 +168,26 @@ deferred_token defer_exec_advanced(deferred_executor_t *table, size_t table_coun
         return INVALID_DEFERRED_TOKEN;
     }
 
-    // Find an unused slot and claim it
-    for (int i = 0; i < table_count; ++i) {
-        deferred_executor_t *entry = &table[i];
-        if (entry->token == INVALID_DEFERRED_TOKEN) {
-            // Work out the new token value, dropping out if none were available
-            deferred_token token = allocate_token(table, table_count);
-            if (token == INVALID_DEFERRED_TOKEN) {
-                return false;
-            }
+    // Claim the slot after the last queued entry, if any are available
+    size_t size = heap_size(table, table_count);
+    if (size == table_count) {
+        return INVALID_DEFERRED_TOKEN;
+    }
 
-            // Set up the executor table entry
-            entry->token        = current_token;
-            entry->trigger_time = timer_read32() + delay_ms;
-            entry->callback     = callback;
-            entry->cb_arg       = cb_arg;
-            return current_token;
-        }
+    // Work out the new token value, dropping out if none were available
+    deferred_token token = allocate_token(table, table_count);
+    if (token == INVALID_DEFERRED_TOKEN) {
+        return INVALID_DEFERRED_TOKEN;
     }
 
-    // None available
-    return INVALID_DEFERRED_TOKEN;
+    // Set up the executor table entry, then move it into place
+    deferred_executor_t *entry = &table[size];
+    entry->token               = token;
+    entry->trigger_time        = timer_read32() + delay_ms;
+    entry->callback            = callback;
+    entry->cb_arg              = cb_arg;
+    heap_sift_up(table, size);
+    return token;
 }
 
 bool extend_deferred_exec_advanced(deferred_executor_t *table, size_t table_count, deferred_token token, uint32_t delay_ms) {
@@ -79,17 +197,16 @@ bool extend_deferred_exec_advanced(deferred_executor_t *table, size_t table_coun
     }
 
     // Find the entry corresponding to the token
-    for (int i = 0; i < table_count; ++i) {
-        deferred_executor_t *entry = &table[i];
-        if (entry->token == token) {
-            // Found it, extend the delay
-            entry->trigger_time = timer_read32() + delay_ms;
-            return true;
-        }
+    size_t size  = heap_size(table, table_count);
+    size_t index = heap_find(table, size, token);
+    if (index == size) {
+        return false;
     }
 
-    // Not found
-    return false;
+    // Found it, extend the delay
+    table[index].trigger_time = timer_read32() + delay_ms;
+    heap_update(table, size, index);
+    return true;
 }
 
 bool cancel_deferred_exec_advanced(deferred_executor_t *table, size_t table_count, deferred_token token) {
@@ -99,20 +216,25 @@ bool cancel_deferred_exec_advanced(deferred_executor_t *table, size_t table_coun
     }
 
     // Find the entry corresponding to the token
-    for (int i = 0; i < table_count; ++i) {
-        deferred_executor_t *entry = &table[i];
-        if (entry->token == token) {
-            // Found it, cancel and clear the table entry
-            entry->token        = INVALID_DEFERRED_TOKEN;
-            entry->trigger_time = 0;
-            entry->callback     = NULL;
-            entry->cb_arg       = NULL;
-            return true;
-        }
+    size_t size  = heap_size(table, table_count);
+    size_t index = heap_find(table, size, token);
+    if (index == size) {
+        return false;
+    }
+
+    // Found it, cancel and clear the table entry
+    heap_remove(table, size, index);
+    return true;
+}
+
+bool deferred_exec_advanced_next_deadline(deferred_executor_t *table, size_t table_count, uint32_t *trigger_time) {
+    if (!table || table_count == 0 || table[0].token == INVALID_DEFERRED_TOKEN) {
+        return false;
     }
 
-    // Not found
-    return false;
+    // The earliest entry is always at the top of the heap
+    *trigger_time = table[0].trigger_time;
+    return true;
 }
 
 void deferred_exec_advanced_task(deferred_executor_t *table, size_t table_count, uint32_t *last_execution_time) {
@@ -122,35 +244,42 @@ void deferred_exec_advanced_task(deferred_executor_t *table, size_t table_count,
     if (((int32_t)TIMER_DIFF_32(now, (*last_execution_time))) > 0) {
         *last_execution_time = now;
 
-        // Run through each of the executors
-        for (int i = 0; i < table_count; ++i) {
-            deferred_executor_t *entry      = &table[i];
+        // Run the due executors, earliest first. Each executor runs at most once per pass, so a repeating executor
+        // that has fallen behind cannot hold up the main loop while catching up.
+        token_set_t ran = {0};
+        while (true) {
+            size_t size  = heap_size(table, table_count);
+            size_t index = heap_next_due(table, size, now, ran);
+            if (index == size) {
+                break;
+            }
+
+            deferred_executor_t *entry      = &table[index];
             deferred_token       curr_token = entry->token;
+            token_set_add(ran, curr_token);
 
-            // Check if we're supposed to execute this entry
-            if (curr_token != INVALID_DEFERRED_TOKEN && ((int32_t)TIMER_DIFF_32(entry->trigger_time, now)) <= 0) {
-                // Invoke the callback and work work out if we should be requeued
-                uint32_t delay_ms = entry->callback(entry->trigger_time, entry->cb_arg);
-
-                // If the token has changed, then the callback has canceled and re-queued. Skip further processing.
-                if (entry->token != curr_token) {
-                    continue;
-                }
-
-                // Update the trigger time if we have to repeat, otherwise clear it out
-                if (delay_ms > 0) {
-                    // Intentionally add just the delay to the existing trigger time -- this ensures the next
-                    // invocation is with respect to the previous trigger, rather than when it got to execution. Under
-                    // normal circumstances this won't cause issue, but if another executor is invoked that takes a
-                    // considerable length of time, then this ensures best-effort timing between invocations.
-                    entry->trigger_time += delay_ms;
-                } else {
-                    // If it was zero, then the callback is cancelling repeated execution. Free up the slot.
-                    entry->token        = INVALID_DEFERRED_TOKEN;
-                    entry->trigger_time = 0;
-                    entry->callback     = NULL;
-                    entry->cb_arg       = NULL;
-                }
+            // Invoke the callback and work work out if we should be requeued
+            uint32_t delay_ms = entry->callback(entry->trigger_time, entry->cb_arg);
+
+            // The callback may have queued, extended or cancelled executors, moving this one around the heap. If it
+            // can no longer be found, then the callback has canceled (and maybe re-queued). Skip further processing.
+            size  = heap_size(table, table_count);
+            index = table[index].token == curr_token ? index : heap_find(table, size, curr_token);
+            if (index == size) {
+                continue;
+            }
+
+            // Update the trigger time if we have to repeat, otherwise clear it out
+            if (delay_ms > 0) {
+                // Intentionally add just the delay to the existing trigger time -- this ensures the next
+                // invocation is with respect to the previous trigger, rather than when it got to execution. Under
+                // normal circumstances this won't cause issue, but if another executor is invoked that takes a
+                // considerable length of time, then this ensures best-effort timing between invocations.
+                table[index].trigger_time += delay_ms;
+                heap_update(table, size, index);
+            } else {
+                // If it was zero, then the callback is cancelling repeated execution. Free up the slot.
+                heap_remove(table, size, index);
             }
         }
     }
@@ -172,6 +301,9 @@ bool extend_deferred_exec(deferred_token token, uint32_t delay_ms) {
 bool cancel_deferred_exec(deferred_token token) {
     return cancel_deferred_exec_advanced(basic_executors, MAX_DEFERRED_EXECUTORS, token);
 }
+bool deferred_exec_next_deadline(uint32_t *trigger_time) {
+    return deferred_exec_advanced_next_deadline(basic_executors, MAX_DEFERRED_EXECUTORS, trigger_time);
+}
 void deferred_exec_task(void) {
     deferred_exec_advanced_task(basic_executors, MAX_DEFERRED_EXECUTORS, &last_deferred_exec_check);
 }
@@ -32,16 +32,75 @@
 #    define DYNAMIC_KEYMAP_MACRO_DELAY TAP_CODE_DELAY
 #endif
 
+#if DYNAMIC_KEYMAP_CACHED_LAYER_COUNT > DYNAMIC_KEYMAP_LAYER_COUNT
+#    undef DYNAMIC_KEYMAP_CACHED_LAYER_COUNT
+#    define DYNAMIC_KEYMAP_CACHED_LAYER_COUNT DYNAMIC_KEYMAP_LAYER_COUNT
+#endif
+
+#if DYNAMIC_KEYMAP_CACHED_LAYER_COUNT > 0
+// RAM mirror of the cached layers, loaded from NVM by dynamic_keymap_init()
+static uint16_t dynamic_keymap_cache[DYNAMIC_KEYMAP_CACHED_LAYER_COUNT][MATRIX_ROWS][MATRIX_COLS];
+static bool     dynamic_keymap_cache_loaded = false;
+
+#    define DYNAMIC_KEYMAP_CACHE_SIZE (sizeof(dynamic_keymap_cache))
+
+static void dynamic_keymap_cache_load(void) {
+    // Read the big-endian NVM buffer straight into the cache, then convert in place
+    uint8_t *p = (uint8_t *)dynamic_keymap_cache;
+    nvm_dynamic_keymap_read_buffer(0, DYNAMIC_KEYMAP_CACHE_SIZE, p);
+    for (uint16_t i = 0; i < DYNAMIC_KEYMAP_CACHE_SIZE / 2; i++, p += 2) {
+        ((uint16_t *)dynamic_keymap_cache)[i] = (p[0] << 8) | p[1];
+    }
+    dynamic_keymap_cache_loaded = true;
+}
+
+// Applies part of a big-endian keymap buffer written to NVM to the cache
+static void dynamic_keymap_cache_update_buffer(uint16_t offset, uint16_t size, const uint8_t *data) {
+    if (!dynamic_keymap_cache_loaded) {
+        return;
+    }
+    for (uint16_t i = 0; i < size && offset + i < DYNAMIC_KEYMAP_CACHE_SIZE; i++) {
+        uint16_t *keycode = &((uint16_t *)dynamic_keymap_cache)[(offset + i) / 2];
+        if ((offset + i) & 1) {
+            *keycode = (*keycode & 0xFF00) | data[i];
+        } else {
+            *keycode = (*keycode & 0x00FF) | (data[i] << 8);
+        }
+    }
+}
+#endif // DYNAMIC_KEYMAP_CACHED_LAYER_COUNT > 0
+
+void dynamic_keymap_init(void) {
+#if DYNAMIC_KEYMAP_CACHED_LAYER_COUNT > 0
+    dynamic_keymap_cache_load();
+#endif // DYNAMIC_KEYMAP_CACHED_LAYER_COUNT > 0
+}
+
 uint8_t dynamic_keymap_get_layer_count(void) {
     return DYNAMIC_KEYMAP_LAYER_COUNT;
 }
 
 uint16_t dynamic_keymap_get_keycode(uint8_t layer, uint8_t row, uint8_t column) {
+#if DYNAMIC_KEYMAP_CACHED_LAYER_COUNT > 0
+    // Positions come straight from the host, anything out of range is left to the NVM provider to reject
+    if (layer < DYNAMIC_KEYMAP_CACHED_LAYER_COUNT && row < MATRIX_ROWS && column < MATRIX_COLS) {
+        // Lookups made before keyboard_init(), e.g. from keyboard_pre_init_user()
+        if (!dynamic_keymap_cache_loaded) {
+            dynamic_keymap_cache_load();
+        }
+        return dynamic_keymap_cache[layer][row][column];
+    }
+#endif // DYNAMIC_KEYMAP_CACHED_LAYER_COUNT > 0
     return nvm_dynamic_keymap_read_keycode(layer, row, column);
 }
 
 void dynamic_keymap_set_keycode(uint8_t layer, uint8_t row, uint8_t column, uint16_t keycode) {
     nvm_dynamic_keymap_update_keycode(layer, row, column, keycode);
+#if DYNAMIC_KEYMAP_CACHED_LAYER_COUNT > 0
+    if (layer < DYNAMIC_KEYMAP_CACHED_LAYER_COUNT && row < MATRIX_ROWS && column < MATRIX_COLS) {
+        dynamic_keymap_cache[layer][row][column] = keycode;
+    }
+#endif // DYNAMIC_KEYMAP_CACHED_LAYER_COUNT > 0
 }
 
 #ifdef ENCODER_MAP_ENABLE
@@ -80,6 +139,9 @@ void dynamic_keymap_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
 
 void dynamic_keymap_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
     nvm_dynamic_keymap_update_buffer(offset, size, data);
+#if DYNAMIC_KEYMAP_CACHED_LAYER_COUNT > 0
+    dynamic_keymap_cache_update_buffer(offset, size, data);
+#endif // DYNAMIC_KEYMAP_CACHED_LAYER_COUNT > 0
 }
 
 uint16_t keycode_at_keymap_location(uint8_t layer_num, uint8_t row, uint8_t column) {
@@ -167,5 +229,13 @@ void dynamic_keymap_macro_send(uint8_t id) {
     }
 
     send_string_nvm_state_t state = {.offset = offset};
+#ifdef SEND_STRING_ASYNC_BUFFER_SIZE
+    if (send_string_async_with_delay_impl(send_string_get_next_nvm, &state, DYNAMIC_KEYMAP_MACRO_DELAY)) {
+        return;
+    }
+    // Too long to queue, type it out after anything already queued.
+    send_string_async_flush();
+    state.offset = offset;
+#endif
     send_string_with_delay_impl(send_string_get_next_nvm, &state, DYNAMIC_KEYMAP_MACRO_DELAY);
 }
@@ -26,6 +26,16 @@
 #    define DYNAMIC_KEYMAP_MACRO_COUNT 16
 #endif
 
+// Number of layers, starting from layer 0, mirrored in RAM so that keycode
+// lookups don't need to go through NVM. Each layer costs MATRIX_ROWS *
+// MATRIX_COLS * 2 bytes of RAM, any other layers are still read from NVM.
+#ifndef DYNAMIC_KEYMAP_CACHED_LAYER_COUNT
+#    define DYNAMIC_KEYMAP_CACHED_LAYER_COUNT 0
+#endif
+
+// Loads the cached layers, called by keyboard_init() once the EEPROM has been validated
+void dynamic_keymap_init(void);
+
 uint8_t  dynamic_keymap_get_layer_count(void);
 uint16_t dynamic_keymap_get_keycode(uint8_t layer, uint8_t row, uint8_t column);
 void     dynamic_keymap_set_keycode(uint8_t layer, uint8_t row, uint8_t column, uint16_t keycode);
@@ -25,6 +25,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "keycode.h"
 #include "timer.h"
 #include "sync_timer.h"
+#include "timeouts.h"
 #include "print.h"
 #include "debug.h"
 #include "command.h"
@@ -71,6 +72,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef COMBO_ENABLE
 #    include "process_combo.h"
 #endif
+#ifdef SEND_STRING_ENABLE
+#    include "send_string.h"
+#endif
 #ifdef TAP_DANCE_ENABLE
 #    include "process_tap_dance.h"
 #endif
@@ -104,9 +108,18 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef VIA_ENABLE
 #    include "via.h"
 #endif
+#ifdef DYNAMIC_KEYMAP_ENABLE
+#    include "dynamic_keymap.h"
+#endif
 #ifdef DIP_SWITCH_ENABLE
 #    include "dip_switch.h"
 #endif
+#ifdef NVM_CACHE_ENABLE
+#    include "nvm_cache.h"
+#endif
+#if defined(WEAR_LEVELING_ENABLE) && defined(WEAR_LEVELING_DOUBLE_BANK)
+#    include "wear_leveling.h"
+#endif
 #ifdef EEPROM_DRIVER
 #    include "eeprom_driver.h"
 #endif
@@ -419,6 +432,18 @@ __attribute__((weak)) void housekeeping_task_user(void) {}
  * Invokes hooks for executing code after QMK is done after each loop iteration.
  */
 void housekeeping_task(void) {
+#if defined(WEAR_LEVELING_ENABLE) && defined(WEAR_LEVELING_DOUBLE_BANK)
+    // Advance any pending wear-leveling consolidation by one step
+    wear_leveling_task();
+#endif
+#ifdef EEPROM_DRIVER
+    // Start any queued EEPROM page writes once the device is ready
+    eeprom_driver_task();
+#endif
+#if defined(VIA_ENABLE) && defined(VIA_STREAM_ENABLE)
+    // Send the next reports of any VIA buffer stream
+    via_task();
+#endif
     housekeeping_task_modules();
     housekeeping_task_kb();
     housekeeping_task_user();
@@ -468,6 +493,10 @@ void keyboard_init(void) {
 #endif
     matrix_init();
     quantum_init();
+#ifdef DYNAMIC_KEYMAP_ENABLE
+    // After quantum_init(), so that any EEPROM reset has already rewritten the keymap
+    dynamic_keymap_init();
+#endif
 #ifdef CONNECTION_ENABLE
     connection_init();
 #endif
@@ -648,6 +677,9 @@ void quantum_task(void) {
     if (!is_keyboard_master()) return;
 #endif
 
+    // Tasks that only wait for a timer to run out are dispatched once it has
+    __attribute__((unused)) timeout_mask_t expired_timeouts = timeout_expired();
+
 #if defined(AUDIO_ENABLE) && defined(AUDIO_INIT_DELAY)
     // There are some tasks that need to be run a little bit
     // after keyboard startup, or else they will not work correctly
@@ -676,20 +708,24 @@ void quantum_task(void) {
     key_override_task();
 #endif
 
+#if defined(SEND_STRING_ENABLE) && defined(SEND_STRING_ASYNC_BUFFER_SIZE)
+    send_string_async_task();
+#endif
+
 #ifdef SEQUENCER_ENABLE
     sequencer_task();
 #endif
 
 #ifdef TAP_DANCE_ENABLE
-    tap_dance_task();
+    if (expired_timeouts & TIMEOUT_BIT(TIMEOUT_TAP_DANCE)) tap_dance_task();
 #endif
 
 #ifdef COMBO_ENABLE
-    combo_task();
+    if (expired_timeouts & TIMEOUT_BIT(TIMEOUT_COMBO)) combo_task();
 #endif
 
 #ifdef LEADER_ENABLE
-    leader_task();
+    if (expired_timeouts & TIMEOUT_BIT(TIMEOUT_LEADER)) leader_task();
 #endif
 
 #ifdef WPM_ENABLE
@@ -705,15 +741,15 @@ void quantum_task(void) {
 #endif
 
 #ifdef CAPS_WORD_ENABLE
-    caps_word_task();
+    if (expired_timeouts & TIMEOUT_BIT(TIMEOUT_CAPS_WORD)) caps_word_task();
 #endif
 
 #ifdef SECURE_ENABLE
-    secure_task();
+    if (expired_timeouts & TIMEOUT_BIT(TIMEOUT_SECURE)) secure_task();
 #endif
 
 #ifdef LAYER_LOCK_ENABLE
-    layer_lock_task();
+    if (expired_timeouts & TIMEOUT_BIT(TIMEOUT_LAYER_LOCK)) layer_lock_task();
 #endif
 }
 
@@ -812,4 +848,8 @@ void keyboard_task(void) {
 #ifdef OS_DETECTION_ENABLE
     os_detection_task();
 #endif
+
+#ifdef NVM_CACHE_ENABLE
+    nvm_cache_task();
+#endif
 }
@@ -14,6 +14,7 @@
 
 #include "layer_lock.h"
 #include "quantum_keycodes.h"
+#include "timeouts.h"
 
 #ifndef NO_ACTION_LAYER
 // The current lock state. The kth bit is on if layer k is locked.
@@ -31,6 +32,7 @@ void layer_lock_timeout_task(void) {
 }
 void layer_lock_activity_trigger(void) {
     layer_lock_timer = timer_read32();
+    timeout_schedule(TIMEOUT_LAYER_LOCK, layer_lock_timer + LAYER_LOCK_IDLE_TIMEOUT + 1);
 }
 #    else
 void layer_lock_timeout_task(void) {}
@@ -3,6 +3,7 @@
 
 #include "leader.h"
 #include "timer.h"
+#include "timeouts.h"
 #include "util.h"
 
 #include <string.h>
@@ -31,8 +32,8 @@ void leader_start(void) {
     }
     leader_start_user();
     leading              = true;
-    leader_time          = timer_read();
     leader_sequence_size = 0;
+    leader_reset_timer();
     memset(leader_sequence, 0, sizeof(leader_sequence));
 }
 
@@ -81,6 +82,7 @@ bool leader_sequence_timed_out(void) {
 
 void leader_reset_timer(void) {
     leader_time = timer_read();
+    timeout_schedule_in(TIMEOUT_LEADER, LEADER_TIMEOUT + 1);
 }
 
 bool leader_sequence_is(uint16_t kc1, uint16_t kc2, uint16_t kc3, uint16_t kc4, uint16_t kc5) {
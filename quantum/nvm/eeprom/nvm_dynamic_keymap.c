@@ -8,6 +8,7 @@
 #include "nvm_dynamic_keymap.h"
 #include "nvm_eeprom_eeconfig_internal.h"
 #include "nvm_eeprom_via_internal.h"
+#include "nvm_eeprom_cache_internal.h"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -45,9 +45,14 @@
 #    include "connection.h"
 #endif
 
+#include "nvm_eeprom_cache_internal.h"
+
 void nvm_eeconfig_erase(void) {
 #ifdef EEPROM_DRIVER
     eeprom_driver_format(false);
+#    ifdef NVM_CACHE_ENABLE
+    nvm_cache_invalidate();
+#    endif
 #endif // EEPROM_DRIVER
 }
 
@@ -66,6 +71,9 @@ void nvm_eeconfig_enable(void) {
 void nvm_eeconfig_disable(void) {
 #if defined(EEPROM_DRIVER)
     eeprom_driver_format(false);
+#    ifdef NVM_CACHE_ENABLE
+    nvm_cache_invalidate();
+#    endif
 #endif
     eeprom_update_word(EECONFIG_MAGIC, EECONFIG_MAGIC_NUMBER_OFF);
 }
@@ -0,0 +1,19 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+// With the write-back cache enabled, all accesses made by the eeprom NVM
+// provider go through it instead of straight to the EEPROM driver. Must be
+// included after eeprom.h.
+#ifdef NVM_CACHE_ENABLE
+#    include "nvm_cache.h"
+
+#    define eeprom_read_byte(addr) nvm_cache_read_byte(addr)
+#    define eeprom_read_word(addr) nvm_cache_read_word(addr)
+#    define eeprom_read_dword(addr) nvm_cache_read_dword(addr)
+#    define eeprom_read_block(buf, addr, len) nvm_cache_read_block(buf, addr, len)
+#    define eeprom_update_byte(addr, value) nvm_cache_update_byte(addr, value)
+#    define eeprom_update_word(addr, value) nvm_cache_update_word(addr, value)
+#    define eeprom_update_dword(addr, value) nvm_cache_update_dword(addr, value)
+#    define eeprom_update_block(buf, addr, len) nvm_cache_update_block(buf, addr, len)
+#endif
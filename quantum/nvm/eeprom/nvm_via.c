@@ -7,6 +7,7 @@
 #include "nvm_via.h"
 #include "nvm_eeprom_eeconfig_internal.h"
 #include "nvm_eeprom_via_internal.h"
+#include "nvm_eeprom_cache_internal.h"
 
 void nvm_via_erase(void) {
     // No-op, nvm_eeconfig_erase() will have already erased EEPROM if necessary.
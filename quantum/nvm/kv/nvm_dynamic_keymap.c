@@ -0,0 +1,95 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "keycodes.h"
+#include "util.h"
+#include "dynamic_keymap.h"
+#include "nvm_dynamic_keymap.h"
+#include "nvm_kv.h"
+#include "nvm_kv_keys.h"
+
+#ifdef ENCODER_ENABLE
+#    include "encoder.h"
+#endif
+
+// Keycodes are stored big endian, keeping the same layout as the eeprom provider for the buffer APIs
+
+void nvm_dynamic_keymap_erase(void) {
+    // No-op, nvm_eeconfig_erase() will have already removed all values if necessary.
+}
+
+void nvm_dynamic_keymap_macro_erase(void) {
+    // No-op, nvm_eeconfig_erase() will have already removed all values if necessary.
+}
+
+static inline uint16_t dynamic_keymap_read_be16(uint16_t first_key, uint32_t offset) {
+    uint8_t data[2];
+    nvm_kv_read_chunked(first_key, offset, data, sizeof(data));
+    return ((uint16_t)data[0] << 8) | data[1];
+}
+
+static inline void dynamic_keymap_update_be16(uint16_t first_key, uint32_t offset, uint16_t value) {
+    uint8_t data[2] = {(uint8_t)(value >> 8), (uint8_t)(value & 0xFF)};
+    nvm_kv_update_chunked(first_key, offset, data, sizeof(data));
+}
+
+static inline uint32_t dynamic_keymap_key_to_offset(uint8_t layer, uint8_t row, uint8_t column) {
+    return (layer * MATRIX_ROWS * MATRIX_COLS * 2) + (row * MATRIX_COLS * 2) + (column * 2);
+}
+
+uint16_t nvm_dynamic_keymap_read_keycode(uint8_t layer, uint8_t row, uint8_t column) {
+    if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || row >= MATRIX_ROWS || column >= MATRIX_COLS) return KC_NO;
+    return dynamic_keymap_read_be16(NVM_KV_KEY_DYNAMIC_KEYMAP, dynamic_keymap_key_to_offset(layer, row, column));
+}
+
+void nvm_dynamic_keymap_update_keycode(uint8_t layer, uint8_t row, uint8_t column, uint16_t keycode) {
+    if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || row >= MATRIX_ROWS || column >= MATRIX_COLS) return;
+    dynamic_keymap_update_be16(NVM_KV_KEY_DYNAMIC_KEYMAP, dynamic_keymap_key_to_offset(layer, row, column), keycode);
+}
+
+#ifdef ENCODER_MAP_ENABLE
+static inline uint32_t dynamic_keymap_encoder_to_offset(uint8_t layer, uint8_t encoder_id, bool clockwise) {
+    return (layer * NUM_ENCODERS * 2 * 2) + (encoder_id * 2 * 2) + (clockwise ? 0 : 2);
+}
+
+uint16_t nvm_dynamic_keymap_read_encoder(uint8_t layer, uint8_t encoder_id, bool clockwise) {
+    if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || encoder_id >= NUM_ENCODERS) return KC_NO;
+    return dynamic_keymap_read_be16(NVM_KV_KEY_DYNAMIC_KEYMAP_ENCODER, dynamic_keymap_encoder_to_offset(layer, encoder_id, clockwise));
+}
+
+void nvm_dynamic_keymap_update_encoder(uint8_t layer, uint8_t encoder_id, bool clockwise, uint16_t keycode) {
+    if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || encoder_id >= NUM_ENCODERS) return;
+    dynamic_keymap_update_be16(NVM_KV_KEY_DYNAMIC_KEYMAP_ENCODER, dynamic_keymap_encoder_to_offset(layer, encoder_id, clockwise), keycode);
+}
+#endif // ENCODER_MAP_ENABLE
+
+void nvm_dynamic_keymap_read_buffer(uint32_t offset, uint32_t size, uint8_t *data) {
+    uint32_t in_range = offset < NVM_KV_DYNAMIC_KEYMAP_SIZE ? MIN(size, NVM_KV_DYNAMIC_KEYMAP_SIZE - offset) : 0;
+    nvm_kv_read_chunked(NVM_KV_KEY_DYNAMIC_KEYMAP, offset, data, in_range);
+    memset(data + in_range, 0, size - in_range);
+}
+
+void nvm_dynamic_keymap_update_buffer(uint32_t offset, uint32_t size, uint8_t *data) {
+    uint32_t in_range = offset < NVM_KV_DYNAMIC_KEYMAP_SIZE ? MIN(size, NVM_KV_DYNAMIC_KEYMAP_SIZE - offset) : 0;
+    nvm_kv_update_chunked(NVM_KV_KEY_DYNAMIC_KEYMAP, offset, data, in_range);
+}
+
+uint32_t nvm_dynamic_keymap_macro_size(void) {
+    return NVM_KV_DYNAMIC_KEYMAP_MACRO_SIZE;
+}
+
+void nvm_dynamic_keymap_macro_read_buffer(uint32_t offset, uint32_t size, uint8_t *data) {
+    uint32_t in_range = offset < NVM_KV_DYNAMIC_KEYMAP_MACRO_SIZE ? MIN(size, NVM_KV_DYNAMIC_KEYMAP_MACRO_SIZE - offset) : 0;
+    nvm_kv_read_chunked(NVM_KV_KEY_DYNAMIC_KEYMAP_MACRO, offset, data, in_range);
+    memset(data + in_range, 0, size - in_range);
+}
+
+void nvm_dynamic_keymap_macro_update_buffer(uint32_t offset, uint32_t size, uint8_t *data) {
+    uint32_t in_range = offset < NVM_KV_DYNAMIC_KEYMAP_MACRO_SIZE ? MIN(size, NVM_KV_DYNAMIC_KEYMAP_MACRO_SIZE - offset) : 0;
+    nvm_kv_update_chunked(NVM_KV_KEY_DYNAMIC_KEYMAP_MACRO, offset, data, in_range);
+}
+
+void nvm_dynamic_keymap_macro_reset(void) {
+    nvm_kv_delete_chunked(NVM_KV_KEY_DYNAMIC_KEYMAP_MACRO, NVM_KV_CHUNKS(NVM_KV_DYNAMIC_KEYMAP_MACRO_SIZE));
+}
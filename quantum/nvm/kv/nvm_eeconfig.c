@@ -0,0 +1,292 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <string.h>
+#include "nvm_eeconfig.h"
+#include "nvm_kv.h"
+#include "nvm_kv_keys.h"
+#include "util.h"
+#include "eeconfig.h"
+#include "debug.h"
+#include "keycode_config.h"
+
+#ifdef AUDIO_ENABLE
+#    include "audio.h"
+#endif
+
+#ifdef BACKLIGHT_ENABLE
+#    include "backlight.h"
+#endif
+
+#ifdef RGBLIGHT_ENABLE
+#    include "rgblight.h"
+#endif
+
+#ifdef RGB_MATRIX_ENABLE
+#    include "rgb_matrix_types.h"
+#endif
+
+#ifdef LED_MATRIX_ENABLE
+#    include "led_matrix_types.h"
+#endif
+
+#ifdef UNICODE_COMMON_ENABLE
+#    include "unicode.h"
+#endif
+
+#ifdef HAPTIC_ENABLE
+#    include "haptic.h"
+#endif
+
+#ifdef CONNECTION_ENABLE
+#    include "connection.h"
+#endif
+
+// Scalars are stored in native byte order, missing values read as zero
+#define KV_SCALAR_ACCESSORS(type, suffix)                           \
+    static inline type kv_read_##suffix(uint16_t key) {             \
+        type val;                                                   \
+        nvm_kv_read(key, 0, &val, sizeof(val));                     \
+        return val;                                                 \
+    }                                                               \
+    static inline void kv_update_##suffix(uint16_t key, type val) { \
+        nvm_kv_update(key, &val, sizeof(val));                      \
+    }
+
+KV_SCALAR_ACCESSORS(uint8_t, byte)
+KV_SCALAR_ACCESSORS(uint16_t, word)
+KV_SCALAR_ACCESSORS(uint32_t, dword)
+KV_SCALAR_ACCESSORS(uint64_t, qword)
+
+void nvm_eeconfig_erase(void) {
+    nvm_kv_erase();
+}
+
+bool nvm_eeconfig_is_enabled(void) {
+    return kv_read_word(NVM_KV_KEY_EECONFIG_MAGIC) == EECONFIG_MAGIC_NUMBER;
+}
+
+bool nvm_eeconfig_is_disabled(void) {
+    return kv_read_word(NVM_KV_KEY_EECONFIG_MAGIC) == EECONFIG_MAGIC_NUMBER_OFF;
+}
+
+void nvm_eeconfig_enable(void) {
+    kv_update_word(NVM_KV_KEY_EECONFIG_MAGIC, EECONFIG_MAGIC_NUMBER);
+}
+
+void nvm_eeconfig_disable(void) {
+    nvm_kv_erase();
+    kv_update_word(NVM_KV_KEY_EECONFIG_MAGIC, EECONFIG_MAGIC_NUMBER_OFF);
+}
+
+void nvm_eeconfig_read_debug(debug_config_t *debug_config) {
+    debug_config->raw = kv_read_byte(NVM_KV_KEY_EECONFIG_DEBUG);
+}
+void nvm_eeconfig_update_debug(const debug_config_t *debug_config) {
+    kv_update_byte(NVM_KV_KEY_EECONFIG_DEBUG, debug_config->raw);
+}
+
+layer_state_t nvm_eeconfig_read_default_layer(void) {
+    uint8_t val = kv_read_byte(NVM_KV_KEY_EECONFIG_DEFAULT_LAYER);
+#ifdef DEFAULT_LAYER_STATE_IS_VALUE_NOT_BITMASK
+    // stored as a layer number, so convert back to bitmask
+    return (layer_state_t)1 << val;
+#else
+    // stored as 8-bit-wide bitmask, so read the value directly - handling padding to 16/32 bit layer_state_t
+    return (layer_state_t)val;
+#endif
+}
+void nvm_eeconfig_update_default_layer(layer_state_t state) {
+#ifdef DEFAULT_LAYER_STATE_IS_VALUE_NOT_BITMASK
+    // stored as a layer number, so only store the highest layer
+    uint8_t val = get_highest_layer(state);
+#else
+    // stored as 8-bit-wide bitmask, so write the value directly - handling truncation from 16/32 bit layer_state_t
+    uint8_t val = (uint8_t)state;
+#endif
+    kv_update_byte(NVM_KV_KEY_EECONFIG_DEFAULT_LAYER, val);
+}
+
+void nvm_eeconfig_read_keymap(keymap_config_t *keymap_config) {
+    keymap_config->raw = kv_read_word(NVM_KV_KEY_EECONFIG_KEYMAP);
+}
+void nvm_eeconfig_update_keymap(const keymap_config_t *keymap_config) {
+    kv_update_word(NVM_KV_KEY_EECONFIG_KEYMAP, keymap_config->raw);
+}
+
+#ifdef AUDIO_ENABLE
+void nvm_eeconfig_read_audio(audio_config_t *audio_config) {
+    audio_config->raw = kv_read_byte(NVM_KV_KEY_EECONFIG_AUDIO);
+}
+void nvm_eeconfig_update_audio(const audio_config_t *audio_config) {
+    kv_update_byte(NVM_KV_KEY_EECONFIG_AUDIO, audio_config->raw);
+}
+#endif // AUDIO_ENABLE
+
+#ifdef UNICODE_COMMON_ENABLE
+void nvm_eeconfig_read_unicode_mode(unicode_config_t *unicode_config) {
+    unicode_config->raw = kv_read_byte(NVM_KV_KEY_EECONFIG_UNICODE);
+}
+void nvm_eeconfig_update_unicode_mode(const unicode_config_t *unicode_config) {
+    kv_update_byte(NVM_KV_KEY_EECONFIG_UNICODE, unicode_config->raw);
+}
+#endif // UNICODE_COMMON_ENABLE
+
+#ifdef BACKLIGHT_ENABLE
+void nvm_eeconfig_read_backlight(backlight_config_t *backlight_config) {
+    backlight_config->raw = kv_read_byte(NVM_KV_KEY_EECONFIG_BACKLIGHT);
+}
+void nvm_eeconfig_update_backlight(const backlight_config_t *backlight_config) {
+    kv_update_byte(NVM_KV_KEY_EECONFIG_BACKLIGHT, backlight_config->raw);
+}
+#endif // BACKLIGHT_ENABLE
+
+#ifdef STENO_ENABLE
+uint8_t nvm_eeconfig_read_steno_mode(void) {
+    return kv_read_byte(NVM_KV_KEY_EECONFIG_STENO);
+}
+void nvm_eeconfig_update_steno_mode(uint8_t val) {
+    kv_update_byte(NVM_KV_KEY_EECONFIG_STENO, val);
+}
+#endif // STENO_ENABLE
+
+#ifdef RGB_MATRIX_ENABLE
+void nvm_eeconfig_read_rgb_matrix(rgb_config_t *rgb_matrix_config) {
+    nvm_kv_read(NVM_KV_KEY_EECONFIG_RGB_MATRIX, 0, rgb_matrix_config, sizeof(rgb_config_t));
+}
+void nvm_eeconfig_update_rgb_matrix(const rgb_config_t *rgb_matrix_config) {
+    nvm_kv_update(NVM_KV_KEY_EECONFIG_RGB_MATRIX, rgb_matrix_config, sizeof(rgb_config_t));
+}
+#endif // RGB_MATRIX_ENABLE
+
+#ifdef LED_MATRIX_ENABLE
+void nvm_eeconfig_read_led_matrix(led_eeconfig_t *led_matrix_config) {
+    nvm_kv_read(NVM_KV_KEY_EECONFIG_LED_MATRIX, 0, led_matrix_config, sizeof(led_eeconfig_t));
+}
+void nvm_eeconfig_update_led_matrix(const led_eeconfig_t *led_matrix_config) {
+    nvm_kv_update(NVM_KV_KEY_EECONFIG_LED_MATRIX, led_matrix_config, sizeof(led_eeconfig_t));
+}
+#endif // LED_MATRIX_ENABLE
+
+#ifdef RGBLIGHT_ENABLE
+void nvm_eeconfig_read_rgblight(rgblight_config_t *rgblight_config) {
+    rgblight_config->raw = kv_read_qword(NVM_KV_KEY_EECONFIG_RGBLIGHT);
+}
+void nvm_eeconfig_update_rgblight(const rgblight_config_t *rgblight_config) {
+    kv_update_qword(NVM_KV_KEY_EECONFIG_RGBLIGHT, rgblight_config->raw);
+}
+#endif // RGBLIGHT_ENABLE
+
+#if (EECONFIG_KB_DATA_SIZE) == 0
+uint32_t nvm_eeconfig_read_kb(void) {
+    return kv_read_dword(NVM_KV_KEY_EECONFIG_KEYBOARD);
+}
+void nvm_eeconfig_update_kb(uint32_t val) {
+    kv_update_dword(NVM_KV_KEY_EECONFIG_KEYBOARD, val);
+}
+#endif // (EECONFIG_KB_DATA_SIZE) == 0
+
+#if (EECONFIG_USER_DATA_SIZE) == 0
+uint32_t nvm_eeconfig_read_user(void) {
+    return kv_read_dword(NVM_KV_KEY_EECONFIG_USER);
+}
+void nvm_eeconfig_update_user(uint32_t val) {
+    kv_update_dword(NVM_KV_KEY_EECONFIG_USER, val);
+}
+#endif // (EECONFIG_USER_DATA_SIZE) == 0
+
+#ifdef HAPTIC_ENABLE
+void nvm_eeconfig_read_haptic(haptic_config_t *haptic_config) {
+    haptic_config->raw = kv_read_dword(NVM_KV_KEY_EECONFIG_HAPTIC);
+}
+void nvm_eeconfig_update_haptic(const haptic_config_t *haptic_config) {
+    kv_update_dword(NVM_KV_KEY_EECONFIG_HAPTIC, haptic_config->raw);
+}
+#endif // HAPTIC_ENABLE
+
+#ifdef CONNECTION_ENABLE
+void nvm_eeconfig_read_connection(connection_config_t *config) {
+    config->raw = kv_read_byte(NVM_KV_KEY_EECONFIG_CONNECTION);
+}
+void nvm_eeconfig_update_connection(const connection_config_t *config) {
+    kv_update_byte(NVM_KV_KEY_EECONFIG_CONNECTION, config->raw);
+}
+#endif // CONNECTION_ENABLE
+
+bool nvm_eeconfig_read_handedness(void) {
+    return !!kv_read_byte(NVM_KV_KEY_EECONFIG_HANDEDNESS);
+}
+void nvm_eeconfig_update_handedness(bool val) {
+    kv_update_byte(NVM_KV_KEY_EECONFIG_HANDEDNESS, !!val);
+}
+
+#if (EECONFIG_KB_DATA_SIZE) > 0
+
+bool nvm_eeconfig_is_kb_datablock_valid(void) {
+    return kv_read_dword(NVM_KV_KEY_EECONFIG_KEYBOARD) == (EECONFIG_KB_DATA_VERSION);
+}
+
+uint32_t nvm_eeconfig_read_kb_datablock(void *data, uint32_t offset, uint32_t length) {
+    if (eeconfig_is_kb_datablock_valid()) {
+        uint32_t end = MIN(EECONFIG_KB_DATA_SIZE, offset + length);
+        if (!nvm_kv_read_chunked(NVM_KV_KEY_EECONFIG_KB_DATABLOCK, offset, data, end - offset)) {
+            return 0;
+        }
+        return end - offset;
+    } else {
+        memset(data, 0, length);
+        return length;
+    }
+}
+
+uint32_t nvm_eeconfig_update_kb_datablock(const void *data, uint32_t offset, uint32_t length) {
+    kv_update_dword(NVM_KV_KEY_EECONFIG_KEYBOARD, (EECONFIG_KB_DATA_VERSION));
+
+    uint32_t end = MIN(EECONFIG_KB_DATA_SIZE, offset + length);
+    if (!nvm_kv_update_chunked(NVM_KV_KEY_EECONFIG_KB_DATABLOCK, offset, data, end - offset)) {
+        return 0;
+    }
+    return end - offset;
+}
+
+void nvm_eeconfig_init_kb_datablock(void) {
+    kv_update_dword(NVM_KV_KEY_EECONFIG_KEYBOARD, (EECONFIG_KB_DATA_VERSION));
+    nvm_kv_delete_chunked(NVM_KV_KEY_EECONFIG_KB_DATABLOCK, NVM_KV_CHUNKS(EECONFIG_KB_DATA_SIZE));
+}
+
+#endif // (EECONFIG_KB_DATA_SIZE) > 0
+
+#if (EECONFIG_USER_DATA_SIZE) > 0
+
+bool nvm_eeconfig_is_user_datablock_valid(void) {
+    return kv_read_dword(NVM_KV_KEY_EECONFIG_USER) == (EECONFIG_USER_DATA_VERSION);
+}
+
+uint32_t nvm_eeconfig_read_user_datablock(void *data, uint32_t offset, uint32_t length) {
+    if (eeconfig_is_user_datablock_valid()) {
+        uint32_t end = MIN(EECONFIG_USER_DATA_SIZE, offset + length);
+        if (!nvm_kv_read_chunked(NVM_KV_KEY_EECONFIG_USER_DATABLOCK, offset, data, end - offset)) {
+            return 0;
+        }
+        return end - offset;
+    } else {
+        memset(data, 0, length);
+        return length;
+    }
+}
+
+uint32_t nvm_eeconfig_update_user_datablock(const void *data, uint32_t offset, uint32_t length) {
+    kv_update_dword(NVM_KV_KEY_EECONFIG_USER, (EECONFIG_USER_DATA_VERSION));
+
+    uint32_t end = MIN(EECONFIG_USER_DATA_SIZE, offset + length);
+    if (!nvm_kv_update_chunked(NVM_KV_KEY_EECONFIG_USER_DATABLOCK, offset, data, end - offset)) {
+        return 0;
+    }
+    return end - offset;
+}
+
+void nvm_eeconfig_init_user_datablock(void) {
+    kv_update_dword(NVM_KV_KEY_EECONFIG_USER, (EECONFIG_USER_DATA_VERSION));
+    nvm_kv_delete_chunked(NVM_KV_KEY_EECONFIG_USER_DATABLOCK, NVM_KV_CHUNKS(EECONFIG_USER_DATA_SIZE));
+}
+
+#endif // (EECONFIG_USER_DATA_SIZE) > 0
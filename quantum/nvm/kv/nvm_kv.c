@@ -0,0 +1,439 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+#include "fnv.h"
+#include "util.h"
+#include "nvm_kv.h"
+#include "wear_leveling_internal.h"
+#ifndef NVM_KV_KEY_COUNT
+#    include "nvm_kv_keys.h"
+#endif // NVM_KV_KEY_COUNT
+
+#define NVM_KV_BANK_MAGIC 0x4B42564B // "KVBK"
+#define NVM_KV_HEADER_SIZE 8
+
+// Number of bytes transferred to/from the backing store at a time
+#ifndef NVM_KV_BUFFER_SIZE
+#    define NVM_KV_BUFFER_SIZE 32
+#endif // NVM_KV_BUFFER_SIZE
+
+STATIC_ASSERT(NVM_KV_BUFFER_SIZE % BACKING_STORE_WRITE_SIZE == 0, "kv buffer size must be a multiple of write size");
+STATIC_ASSERT(NVM_KV_CHUNK_SIZE > 0 && NVM_KV_CHUNK_SIZE <= UINT16_MAX, "kv chunk size must fit a single record");
+STATIC_ASSERT(NVM_KV_KEY_COUNT <= UINT16_MAX, "Too many kv keys");
+STATIC_ASSERT((WEAR_LEVELING_BANK_SIZE) / (BACKING_STORE_WRITE_SIZE) <= UINT16_MAX, "kv bank size is too large to be indexed");
+STATIC_ASSERT((WEAR_LEVELING_BANK_SIZE) % (BACKING_STORE_WRITE_SIZE) == 0, "kv bank size must be a multiple of write size");
+
+/**
+ * Helper type used to contain a record header, or a bank header.
+ */
+typedef union nvm_kv_header_t {
+    struct {
+        uint16_t key;
+        uint16_t length;
+        uint32_t hash;
+    };
+    uint32_t            raw32[2];
+    uint8_t             raw8[NVM_KV_HEADER_SIZE];
+    backing_store_int_t units[NVM_KV_HEADER_SIZE / BACKING_STORE_WRITE_SIZE];
+} nvm_kv_header_t;
+
+STATIC_ASSERT(sizeof(nvm_kv_header_t) == NVM_KV_HEADER_SIZE, "kv header size was not 8");
+
+static struct {
+    bool     initialised;
+    bool     needs_compaction;                // Set when the log ends with something other than a valid record
+    uint8_t  bank;                            // The active bank
+    uint32_t sequence;                        // Sequence number of the active bank
+    uint32_t write_address;                   // Offset of the next record within the active bank
+    uint16_t index[NVM_KV_KEY_COUNT];         // Offset of the latest record for each key within the active bank, in write units -- zero if not present
+} kv;
+
+static inline uint32_t kv_bank_base(uint8_t bank) {
+    return ((uint32_t)bank) * (WEAR_LEVELING_BANK_SIZE);
+}
+
+static inline uint32_t kv_record_size(uint16_t length) {
+    return NVM_KV_HEADER_SIZE + ((((uint32_t)length) + (BACKING_STORE_WRITE_SIZE) - 1) / (BACKING_STORE_WRITE_SIZE)) * (BACKING_STORE_WRITE_SIZE);
+}
+
+static inline uint32_t kv_record_address(uint16_t key) {
+    return kv_bank_base(kv.bank) + ((uint32_t)kv.index[key]) * (BACKING_STORE_WRITE_SIZE);
+}
+
+/**
+ * Reads bytes from the backing store, starting at any offset.
+ */
+static bool kv_read_bytes(uint32_t address, void *data, uint32_t length) {
+    backing_store_int_t values[NVM_KV_BUFFER_SIZE / BACKING_STORE_WRITE_SIZE];
+    uint8_t            *p = (uint8_t *)data;
+    while (length > 0) {
+        uint32_t skip  = address % (BACKING_STORE_WRITE_SIZE);
+        uint32_t count = MIN((skip + length + (BACKING_STORE_WRITE_SIZE) - 1) / (BACKING_STORE_WRITE_SIZE), ARRAY_SIZE(values));
+        if (!backing_store_read_bulk(address - skip, values, count)) {
+            return false;
+        }
+        uint32_t n = MIN(count * (BACKING_STORE_WRITE_SIZE) - skip, length);
+        memcpy(p, ((uint8_t *)values) + skip, n);
+        p += n;
+        address += n;
+        length -= n;
+    }
+    return true;
+}
+
+/**
+ * Writes bytes to the backing store, starting at an aligned offset. The last write unit is padded with zero.
+ */
+static bool kv_write_bytes(uint32_t address, const void *data, uint32_t length) {
+    backing_store_int_t values[NVM_KV_BUFFER_SIZE / BACKING_STORE_WRITE_SIZE];
+    const uint8_t      *p = (const uint8_t *)data;
+    while (length > 0) {
+        uint32_t n     = MIN(length, sizeof(values));
+        uint32_t count = (n + (BACKING_STORE_WRITE_SIZE) - 1) / (BACKING_STORE_WRITE_SIZE);
+        memset(values, 0, sizeof(values));
+        memcpy(values, p, n);
+        if (!backing_store_write_bulk(address, values, count)) {
+            return false;
+        }
+        p += n;
+        address += count * (BACKING_STORE_WRITE_SIZE);
+        length -= n;
+    }
+    return true;
+}
+
+static inline bool kv_read_header(uint32_t address, nvm_kv_header_t *header) {
+    return backing_store_read_bulk(address, header->units, ARRAY_SIZE(header->units));
+}
+
+static inline uint32_t kv_hash_header(const nvm_kv_header_t *header) {
+    return fnv_32a_buf((void *)header->raw8, offsetof(nvm_kv_header_t, hash), FNV1_32A_INIT);
+}
+
+/**
+ * Verifies the hash of the record at the supplied address against its data.
+ */
+static bool kv_record_is_valid(uint32_t address, const nvm_kv_header_t *header) {
+    uint8_t  buffer[NVM_KV_BUFFER_SIZE];
+    uint32_t hash      = kv_hash_header(header);
+    uint32_t remaining = header->length;
+    address += NVM_KV_HEADER_SIZE;
+    while (remaining > 0) {
+        uint32_t n = MIN(remaining, sizeof(buffer));
+        if (!kv_read_bytes(address, buffer, n)) {
+            return false;
+        }
+        hash = fnv_32a_buf(buffer, n, hash);
+        address += n;
+        remaining -= n;
+    }
+    return hash == header->hash;
+}
+
+/**
+ * Rebuilds the index from the records in the active bank.
+ */
+static void kv_scan(void) {
+    memset(kv.index, 0, sizeof(kv.index));
+    kv.needs_compaction = false;
+
+    uint32_t base    = kv_bank_base(kv.bank);
+    uint32_t address = NVM_KV_HEADER_SIZE;
+    while (address + NVM_KV_HEADER_SIZE <= (WEAR_LEVELING_BANK_SIZE)) {
+        nvm_kv_header_t header;
+        if (!kv_read_header(base + address, &header)) {
+            kv.needs_compaction = true;
+            break;
+        }
+
+        // An empty header marks the end of the log
+        if (header.raw32[0] == 0 && header.raw32[1] == 0) {
+            break;
+        }
+
+        // Anything else which isn't a valid record is the remains of an interrupted write
+        uint32_t size = kv_record_size(header.length);
+        if (header.key == 0 || address + size > (WEAR_LEVELING_BANK_SIZE) || !kv_record_is_valid(base + address, &header)) {
+            kv.needs_compaction = true;
+            break;
+        }
+
+        // Skip over keys which this firmware doesn't know about, they're dropped on the next compaction
+        if (header.key < NVM_KV_KEY_COUNT) {
+            kv.index[header.key] = header.length > 0 ? address / (BACKING_STORE_WRITE_SIZE) : 0;
+        }
+        address += size;
+    }
+
+    kv.write_address = address;
+}
+
+/**
+ * Copies the latest record for each key into the standby bank, then makes it the active bank.
+ */
+static bool kv_compact(void) {
+    uint8_t  target  = kv.bank ^ 1;
+    uint32_t base    = kv_bank_base(target);
+    uint32_t address = NVM_KV_HEADER_SIZE;
+
+    if (!backing_store_unlock()) {
+        return false;
+    }
+
+    bool ok = backing_store_erase_range(base, (WEAR_LEVELING_BANK_SIZE));
+    for (uint16_t key = 1; ok && key < NVM_KV_KEY_COUNT; ++key) {
+        if (kv.index[key] == 0) {
+            continue;
+        }
+
+        backing_store_int_t values[NVM_KV_BUFFER_SIZE / BACKING_STORE_WRITE_SIZE];
+        nvm_kv_header_t     header;
+        uint32_t            source = kv_record_address(key);
+        if (!kv_read_header(source, &header)) {
+            ok = false;
+            break;
+        }
+
+        uint32_t size = kv_record_size(header.length);
+        for (uint32_t copied = 0; ok && copied < size; copied += sizeof(values)) {
+            uint32_t count = MIN(size - copied, sizeof(values)) / (BACKING_STORE_WRITE_SIZE);
+            ok             = backing_store_read_bulk(source + copied, values, count) && backing_store_write_bulk(base + address + copied, values, count);
+        }
+
+        kv.index[key] = address / (BACKING_STORE_WRITE_SIZE);
+        address += size;
+    }
+
+    // The bank header goes last, so the standby bank is only recognised once it's complete
+    if (ok) {
+        nvm_kv_header_t header = {.raw32 = {NVM_KV_BANK_MAGIC, kv.sequence + 1}};
+        ok                     = kv_write_bytes(base, &header, sizeof(header));
+    }
+
+    backing_store_lock();
+
+    if (ok) {
+        kv.bank             = target;
+        kv.sequence         = kv.sequence + 1;
+        kv.write_address    = address;
+        kv.needs_compaction = false;
+    } else {
+        // The index was partially moved over to the standby bank, restore it from the active bank
+        kv_scan();
+    }
+    return ok;
+}
+
+static bool kv_read_bank_header(uint8_t bank, uint32_t *sequence) {
+    nvm_kv_header_t header;
+    if (!kv_read_header(kv_bank_base(bank), &header) || header.raw32[0] != NVM_KV_BANK_MAGIC) {
+        return false;
+    }
+    *sequence = header.raw32[1];
+    return true;
+}
+
+static bool kv_init(void) {
+    if (kv.initialised) {
+        return true;
+    }
+    if (!backing_store_init()) {
+        return false;
+    }
+    kv.initialised = true;
+
+    uint32_t sequence0 = 0, sequence1 = 0;
+    bool     valid0 = kv_read_bank_header(0, &sequence0);
+    bool     valid1 = kv_read_bank_header(1, &sequence1);
+    if (valid0 || valid1) {
+        // Use the newest bank, allowing for the sequence number wrapping around
+        kv.bank     = (valid1 && (!valid0 || (int32_t)(sequence1 - sequence0) > 0)) ? 1 : 0;
+        kv.sequence = kv.bank ? sequence1 : sequence0;
+        kv_scan();
+        return true;
+    }
+
+    // Nothing recognisable, start out with an empty bank 0
+    memset(kv.index, 0, sizeof(kv.index));
+    kv.bank     = 1;
+    kv.sequence = 0;
+    if (!kv_compact()) {
+        kv.initialised = false;
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Checks whether the latest record for a key already holds the supplied data.
+ */
+static bool kv_matches(uint16_t key, const uint8_t *data, uint16_t length) {
+    if (kv.index[key] == 0) {
+        return length == 0;
+    }
+
+    nvm_kv_header_t header;
+    uint32_t        address = kv_record_address(key);
+    if (!kv_read_header(address, &header) || header.length != length) {
+        return false;
+    }
+
+    uint8_t buffer[NVM_KV_BUFFER_SIZE];
+    address += NVM_KV_HEADER_SIZE;
+    for (uint32_t i = 0; i < length; i += sizeof(buffer)) {
+        uint32_t n = MIN(length - i, sizeof(buffer));
+        if (!kv_read_bytes(address + i, buffer, n) || memcmp(buffer, &data[i], n) != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool kv_append(uint16_t key, const uint8_t *data, uint16_t length) {
+    uint32_t size = kv_record_size(length);
+    if (kv.needs_compaction || kv.write_address + size > (WEAR_LEVELING_BANK_SIZE)) {
+        if (!kv_compact() || kv.write_address + size > (WEAR_LEVELING_BANK_SIZE)) {
+            return false;
+        }
+    }
+
+    nvm_kv_header_t header = {.key = key, .length = length};
+    header.hash            = fnv_32a_buf((void *)data, length, kv_hash_header(&header));
+
+    uint32_t address = kv_bank_base(kv.bank) + kv.write_address;
+    if (!backing_store_unlock()) {
+        return false;
+    }
+    bool ok = kv_write_bytes(address, &header, sizeof(header)) && kv_write_bytes(address + NVM_KV_HEADER_SIZE, data, length);
+    backing_store_lock();
+
+    if (!ok) {
+        // Whatever made it into the backing store can't be appended to, so start afresh on the next write
+        kv.needs_compaction = true;
+        return false;
+    }
+
+    kv.index[key] = length > 0 ? kv.write_address / (BACKING_STORE_WRITE_SIZE) : 0;
+    kv.write_address += size;
+    return true;
+}
+
+/**
+ * Reads part of a value, filling any bytes which aren't present in the store with zero.
+ *
+ * Returns false if the backing store couldn't be read, as distinct from the key not being present.
+ */
+static bool kv_read_value(uint16_t key, uint16_t offset, void *data, uint16_t length, bool *present) {
+    memset(data, 0, length);
+    *present = false;
+    if (!kv_init()) {
+        return false;
+    }
+    if (key == 0 || key >= NVM_KV_KEY_COUNT || kv.index[key] == 0) {
+        return true;
+    }
+
+    nvm_kv_header_t header;
+    uint32_t        address = kv_record_address(key);
+    if (!kv_read_header(address, &header)) {
+        return false;
+    }
+    if (offset < header.length && !kv_read_bytes(address + NVM_KV_HEADER_SIZE + offset, data, MIN(length, header.length - offset))) {
+        // Don't hand back a partially-read value
+        memset(data, 0, length);
+        return false;
+    }
+    *present = true;
+    return true;
+}
+
+bool nvm_kv_read(uint16_t key, uint16_t offset, void *data, uint16_t length) {
+    bool present;
+    return kv_read_value(key, offset, data, length, &present) && present;
+}
+
+bool nvm_kv_update(uint16_t key, const void *data, uint16_t length) {
+    const uint8_t *p = (const uint8_t *)data;
+    while (length > 0 && p[length - 1] == 0) {
+        --length;
+    }
+
+    if (!kv_init() || key == 0 || key >= NVM_KV_KEY_COUNT) {
+        return false;
+    }
+    if (kv_matches(key, p, length)) {
+        return true;
+    }
+    return kv_append(key, p, length);
+}
+
+bool nvm_kv_delete(uint16_t key) {
+    return nvm_kv_update(key, NULL, 0);
+}
+
+bool nvm_kv_erase(void) {
+    if (!kv_init()) {
+        return false;
+    }
+    memset(kv.index, 0, sizeof(kv.index));
+    return kv_compact();
+}
+
+bool nvm_kv_read_chunked(uint16_t first_key, uint32_t offset, void *data, uint32_t length) {
+    uint8_t *p  = (uint8_t *)data;
+    bool     ok = true;
+    while (length > 0) {
+        bool     present;
+        uint32_t chunk_offset = offset % (NVM_KV_CHUNK_SIZE);
+        uint32_t n            = MIN(length, (NVM_KV_CHUNK_SIZE) - chunk_offset);
+        ok &= kv_read_value(first_key + (offset / (NVM_KV_CHUNK_SIZE)), chunk_offset, p, n, &present);
+        p += n;
+        offset += n;
+        length -= n;
+    }
+    return ok;
+}
+
+bool nvm_kv_update_chunked(uint16_t first_key, uint32_t offset, const void *data, uint32_t length) {
+    const uint8_t *p = (const uint8_t *)data;
+    while (length > 0) {
+        bool     present;
+        uint8_t  chunk[NVM_KV_CHUNK_SIZE];
+        uint16_t key          = first_key + (offset / (NVM_KV_CHUNK_SIZE));
+        uint32_t chunk_offset = offset % (NVM_KV_CHUNK_SIZE);
+        uint32_t n            = MIN(length, (NVM_KV_CHUNK_SIZE) - chunk_offset);
+        // Rewriting a chunk which couldn't be read would lose the bytes outside the supplied range
+        if (n < (NVM_KV_CHUNK_SIZE) && !kv_read_value(key, 0, chunk, sizeof(chunk), &present)) {
+            return false;
+        }
+        memcpy(&chunk[chunk_offset], p, n);
+        if (!nvm_kv_update(key, chunk, sizeof(chunk))) {
+            return false;
+        }
+        p += n;
+        offset += n;
+        length -= n;
+    }
+    return true;
+}
+
+bool nvm_kv_delete_chunked(uint16_t first_key, uint16_t key_count) {
+    for (uint16_t i = 0; i < key_count; ++i) {
+        if (!nvm_kv_delete(first_key + i)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+#ifdef NVM_KV_TESTS
+void nvm_kv_deinit(void) {
+    kv.initialised = false;
+}
+
+uint32_t nvm_kv_used_bytes(void) {
+    return kv_init() ? kv.write_address : 0;
+}
+#endif // NVM_KV_TESTS
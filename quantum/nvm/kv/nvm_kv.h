@@ -0,0 +1,98 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+    Log-structured key-value store, used by the `kv` NVM provider.
+
+    Values are appended to the backing store as records, each consisting of
+    an 8-byte header -- key, length, and FNV1a_32 of the key, length and data
+    -- followed by the data, padded to the backing store write size. Later
+    records for the same key supersede earlier ones, and a zero-length record
+    deletes the key. A RAM index of the latest record for each key is built
+    at boot, so lookups don't need to scan the log.
+
+    Trailing zero bytes are never stored, and any missing bytes read back as
+    zero, so values only use as much of the backing store as they need.
+
+    The backing store is split into two banks, each beginning with an 8-byte
+    header -- magic and sequence number. When the active bank fills up, the
+    latest record for each key is copied into the standby bank, and only then
+    is its header written, so a loss of power part way through leaves the
+    previous bank intact.
+*/
+
+// Size in bytes of each chunk of large values, such as the dynamic keymap and macros
+#ifndef NVM_KV_CHUNK_SIZE
+#    define NVM_KV_CHUNK_SIZE 32
+#endif // NVM_KV_CHUNK_SIZE
+
+// Number of keys needed to store a value of the supplied size, when split into chunks
+#define NVM_KV_CHUNKS(size) (((size) + (NVM_KV_CHUNK_SIZE) - 1) / (NVM_KV_CHUNK_SIZE))
+
+/**
+ * \brief Read a value, or part of one.
+ *
+ * Any bytes which aren't present in the store, or couldn't be read, are filled with zero.
+ *
+ * \return true if the value was present in the store, and could be read
+ */
+bool nvm_kv_read(uint16_t key, uint16_t offset, void *data, uint16_t length);
+
+/**
+ * \brief Replace a value, trailing zero bytes are trimmed before storing.
+ *
+ * Nothing is written if the stored value is unchanged.
+ *
+ * \return true if the value was stored
+ */
+bool nvm_kv_update(uint16_t key, const void *data, uint16_t length);
+
+/**
+ * \brief Remove a value, so that it reads back as zero.
+ */
+bool nvm_kv_delete(uint16_t key);
+
+/**
+ * \brief Remove all values.
+ */
+bool nvm_kv_erase(void);
+
+/**
+ * \brief Read part of a value which is split across a range of keys, each holding NVM_KV_CHUNK_SIZE bytes.
+ *
+ * \return false if the backing store couldn't be read, missing chunks read as zero and aren't a failure
+ */
+bool nvm_kv_read_chunked(uint16_t first_key, uint32_t offset, void *data, uint32_t length);
+
+/**
+ * \brief Update part of a value which is split across a range of keys, each holding NVM_KV_CHUNK_SIZE bytes.
+ *
+ * Only the chunks overlapping the supplied range are rewritten, and only if they changed. Stops at the first chunk
+ * which couldn't be read or stored.
+ *
+ * \return true if every chunk was stored
+ */
+bool nvm_kv_update_chunked(uint16_t first_key, uint32_t offset, const void *data, uint32_t length);
+
+/**
+ * \brief Remove a value which is split across a range of keys.
+ *
+ * \return true if every chunk was removed
+ */
+bool nvm_kv_delete_chunked(uint16_t first_key, uint16_t key_count);
+
+#ifdef NVM_KV_TESTS
+/**
+ * \brief Forget all state, so that the next access rebuilds it from the backing store.
+ */
+void nvm_kv_deinit(void);
+
+/**
+ * \brief Number of bytes of the active bank used by records.
+ */
+uint32_t nvm_kv_used_bytes(void);
+#endif // NVM_KV_TESTS
@@ -0,0 +1,74 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include "eeconfig.h"
+#include "nvm_kv.h"
+
+#ifdef VIA_ENABLE
+#    include "via.h"
+#    define NVM_KV_VIA_CUSTOM_CONFIG_SIZE (VIA_EEPROM_CUSTOM_CONFIG_SIZE)
+#else
+#    define NVM_KV_VIA_CUSTOM_CONFIG_SIZE 0
+#endif // VIA_ENABLE
+
+#ifdef DYNAMIC_KEYMAP_ENABLE
+#    include "dynamic_keymap.h"
+#    define NVM_KV_DYNAMIC_KEYMAP_SIZE ((DYNAMIC_KEYMAP_LAYER_COUNT) * (MATRIX_ROWS) * (MATRIX_COLS) * 2)
+// Macros only take up as much of the store as they actually use, so the limit can be generous
+#    ifndef DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE
+#        define DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE 1024
+#    endif // DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE
+#    define NVM_KV_DYNAMIC_KEYMAP_MACRO_SIZE (DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE)
+#    ifdef ENCODER_MAP_ENABLE
+#        include "encoder.h"
+#        define NVM_KV_DYNAMIC_KEYMAP_ENCODER_SIZE ((DYNAMIC_KEYMAP_LAYER_COUNT) * (NUM_ENCODERS) * 2 * 2)
+#    else
+#        define NVM_KV_DYNAMIC_KEYMAP_ENCODER_SIZE 0
+#    endif // ENCODER_MAP_ENABLE
+#else
+#    define NVM_KV_DYNAMIC_KEYMAP_SIZE 0
+#    define NVM_KV_DYNAMIC_KEYMAP_MACRO_SIZE 0
+#    define NVM_KV_DYNAMIC_KEYMAP_ENCODER_SIZE 0
+#endif // DYNAMIC_KEYMAP_ENABLE
+
+/**
+ * Keys for each stored value. Large values are split into ranges of keys, one per NVM_KV_CHUNK_SIZE bytes.
+ *
+ * As with the offsets used by the eeprom provider, resizing a range moves every key after it, so new keys should be
+ * appended to the end of their section.
+ */
+enum {
+    NVM_KV_KEY_INVALID = 0, // Zero is reserved, an empty record header marks the end of the log
+
+    // eeconfig
+    NVM_KV_KEY_EECONFIG_MAGIC,
+    NVM_KV_KEY_EECONFIG_DEBUG,
+    NVM_KV_KEY_EECONFIG_DEFAULT_LAYER,
+    NVM_KV_KEY_EECONFIG_KEYMAP,
+    NVM_KV_KEY_EECONFIG_BACKLIGHT,
+    NVM_KV_KEY_EECONFIG_AUDIO,
+    NVM_KV_KEY_EECONFIG_RGBLIGHT,
+    NVM_KV_KEY_EECONFIG_UNICODE,
+    NVM_KV_KEY_EECONFIG_STENO,
+    NVM_KV_KEY_EECONFIG_HANDEDNESS,
+    NVM_KV_KEY_EECONFIG_KEYBOARD,
+    NVM_KV_KEY_EECONFIG_USER,
+    NVM_KV_KEY_EECONFIG_LED_MATRIX,
+    NVM_KV_KEY_EECONFIG_RGB_MATRIX,
+    NVM_KV_KEY_EECONFIG_HAPTIC,
+    NVM_KV_KEY_EECONFIG_CONNECTION,
+
+    // via
+    NVM_KV_KEY_VIA_MAGIC,
+    NVM_KV_KEY_VIA_LAYOUT_OPTIONS,
+
+    // Chunked ranges
+    NVM_KV_KEY_EECONFIG_KB_DATABLOCK,
+    NVM_KV_KEY_EECONFIG_USER_DATABLOCK   = NVM_KV_KEY_EECONFIG_KB_DATABLOCK + NVM_KV_CHUNKS(EECONFIG_KB_DATA_SIZE),
+    NVM_KV_KEY_VIA_CUSTOM_CONFIG         = NVM_KV_KEY_EECONFIG_USER_DATABLOCK + NVM_KV_CHUNKS(EECONFIG_USER_DATA_SIZE),
+    NVM_KV_KEY_DYNAMIC_KEYMAP            = NVM_KV_KEY_VIA_CUSTOM_CONFIG + NVM_KV_CHUNKS(NVM_KV_VIA_CUSTOM_CONFIG_SIZE),
+    NVM_KV_KEY_DYNAMIC_KEYMAP_ENCODER    = NVM_KV_KEY_DYNAMIC_KEYMAP + NVM_KV_CHUNKS(NVM_KV_DYNAMIC_KEYMAP_SIZE),
+    NVM_KV_KEY_DYNAMIC_KEYMAP_MACRO      = NVM_KV_KEY_DYNAMIC_KEYMAP_ENCODER + NVM_KV_CHUNKS(NVM_KV_DYNAMIC_KEYMAP_ENCODER_SIZE),
+    NVM_KV_KEY_COUNT                     = NVM_KV_KEY_DYNAMIC_KEYMAP_MACRO + NVM_KV_CHUNKS(NVM_KV_DYNAMIC_KEYMAP_MACRO_SIZE),
+};
@@ -0,0 +1,72 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "util.h"
+#include "via.h"
+#include "nvm_via.h"
+#include "nvm_kv.h"
+#include "nvm_kv_keys.h"
+
+void nvm_via_erase(void) {
+    // No-op, nvm_eeconfig_erase() will have already removed all values if necessary.
+}
+
+void nvm_via_read_magic(uint8_t *magic0, uint8_t *magic1, uint8_t *magic2) {
+    uint8_t magic[3];
+    nvm_kv_read(NVM_KV_KEY_VIA_MAGIC, 0, magic, sizeof(magic));
+
+    if (magic0) {
+        *magic0 = magic[0];
+    }
+
+    if (magic1) {
+        *magic1 = magic[1];
+    }
+
+    if (magic2) {
+        *magic2 = magic[2];
+    }
+}
+
+void nvm_via_update_magic(uint8_t magic0, uint8_t magic1, uint8_t magic2) {
+    uint8_t magic[3] = {magic0, magic1, magic2};
+    nvm_kv_update(NVM_KV_KEY_VIA_MAGIC, magic, sizeof(magic));
+}
+
+uint32_t nvm_via_read_layout_options(void) {
+    uint32_t value = 0;
+    nvm_kv_read(NVM_KV_KEY_VIA_LAYOUT_OPTIONS, 0, &value, sizeof(value));
+    return value;
+}
+
+void nvm_via_update_layout_options(uint32_t val) {
+    // Only keep as many bytes as the eeprom provider would
+    if (VIA_EEPROM_LAYOUT_OPTIONS_SIZE < sizeof(val)) {
+        val &= (1UL << (VIA_EEPROM_LAYOUT_OPTIONS_SIZE * 8)) - 1;
+    }
+    nvm_kv_update(NVM_KV_KEY_VIA_LAYOUT_OPTIONS, &val, sizeof(val));
+}
+
+uint32_t nvm_via_read_custom_config(void *buf, uint32_t offset, uint32_t length) {
+#if VIA_EEPROM_CUSTOM_CONFIG_SIZE > 0
+    uint32_t end = MIN(VIA_EEPROM_CUSTOM_CONFIG_SIZE, offset + length);
+    if (!nvm_kv_read_chunked(NVM_KV_KEY_VIA_CUSTOM_CONFIG, offset, buf, end - offset)) {
+        return 0;
+    }
+    return end - offset;
+#else
+    return 0;
+#endif
+}
+
+uint32_t nvm_via_update_custom_config(const void *buf, uint32_t offset, uint32_t length) {
+#if VIA_EEPROM_CUSTOM_CONFIG_SIZE > 0
+    uint32_t end = MIN(VIA_EEPROM_CUSTOM_CONFIG_SIZE, offset + length);
+    if (!nvm_kv_update_chunked(NVM_KV_KEY_VIA_CUSTOM_CONFIG, offset, buf, end - offset)) {
+        return 0;
+    }
+    return end - offset;
+#else
+    return 0;
+#endif
+}
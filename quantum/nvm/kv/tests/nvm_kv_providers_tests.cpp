@@ -0,0 +1,175 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <cstring>
+#include <vector>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "backing_mocks.hpp"
+
+extern "C" {
+#include "keycodes.h"
+#include "debug.h"
+#include "keycode_config.h"
+#include "nvm_eeconfig.h"
+#include "nvm_via.h"
+#include "nvm_dynamic_keymap.h"
+#include "nvm_kv.h"
+#include "nvm_kv_keys.h"
+
+// Normally provided by eeconfig.c, which routes through the NVM provider
+bool eeconfig_is_kb_datablock_valid(void) {
+    return nvm_eeconfig_is_kb_datablock_valid();
+}
+};
+
+class NvmKvProviders : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        MockBackingStore::Instance().reset_instance();
+        nvm_kv_deinit();
+    }
+
+    // Forget all state, as though the keyboard had been restarted
+    static void reboot() {
+        nvm_kv_deinit();
+    }
+
+    static void fail_writes() {
+        MockBackingStore::Instance().set_write_callback([](std::uint64_t, std::uint32_t) { return false; });
+    }
+
+    static void fail_reads() {
+        MockBackingStore::Instance().set_read_callback([](std::uint32_t) { return false; });
+    }
+};
+
+using bytes_t = std::vector<std::uint8_t>;
+
+/**
+ * This test verifies that eeconfig values are kept across a reboot, and that disabling eeconfig removes them.
+ */
+TEST_F(NvmKvProviders, Eeconfig_ValuesPersist) {
+    EXPECT_FALSE(nvm_eeconfig_is_enabled()) << "Fresh store should not have been enabled";
+    nvm_eeconfig_enable();
+
+    debug_config_t  debug  = {.raw = 0x05};
+    keymap_config_t keymap = {.raw = 0x1234};
+    nvm_eeconfig_update_debug(&debug);
+    nvm_eeconfig_update_keymap(&keymap);
+    nvm_eeconfig_update_default_layer(1 << 2);
+    nvm_eeconfig_update_handedness(true);
+
+    reboot();
+    debug_config_t  debug_read  = {};
+    keymap_config_t keymap_read = {};
+    nvm_eeconfig_read_debug(&debug_read);
+    nvm_eeconfig_read_keymap(&keymap_read);
+    EXPECT_TRUE(nvm_eeconfig_is_enabled()) << "Magic was lost after reboot";
+    EXPECT_EQ(debug_read.raw, debug.raw) << "Debug config did not match after reboot";
+    EXPECT_EQ(keymap_read.raw, keymap.raw) << "Keymap config did not match after reboot";
+    EXPECT_EQ(nvm_eeconfig_read_default_layer(), 1 << 2) << "Default layer did not match after reboot";
+    EXPECT_TRUE(nvm_eeconfig_read_handedness()) << "Handedness did not match after reboot";
+
+    nvm_eeconfig_disable();
+    EXPECT_TRUE(nvm_eeconfig_is_disabled()) << "Disable was not stored";
+    nvm_eeconfig_read_keymap(&keymap_read);
+    EXPECT_EQ(keymap_read.raw, 0) << "Disable should have removed all values";
+}
+
+/**
+ * This test verifies that the keyboard datablock can be updated in part, across chunks, and that failures to store
+ * it are reported.
+ */
+TEST_F(NvmKvProviders, KbDatablock_PartialUpdates) {
+    EXPECT_FALSE(nvm_eeconfig_is_kb_datablock_valid()) << "Fresh store should not have a valid datablock";
+
+    bytes_t data = {0x11, 0x22, 0x33, 0x44, 0x55, 0x66};
+    EXPECT_EQ(nvm_eeconfig_update_kb_datablock(data.data(), 5, data.size()), data.size()) << "Update failed";
+
+    reboot();
+    EXPECT_TRUE(nvm_eeconfig_is_kb_datablock_valid()) << "Datablock version was lost after reboot";
+    bytes_t readback(EECONFIG_KB_DATA_SIZE);
+    EXPECT_EQ(nvm_eeconfig_read_kb_datablock(readback.data(), 0, readback.size()), readback.size()) << "Read failed";
+    EXPECT_EQ(readback, (bytes_t{0, 0, 0, 0, 0, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0})) << "Readback did not match after reboot";
+
+    fail_writes();
+    bytes_t next = {0x77};
+    EXPECT_EQ(nvm_eeconfig_update_kb_datablock(next.data(), 0, next.size()), 0) << "Failed update was not reported";
+
+    // An unreadable version also makes the datablock invalid, so it reads as zero rather than failing
+    fail_reads();
+    nvm_eeconfig_read_kb_datablock(readback.data(), 0, readback.size());
+    EXPECT_EQ(readback, bytes_t(EECONFIG_KB_DATA_SIZE, 0)) << "Failed read should have been filled with zero";
+}
+
+/**
+ * This test verifies that VIA values are kept across a reboot, and that failures to store or read the custom config
+ * are reported.
+ */
+TEST_F(NvmKvProviders, Via_ValuesPersist) {
+    nvm_via_update_magic(0xAB, 0xCD, 0xEF);
+    nvm_via_update_layout_options(0x1234);
+
+    bytes_t config = {0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A};
+    EXPECT_EQ(nvm_via_update_custom_config(config.data(), 2, config.size()), config.size()) << "Update failed";
+
+    reboot();
+    uint8_t magic[3] = {};
+    nvm_via_read_magic(&magic[0], &magic[1], &magic[2]);
+    EXPECT_EQ(bytes_t(magic, magic + 3), (bytes_t{0xAB, 0xCD, 0xEF})) << "Magic did not match after reboot";
+    EXPECT_EQ(nvm_via_read_layout_options(), 0x34) << "Layout options should have been truncated to their stored size";
+
+    bytes_t readback(VIA_EEPROM_CUSTOM_CONFIG_SIZE);
+    EXPECT_EQ(nvm_via_read_custom_config(readback.data(), 0, readback.size()), readback.size()) << "Read failed";
+    EXPECT_EQ(readback, (bytes_t{0, 0, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A})) << "Custom config did not match after reboot";
+
+    fail_writes();
+    EXPECT_EQ(nvm_via_update_custom_config(config.data(), 0, config.size()), 0) << "Failed update was not reported";
+
+    fail_reads();
+    EXPECT_EQ(nvm_via_read_custom_config(readback.data(), 0, readback.size()), 0) << "Failed read was not reported";
+    EXPECT_EQ(readback, bytes_t(VIA_EEPROM_CUSTOM_CONFIG_SIZE, 0)) << "Failed read should have been filled with zero";
+}
+
+/**
+ * This test verifies that keycodes are stored big endian, so the buffer APIs see the same layout as the eeprom
+ * provider, and that keycodes and buffers stay consistent with each other.
+ */
+TEST_F(NvmKvProviders, DynamicKeymap_KeycodesAndBuffer) {
+    nvm_dynamic_keymap_update_keycode(1, 1, 2, 0x1234);
+    EXPECT_EQ(nvm_dynamic_keymap_read_keycode(1, 1, 2), 0x1234) << "Keycode readback did not match";
+    EXPECT_EQ(nvm_dynamic_keymap_read_keycode(0, 0, 0), KC_NO) << "Unset keycode should read as KC_NO";
+    EXPECT_EQ(nvm_dynamic_keymap_read_keycode(1, MATRIX_ROWS, 0), KC_NO) << "Out of range keycode should read as KC_NO";
+
+    // Layer 1, row 1, column 2 is the last key
+    uint32_t offset = NVM_KV_DYNAMIC_KEYMAP_SIZE - 2;
+    bytes_t  buffer(4, 0xAA);
+    nvm_dynamic_keymap_read_buffer(offset, buffer.size(), buffer.data());
+    EXPECT_EQ(buffer, (bytes_t{0x12, 0x34, 0x00, 0x00})) << "Buffer did not match, or didn't zero-fill past the end";
+
+    bytes_t update = {0x56, 0x78};
+    nvm_dynamic_keymap_update_buffer(2, update.size(), update.data());
+
+    reboot();
+    EXPECT_EQ(nvm_dynamic_keymap_read_keycode(0, 0, 1), 0x5678) << "Buffer update did not match keycode after reboot";
+    EXPECT_EQ(nvm_dynamic_keymap_read_keycode(1, 1, 2), 0x1234) << "Keycode did not match after reboot";
+}
+
+/**
+ * This test verifies that macros are kept across a reboot, and that resetting them removes them.
+ */
+TEST_F(NvmKvProviders, DynamicKeymap_Macros) {
+    EXPECT_EQ(nvm_dynamic_keymap_macro_size(), DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE) << "Macro size did not match";
+
+    bytes_t macros = {'a', 0, 'b', 'c', 0};
+    nvm_dynamic_keymap_macro_update_buffer(6, macros.size(), macros.data());
+
+    reboot();
+    bytes_t readback(16, 0xAA);
+    nvm_dynamic_keymap_macro_read_buffer(0, readback.size(), readback.data());
+    EXPECT_EQ(readback, (bytes_t{0, 0, 0, 0, 0, 0, 'a', 0, 'b', 'c', 0, 0, 0, 0, 0, 0})) << "Macros did not match after reboot";
+
+    nvm_dynamic_keymap_macro_reset();
+    nvm_dynamic_keymap_macro_read_buffer(0, readback.size(), readback.data());
+    EXPECT_EQ(readback, bytes_t(16, 0)) << "Reset should have removed all macros";
+}
@@ -0,0 +1,288 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <cstring>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "backing_mocks.hpp"
+
+extern "C" {
+#include "nvm_kv.h"
+};
+
+class NvmKv : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        MockBackingStore::Instance().reset_instance();
+        nvm_kv_deinit();
+    }
+};
+
+using value_t = std::array<std::uint8_t, 4>;
+
+static value_t read_value(uint16_t key) {
+    value_t value;
+    nvm_kv_read(key, 0, value.data(), value.size());
+    return value;
+}
+
+// Size of a record holding a 2-byte value
+static constexpr std::uint32_t small_record_size = 8 + 2;
+
+/**
+ * This test verifies that a blank backing store is formatted on first access, and that missing keys read as zero.
+ */
+TEST_F(NvmKv, FreshStore_ReadsZero) {
+    auto&   inst  = MockBackingStore::Instance();
+    value_t value = {0xAA, 0xAA, 0xAA, 0xAA};
+    EXPECT_FALSE(nvm_kv_read(1, 0, value.data(), value.size())) << "Missing key reported as present";
+    EXPECT_EQ(value, (value_t{0, 0, 0, 0})) << "Missing key did not read as zero";
+    EXPECT_EQ(inst.erase_range_invoke_count(), 1) << "Fresh store should have had a bank erased";
+    EXPECT_EQ(nvm_kv_used_bytes(), 8) << "Fresh store should only contain the bank header";
+}
+
+/**
+ * This test verifies that values can be read back, in full or in part, and that trailing zeros aren't stored.
+ */
+TEST_F(NvmKv, UpdateAndReadBack) {
+    value_t value = {0x11, 0x22, 0x00, 0x00};
+    EXPECT_TRUE(nvm_kv_update(3, value.data(), value.size())) << "Update failed";
+    EXPECT_EQ(read_value(3), value) << "Readback did not match";
+    EXPECT_EQ(nvm_kv_used_bytes(), 8 + small_record_size) << "Trailing zeros should not have been stored";
+
+    std::uint8_t part = 0;
+    EXPECT_TRUE(nvm_kv_read(3, 1, &part, sizeof(part))) << "Partial read failed";
+    EXPECT_EQ(part, 0x22) << "Partial read did not match";
+}
+
+/**
+ * This test verifies that updating a key with its current value doesn't write to the backing store.
+ */
+TEST_F(NvmKv, UnchangedValue_NotWritten) {
+    auto&   inst  = MockBackingStore::Instance();
+    value_t value = {0x01, 0x02, 0x03, 0x04};
+    EXPECT_TRUE(nvm_kv_update(1, value.data(), value.size())) << "Update failed";
+    auto writes = inst.write_invoke_count();
+    EXPECT_TRUE(nvm_kv_update(1, value.data(), value.size())) << "Update failed";
+    EXPECT_EQ(inst.write_invoke_count(), writes) << "Unchanged value should not have been written";
+
+    // Writing zeros to a missing key is also a no-op
+    value_t zeros = {0, 0, 0, 0};
+    EXPECT_TRUE(nvm_kv_update(2, zeros.data(), zeros.size())) << "Update failed";
+    EXPECT_EQ(inst.write_invoke_count(), writes) << "Zero value for a missing key should not have been written";
+}
+
+/**
+ * This test verifies that deleted keys read back as zero, including after a reboot.
+ */
+TEST_F(NvmKv, Delete_ReadsZero) {
+    value_t value = {0x01, 0x02, 0x03, 0x04};
+    EXPECT_TRUE(nvm_kv_update(5, value.data(), value.size())) << "Update failed";
+    EXPECT_TRUE(nvm_kv_delete(5)) << "Delete failed";
+    EXPECT_FALSE(nvm_kv_read(5, 0, value.data(), value.size())) << "Deleted key reported as present";
+    EXPECT_EQ(value, (value_t{0, 0, 0, 0})) << "Deleted key did not read as zero";
+
+    nvm_kv_deinit();
+    EXPECT_EQ(read_value(5), (value_t{0, 0, 0, 0})) << "Deleted key did not read as zero after reboot";
+}
+
+/**
+ * This test verifies that the latest value of each key is recovered from the backing store on boot.
+ */
+TEST_F(NvmKv, ValuesPersistAcrossReboot) {
+    for (uint16_t key = 1; key < 8; ++key) {
+        value_t value = {(uint8_t)key, 0x00, (uint8_t)(key * 3), 0x00};
+        EXPECT_TRUE(nvm_kv_update(key, value.data(), value.size())) << "Update failed";
+    }
+    value_t latest = {0xFE, 0xED};
+    EXPECT_TRUE(nvm_kv_update(4, latest.data(), latest.size())) << "Update failed";
+
+    nvm_kv_deinit();
+    for (uint16_t key = 1; key < 8; ++key) {
+        value_t expected = key == 4 ? latest : value_t{(uint8_t)key, 0x00, (uint8_t)(key * 3), 0x00};
+        EXPECT_EQ(read_value(key), expected) << "Readback of key " << key << " did not match after reboot";
+    }
+}
+
+/**
+ * This test verifies that a full bank is compacted into the other bank, keeping only the latest value of each key.
+ */
+TEST_F(NvmKv, FullBank_Compacts) {
+    auto& inst = MockBackingStore::Instance();
+    for (uint16_t i = 0; i < 100; ++i) {
+        uint16_t value = i + 1;
+        EXPECT_TRUE(nvm_kv_update(1 + (i % 3), &value, sizeof(value))) << "Update failed";
+    }
+    EXPECT_GT(inst.erase_range_invoke_count(), 2) << "Store should have been compacted";
+
+    nvm_kv_deinit();
+    const uint16_t expected[] = {100, 98, 99};
+    for (uint16_t key = 1; key <= 3; ++key) {
+        uint16_t value = 0;
+        nvm_kv_read(key, 0, &value, sizeof(value));
+        EXPECT_EQ(value, expected[key - 1]) << "Readback of key " << key << " did not match after compaction and reboot";
+    }
+}
+
+/**
+ * This test verifies that a write interrupted by a loss of power leaves the previous value intact, and that the
+ * partially-written record is cleaned up before the next write.
+ */
+TEST_F(NvmKv, PowerLossDuringUpdate_KeepsPreviousValue) {
+    auto&   inst     = MockBackingStore::Instance();
+    value_t previous = {0x01, 0x02, 0x03, 0x04};
+    EXPECT_TRUE(nvm_kv_update(2, previous.data(), previous.size())) << "Update failed";
+
+    // Only the start of the record header makes it into the backing store
+    inst.set_power_loss_after(inst.mutation_count() + 1);
+    value_t next = {0x05, 0x06, 0x07, 0x08};
+    nvm_kv_update(2, next.data(), next.size());
+    inst.restore_power();
+
+    nvm_kv_deinit();
+    EXPECT_EQ(read_value(2), previous) << "Previous value was not kept";
+
+    auto erases = inst.erase_range_invoke_count();
+    EXPECT_TRUE(nvm_kv_update(2, next.data(), next.size())) << "Update failed";
+    EXPECT_EQ(inst.erase_range_invoke_count(), erases + 1) << "Partially-written record should have been compacted away";
+
+    nvm_kv_deinit();
+    EXPECT_EQ(read_value(2), next) << "Readback did not match after reboot";
+}
+
+/**
+ * This test verifies that a compaction interrupted by a loss of power at any point leaves all values intact.
+ */
+TEST_F(NvmKv, PowerLossDuringCompaction_KeepsValues) {
+    auto& inst = MockBackingStore::Instance();
+
+    for (std::uint64_t cutoff = 0;; ++cutoff) {
+        inst.reset_instance();
+        nvm_kv_deinit();
+
+        // Fill the active bank, so that the next update requires a compaction
+        uint16_t values[4] = {};
+        for (uint16_t i = 0; nvm_kv_used_bytes() + small_record_size <= WEAR_LEVELING_BANK_SIZE; ++i) {
+            values[i % 4] = 0x100 + i;
+            EXPECT_TRUE(nvm_kv_update(1 + (i % 4), &values[i % 4], sizeof(uint16_t))) << "Update failed";
+        }
+
+        auto     start = inst.mutation_count();
+        uint16_t next  = 0xBEEF;
+        inst.set_power_loss_after(start + cutoff);
+        nvm_kv_update(1, &next, sizeof(next));
+        inst.restore_power();
+        bool completed = inst.mutation_count() <= start + cutoff;
+
+        nvm_kv_deinit();
+        for (uint16_t key = 1; key <= 4; ++key) {
+            uint16_t value = 0;
+            nvm_kv_read(key, 0, &value, sizeof(value));
+            if (key == 1 && completed) {
+                EXPECT_EQ(value, next) << "Update was lost, with power lost after " << cutoff << " mutations";
+            } else if (key != 1) {
+                EXPECT_EQ(value, values[key - 1]) << "Key " << key << " was lost, with power lost after " << cutoff << " mutations";
+            } else {
+                EXPECT_TRUE(value == next || value == values[0]) << "Key 1 was corrupted, with power lost after " << cutoff << " mutations";
+            }
+        }
+
+        if (completed) {
+            // Sanity check that the cutoffs covered the erase of the standby bank
+            EXPECT_GT(cutoff, WEAR_LEVELING_BANK_SIZE / BACKING_STORE_WRITE_SIZE) << "Compaction completed too early";
+            break;
+        }
+    }
+}
+
+/**
+ * This test verifies that erasing the store removes all values.
+ */
+TEST_F(NvmKv, Erase_RemovesAllValues) {
+    for (uint16_t key = 1; key < 8; ++key) {
+        value_t value = {(uint8_t)key, 0x01, 0x02, 0x03};
+        EXPECT_TRUE(nvm_kv_update(key, value.data(), value.size())) << "Update failed";
+    }
+    EXPECT_TRUE(nvm_kv_erase()) << "Erase failed";
+    EXPECT_EQ(nvm_kv_used_bytes(), 8) << "Erased store should only contain the bank header";
+
+    nvm_kv_deinit();
+    for (uint16_t key = 1; key < 8; ++key) {
+        EXPECT_EQ(read_value(key), (value_t{0, 0, 0, 0})) << "Key " << key << " was not erased";
+    }
+}
+
+/**
+ * This test verifies that chunked values can be read and updated across chunk boundaries, and only rewrite the
+ * chunks which changed.
+ */
+TEST_F(NvmKv, ChunkedValues) {
+    std::array<std::uint8_t, NVM_KV_CHUNK_SIZE * 4> data{};
+    EXPECT_TRUE(nvm_kv_update_chunked(10, 0, data.data(), data.size())) << "Update failed";
+    EXPECT_EQ(nvm_kv_used_bytes(), 8) << "All-zero chunks should not have been stored";
+
+    // Straddle the boundary between the second and third chunks
+    std::uint8_t patch[4] = {1, 2, 3, 4};
+    std::memcpy(&data[NVM_KV_CHUNK_SIZE * 2 - 2], patch, sizeof(patch));
+    EXPECT_TRUE(nvm_kv_update_chunked(10, NVM_KV_CHUNK_SIZE * 2 - 2, patch, sizeof(patch))) << "Update failed";
+    EXPECT_EQ(nvm_kv_used_bytes(), 8 + (8 + NVM_KV_CHUNK_SIZE) + (8 + 2)) << "Only the two affected chunks should have been stored";
+
+    std::array<std::uint8_t, NVM_KV_CHUNK_SIZE * 4> readback;
+    EXPECT_TRUE(nvm_kv_read_chunked(10, 0, readback.data(), readback.size())) << "Read failed";
+    EXPECT_EQ(readback, data) << "Readback did not match";
+
+    std::uint8_t part[3];
+    nvm_kv_read_chunked(10, NVM_KV_CHUNK_SIZE * 2 - 1, part, sizeof(part));
+    EXPECT_THAT(part, testing::ElementsAre(2, 3, 4)) << "Partial readback did not match";
+
+    EXPECT_TRUE(nvm_kv_delete_chunked(10, 4)) << "Delete failed";
+    nvm_kv_read_chunked(10, 0, readback.data(), readback.size());
+    EXPECT_THAT(readback, testing::Each(0)) << "Deleted chunks did not read as zero";
+}
+
+/**
+ * This test verifies that a value which can't be read from the backing store is reported as missing, rather than
+ * returning whatever was read before the failure.
+ */
+TEST_F(NvmKv, UnreadableValue_ReportsFailure) {
+    auto&   inst  = MockBackingStore::Instance();
+    value_t value = {0x01, 0x02, 0x03, 0x04};
+    EXPECT_TRUE(nvm_kv_update(3, value.data(), value.size())) << "Update failed";
+
+    // The first record's data follows the bank header and its own header
+    inst.set_read_callback([](std::uint32_t address) { return address < 16 || address >= 16 + sizeof(value_t); });
+    value_t readback = {0xAA, 0xAA, 0xAA, 0xAA};
+    EXPECT_FALSE(nvm_kv_read(3, 0, readback.data(), readback.size())) << "Failed read was reported as present";
+    EXPECT_EQ(readback, (value_t{0, 0, 0, 0})) << "Failed read should have been filled with zero";
+}
+
+/**
+ * This test verifies that chunked updates stop at the first failure and report it, and that a chunk which can't be
+ * read isn't rewritten with only the supplied bytes.
+ */
+TEST_F(NvmKv, ChunkedFailures_Reported) {
+    auto&                                           inst = MockBackingStore::Instance();
+    std::array<std::uint8_t, NVM_KV_CHUNK_SIZE * 2> data;
+    data.fill(0x5A);
+    EXPECT_TRUE(nvm_kv_update_chunked(10, 0, data.data(), data.size())) << "Update failed";
+
+    // Partial update of a chunk which can't be read
+    inst.set_read_callback([](std::uint32_t address) { return address < 16; });
+    std::uint8_t patch = 0x01;
+    auto         used  = nvm_kv_used_bytes();
+    EXPECT_FALSE(nvm_kv_update_chunked(10, 1, &patch, sizeof(patch))) << "Failed read of the chunk was not reported";
+    EXPECT_EQ(nvm_kv_used_bytes(), used) << "Unreadable chunk should not have been rewritten";
+    std::array<std::uint8_t, NVM_KV_CHUNK_SIZE * 2> readback;
+    EXPECT_FALSE(nvm_kv_read_chunked(10, 0, readback.data(), readback.size())) << "Failed read was not reported";
+    inst.set_read_callback([](std::uint32_t) { return true; });
+
+    // Update which can't be stored
+    inst.set_write_callback([](std::uint64_t, std::uint32_t) { return false; });
+    std::array<std::uint8_t, NVM_KV_CHUNK_SIZE * 2> next;
+    next.fill(0xA5);
+    EXPECT_FALSE(nvm_kv_update_chunked(10, 0, next.data(), next.size())) << "Failed write was not reported";
+    inst.set_write_callback([](std::uint64_t, std::uint32_t) { return true; });
+
+    nvm_kv_deinit();
+    EXPECT_TRUE(nvm_kv_read_chunked(10, 0, readback.data(), readback.size())) << "Read failed";
+    EXPECT_EQ(readback, data) << "Previous value was not kept after failed updates";
+}
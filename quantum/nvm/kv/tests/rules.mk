@@ -0,0 +1,51 @@
+nvm_kv_DEFS := \
+	-DNVM_KV_TESTS \
+	-DNVM_DRIVER_KV \
+	-DNVM_KV_KEY_COUNT=32 \
+	-DNVM_KV_CHUNK_SIZE=8 \
+	-DBACKING_STORE_WRITE_SIZE=2 \
+	-DWEAR_LEVELING_BACKING_SIZE=512 \
+	-DWEAR_LEVELING_LOGICAL_SIZE=128
+nvm_kv_SRC := \
+	$(LIB_PATH)/fnv/qmk_fnv_type_validation.c \
+	$(LIB_PATH)/fnv/hash_32a.c \
+	$(LIB_PATH)/fnv/hash_64a.c \
+	$(QUANTUM_PATH)/wear_leveling/wear_leveling.c \
+	$(QUANTUM_PATH)/wear_leveling/tests/backing_mocks.cpp \
+	$(QUANTUM_PATH)/nvm/kv/nvm_kv.c \
+	$(QUANTUM_PATH)/nvm/kv/tests/nvm_kv_tests.cpp
+nvm_kv_INC := \
+	$(LIB_PATH)/fnv \
+	$(QUANTUM_PATH)/wear_leveling \
+	$(QUANTUM_PATH)/wear_leveling/tests \
+	$(QUANTUM_PATH)/nvm/kv
+
+nvm_kv_providers_DEFS := \
+	-DNVM_KV_TESTS \
+	-DNVM_DRIVER_KV \
+	-DVIA_ENABLE \
+	-DDYNAMIC_KEYMAP_ENABLE \
+	-DMATRIX_ROWS=2 \
+	-DMATRIX_COLS=3 \
+	-DDYNAMIC_KEYMAP_LAYER_COUNT=2 \
+	-DDYNAMIC_KEYMAP_MACRO_EEPROM_SIZE=64 \
+	-DEECONFIG_KB_DATA_SIZE=12 \
+	-DVIA_EEPROM_CUSTOM_CONFIG_SIZE=12 \
+	-DNVM_KV_CHUNK_SIZE=8 \
+	-DBACKING_STORE_WRITE_SIZE=2 \
+	-DWEAR_LEVELING_BACKING_SIZE=1024 \
+	-DWEAR_LEVELING_LOGICAL_SIZE=256
+nvm_kv_providers_SRC := \
+	$(LIB_PATH)/fnv/qmk_fnv_type_validation.c \
+	$(LIB_PATH)/fnv/hash_32a.c \
+	$(LIB_PATH)/fnv/hash_64a.c \
+	$(QUANTUM_PATH)/wear_leveling/wear_leveling.c \
+	$(QUANTUM_PATH)/wear_leveling/tests/backing_mocks.cpp \
+	$(QUANTUM_PATH)/nvm/kv/nvm_kv.c \
+	$(QUANTUM_PATH)/nvm/kv/nvm_eeconfig.c \
+	$(QUANTUM_PATH)/nvm/kv/nvm_via.c \
+	$(QUANTUM_PATH)/nvm/kv/nvm_dynamic_keymap.c \
+	$(QUANTUM_PATH)/nvm/kv/tests/nvm_kv_providers_tests.cpp
+nvm_kv_providers_INC := \
+	$(nvm_kv_INC) \
+	$(QUANTUM_PATH)/nvm
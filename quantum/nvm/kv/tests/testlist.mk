@@ -0,0 +1,3 @@
+TEST_LIST += \
+	nvm_kv \
+	nvm_kv_providers
@@ -0,0 +1,186 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <string.h>
+#include "nvm_cache.h"
+#include "compiler_support.h"
+#include "eeprom.h"
+#include "timer.h"
+#include "util.h"
+
+STATIC_ASSERT(NVM_CACHE_PAGE_SIZE > 0 && (NVM_CACHE_PAGE_SIZE & (NVM_CACHE_PAGE_SIZE - 1)) == 0, "NVM_CACHE_PAGE_SIZE must be a power of two");
+STATIC_ASSERT(NVM_CACHE_PAGE_SIZE <= 256, "NVM_CACHE_PAGE_SIZE must fit the dirty span bookkeeping");
+STATIC_ASSERT(NVM_CACHE_PAGE_COUNT > 0 && NVM_CACHE_PAGE_COUNT < 256, "NVM_CACHE_PAGE_COUNT must be between 1 and 255");
+
+#define NVM_CACHE_PAGE_MASK (~(uintptr_t)(NVM_CACHE_PAGE_SIZE - 1))
+
+typedef struct {
+    uintptr_t base;
+    uint16_t  dirty_start; // Dirty span within the page, empty when dirty_start == dirty_end
+    uint16_t  dirty_end;
+    uint8_t   last_used;
+    bool      valid;
+    uint8_t   data[NVM_CACHE_PAGE_SIZE];
+} nvm_cache_page_t;
+
+static nvm_cache_page_t pages[NVM_CACHE_PAGE_COUNT];
+static uint8_t          use_counter;
+static uint8_t          dirty_count;
+static uint32_t         last_write;
+
+static inline bool page_is_dirty(const nvm_cache_page_t *page) {
+    return page->dirty_start != page->dirty_end;
+}
+
+static nvm_cache_page_t *page_find(uintptr_t base) {
+    for (uint8_t i = 0; i < NVM_CACHE_PAGE_COUNT; i++) {
+        if (pages[i].valid && pages[i].base == base) {
+            return &pages[i];
+        }
+    }
+    return NULL;
+}
+
+static void page_commit(nvm_cache_page_t *page) {
+    if (!page_is_dirty(page)) {
+        return;
+    }
+    eeprom_update_block(page->data + page->dirty_start, (void *)(page->base + page->dirty_start), page->dirty_end - page->dirty_start);
+    page->dirty_start = page->dirty_end = 0;
+    dirty_count--;
+}
+
+static void page_touch(nvm_cache_page_t *page) {
+    page->last_used = ++use_counter;
+}
+
+static nvm_cache_page_t *page_load(uintptr_t base) {
+    // Reuse a free slot, otherwise evict the least recently used page
+    nvm_cache_page_t *victim = NULL;
+    for (uint8_t i = 0; i < NVM_CACHE_PAGE_COUNT; i++) {
+        if (!pages[i].valid) {
+            victim = &pages[i];
+            break;
+        }
+        if (!victim || (uint8_t)(use_counter - pages[i].last_used) > (uint8_t)(use_counter - victim->last_used)) {
+            victim = &pages[i];
+        }
+    }
+
+    page_commit(victim);
+
+    size_t len = NVM_CACHE_PAGE_SIZE;
+#ifdef TOTAL_EEPROM_BYTE_COUNT
+    if (base + len > TOTAL_EEPROM_BYTE_COUNT) {
+        len = TOTAL_EEPROM_BYTE_COUNT > base ? TOTAL_EEPROM_BYTE_COUNT - base : 0;
+    }
+#endif
+    memset(victim->data, 0, sizeof(victim->data));
+    eeprom_read_block(victim->data, (const void *)base, len);
+    victim->base        = base;
+    victim->dirty_start = victim->dirty_end = 0;
+    victim->valid       = true;
+    return victim;
+}
+
+void nvm_cache_read_block(void *buf, const void *addr, size_t len) {
+    uintptr_t address = (uintptr_t)addr;
+    uint8_t  *dest    = (uint8_t *)buf;
+    while (len) {
+        uintptr_t         base   = address & NVM_CACHE_PAGE_MASK;
+        size_t            offset = address - base;
+        size_t            chunk  = MIN(len, NVM_CACHE_PAGE_SIZE - offset);
+        nvm_cache_page_t *page   = page_find(base);
+        if (page) {
+            memcpy(dest, page->data + offset, chunk);
+        } else {
+            // Reads do not allocate, most of them happen once during startup
+            eeprom_read_block(dest, (const void *)address, chunk);
+        }
+        address += chunk;
+        dest += chunk;
+        len -= chunk;
+    }
+}
+
+void nvm_cache_update_block(const void *buf, void *addr, size_t len) {
+    uintptr_t      address = (uintptr_t)addr;
+    const uint8_t *src     = (const uint8_t *)buf;
+    while (len) {
+        uintptr_t         base   = address & NVM_CACHE_PAGE_MASK;
+        size_t            offset = address - base;
+        size_t            chunk  = MIN(len, NVM_CACHE_PAGE_SIZE - offset);
+        nvm_cache_page_t *page   = page_find(base);
+        if (!page) {
+            page = page_load(base);
+        }
+        page_touch(page);
+
+        if (memcmp(page->data + offset, src, chunk) != 0) {
+            memcpy(page->data + offset, src, chunk);
+            if (!page_is_dirty(page)) {
+                page->dirty_start = offset;
+                page->dirty_end   = offset + chunk;
+                dirty_count++;
+            } else {
+                page->dirty_start = MIN(page->dirty_start, offset);
+                page->dirty_end   = MAX(page->dirty_end, offset + chunk);
+            }
+            last_write = timer_read32();
+        }
+
+        address += chunk;
+        src += chunk;
+        len -= chunk;
+    }
+}
+
+uint8_t nvm_cache_read_byte(const uint8_t *addr) {
+    uint8_t ret = 0;
+    nvm_cache_read_block(&ret, addr, sizeof(ret));
+    return ret;
+}
+
+uint16_t nvm_cache_read_word(const uint16_t *addr) {
+    uint16_t ret = 0;
+    nvm_cache_read_block(&ret, addr, sizeof(ret));
+    return ret;
+}
+
+uint32_t nvm_cache_read_dword(const uint32_t *addr) {
+    uint32_t ret = 0;
+    nvm_cache_read_block(&ret, addr, sizeof(ret));
+    return ret;
+}
+
+void nvm_cache_update_byte(uint8_t *addr, uint8_t value) {
+    nvm_cache_update_block(&value, addr, sizeof(value));
+}
+
+void nvm_cache_update_word(uint16_t *addr, uint16_t value) {
+    nvm_cache_update_block(&value, addr, sizeof(value));
+}
+
+void nvm_cache_update_dword(uint32_t *addr, uint32_t value) {
+    nvm_cache_update_block(&value, addr, sizeof(value));
+}
+
+bool nvm_cache_is_dirty(void) {
+    return dirty_count > 0;
+}
+
+void nvm_cache_flush(void) {
+    for (uint8_t i = 0; i < NVM_CACHE_PAGE_COUNT && dirty_count; i++) {
+        page_commit(&pages[i]);
+    }
+}
+
+void nvm_cache_invalidate(void) {
+    memset(pages, 0, sizeof(pages));
+    dirty_count = 0;
+}
+
+void nvm_cache_task(void) {
+    if (dirty_count && timer_elapsed32(last_write) >= NVM_CACHE_IDLE_TIMEOUT) {
+        nvm_cache_flush();
+    }
+}
@@ -0,0 +1,71 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+ * \file
+ *
+ * \defgroup nvm_cache NVM write-back cache
+ *
+ * Keeps recently written pages of the backing store in RAM, so that bursts of small updates (holding a hue key,
+ * a VIA keymap upload) only reach the backing store once writes have stopped for NVM_CACHE_IDLE_TIMEOUT
+ * milliseconds. Each committed write covers the dirty span of a single NVM_CACHE_PAGE_SIZE aligned page.
+ * \{
+ */
+
+#ifndef NVM_CACHE_PAGE_SIZE
+#    define NVM_CACHE_PAGE_SIZE 32
+#endif
+
+#ifndef NVM_CACHE_PAGE_COUNT
+#    define NVM_CACHE_PAGE_COUNT 8
+#endif
+
+#ifndef NVM_CACHE_IDLE_TIMEOUT
+#    define NVM_CACHE_IDLE_TIMEOUT 1000
+#endif
+
+/**
+ * \brief Read a block through the cache.
+ */
+void nvm_cache_read_block(void *buf, const void *addr, size_t len);
+
+/**
+ * \brief Write a block into the cache, deferring the commit to the backing store.
+ */
+void nvm_cache_update_block(const void *buf, void *addr, size_t len);
+
+uint8_t  nvm_cache_read_byte(const uint8_t *addr);
+uint16_t nvm_cache_read_word(const uint16_t *addr);
+uint32_t nvm_cache_read_dword(const uint32_t *addr);
+void     nvm_cache_update_byte(uint8_t *addr, uint8_t value);
+void     nvm_cache_update_word(uint16_t *addr, uint16_t value);
+void     nvm_cache_update_dword(uint32_t *addr, uint32_t value);
+
+/**
+ * \brief Whether any cached data still has to be committed.
+ */
+bool nvm_cache_is_dirty(void);
+
+/**
+ * \brief Commit all dirty data to the backing store immediately.
+ *
+ * Called before suspending and before jumping to the bootloader.
+ */
+void nvm_cache_flush(void);
+
+/**
+ * \brief Drop all cached data without committing it, e.g. after the backing store has been erased.
+ */
+void nvm_cache_invalidate(void);
+
+/**
+ * \brief Commit dirty data once no writes have happened for NVM_CACHE_IDLE_TIMEOUT milliseconds.
+ */
+void nvm_cache_task(void);
+
+/** \} */
@@ -3,7 +3,7 @@
 
 VPATH += $(QUANTUM_DIR)/nvm
 
-VALID_NVM_DRIVERS := eeprom custom none
+VALID_NVM_DRIVERS := eeprom kv custom none
 
 NVM_DRIVER ?= eeprom
 
@@ -17,6 +17,15 @@ else
         EEPROM_DRIVER := transient
     endif
 
+    # The kv provider keeps its own log in the wear-leveling backing store, so nothing else may use it as EEPROM.
+    ifeq ($(NVM_DRIVER),kv)
+        ifeq ($(filter-out none,$(strip $(WEAR_LEVELING_DRIVER))),)
+            $(call CATASTROPHIC_ERROR,Invalid NVM_DRIVER,NVM_DRIVER="kv" requires a WEAR_LEVELING_DRIVER to provide its backing store)
+        endif
+        EEPROM_DRIVER := transient
+        QUANTUM_SRC += nvm_kv.c
+    endif
+
     NVM_DRIVER_UPPER := $(shell echo $(NVM_DRIVER) | tr '[:lower:]' '[:upper:]')
     NVM_DRIVER_LOWER := $(shell echo $(NVM_DRIVER) | tr '[:upper:]' '[:lower:]')
 
@@ -28,4 +37,9 @@ else
 
     QUANTUM_SRC += nvm_eeconfig.c
 
+    ifeq ($(strip $(NVM_CACHE_ENABLE)), yes)
+        OPT_DEFS += -DNVM_CACHE_ENABLE
+        QUANTUM_SRC += nvm_cache.c
+    endif
+
 endif
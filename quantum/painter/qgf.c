@@ -177,7 +177,7 @@ void qgf_seek_to_frame_descriptor(qp_stream_t *stream, uint16_t frame_number) {
     qp_stream_setpos(stream, offset);
 }
 
-bool qgf_validate_frame_descriptor(qp_stream_t *stream, uint16_t frame_number, uint8_t *bpp, bool *has_palette, bool *is_panel_native, bool *is_delta) {
+bool qgf_validate_frame_descriptor(qp_stream_t *stream, uint16_t frame_number, uint8_t *bpp, bool *has_palette, bool *is_panel_native, bool *is_delta, bool *has_delta_rects) {
     // Seek to the correct location
     qgf_seek_to_frame_descriptor(stream, frame_number);
 
@@ -193,6 +193,13 @@ bool qgf_validate_frame_descriptor(qp_stream_t *stream, uint16_t frame_number, u
         return false;
     }
 
+    // Dirty rectangles are only meaningful on delta frames
+    *has_delta_rects = (frame_descriptor.flags & QGF_FRAME_FLAG_DELTA_RECTS) == QGF_FRAME_FLAG_DELTA_RECTS;
+    if (*has_delta_rects && (frame_descriptor.flags & QGF_FRAME_FLAG_DELTA) != QGF_FRAME_FLAG_DELTA) {
+        qp_dprintf("Frame %d has delta rects but is not a delta frame\n", (int)frame_number);
+        return false;
+    }
+
     return qgf_parse_frame_descriptor(&frame_descriptor, bpp, has_palette, is_panel_native, is_delta, NULL, NULL);
 }
 
@@ -211,11 +218,19 @@ bool qgf_validate_palette_descriptor(qp_stream_t *stream, uint16_t frame_number,
     }
 
     // Move forward in the stream to the next block
-    qp_stream_seek(stream, expected_length, SEEK_CUR);
+    if (qp_stream_seek(stream, expected_length, SEEK_CUR) < 0) {
+        qp_dprintf("Failed to skip palette for frame %d\n", (int)frame_number);
+        return false;
+    }
     return true;
 }
 
-bool qgf_validate_delta_descriptor(qp_stream_t *stream, uint16_t frame_number) {
+// Checks that a rectangle isn't inverted, and lies within the image
+static bool qgf_validate_rect(uint16_t left, uint16_t top, uint16_t right, uint16_t bottom, uint16_t image_width, uint16_t image_height) {
+    return left <= right && top <= bottom && right < image_width && bottom < image_height;
+}
+
+bool qgf_validate_delta_descriptor(qp_stream_t *stream, uint16_t frame_number, uint16_t image_width, uint16_t image_height) {
     // Read the delta descriptor
     qgf_delta_v1_t delta_descriptor;
     if (qp_stream_read(&delta_descriptor, sizeof(qgf_delta_v1_t), 1, stream) != 1) {
@@ -228,6 +243,58 @@ bool qgf_validate_delta_descriptor(qp_stream_t *stream, uint16_t frame_number) {
         return false;
     }
 
+    // Make sure the delta area is within the image
+    if (!qgf_validate_rect(delta_descriptor.left, delta_descriptor.top, delta_descriptor.right, delta_descriptor.bottom, image_width, image_height)) {
+        qp_dprintf("Frame %d has an invalid delta area\n", (int)frame_number);
+        return false;
+    }
+
+    return true;
+}
+
+bool qgf_read_delta_rects_descriptor(qp_stream_t *stream, uint16_t *rect_count) {
+    // Read the delta rects descriptor
+    qgf_delta_rects_v1_t rects_descriptor;
+    if (qp_stream_read(&rects_descriptor, sizeof(qgf_delta_rects_v1_t), 1, stream) != 1) {
+        qp_dprintf("Failed to read delta_rects_descriptor, expected length was not %d\n", (int)sizeof(qgf_delta_rects_v1_t));
+        return false;
+    }
+
+    // Make sure this block is valid, and holds a whole number of rects
+    if (!qgf_validate_block_header(&rects_descriptor.header, QGF_FRAME_DELTA_RECTS_DESCRIPTOR_TYPEID, -1)) {
+        return false;
+    }
+
+    uint32_t length = rects_descriptor.header.length;
+    if (length == 0 || (length % sizeof(qgf_delta_rect_v1_t)) != 0 || (length / sizeof(qgf_delta_rect_v1_t)) > UINT16_MAX) {
+        qp_dprintf("Invalid delta_rects_descriptor length: %d\n", (int)length);
+        return false;
+    }
+
+    // Stream is left at the first rect
+    *rect_count = length / sizeof(qgf_delta_rect_v1_t);
+    return true;
+}
+
+bool qgf_validate_delta_rects_descriptor(qp_stream_t *stream, uint16_t frame_number, uint16_t image_width, uint16_t image_height) {
+    uint16_t rect_count;
+    if (!qgf_read_delta_rects_descriptor(stream, &rect_count)) {
+        return false;
+    }
+
+    // Make sure each rect is within the image, which also leaves the stream at the next block
+    for (uint16_t i = 0; i < rect_count; ++i) {
+        qgf_delta_rect_v1_t rect;
+        if (qp_stream_read(&rect, sizeof(qgf_delta_rect_v1_t), 1, stream) != 1) {
+            qp_dprintf("Failed to read delta rect %d for frame %d\n", (int)i, (int)frame_number);
+            return false;
+        }
+        if (!qgf_validate_rect(rect.left, rect.top, rect.right, rect.bottom, image_width, image_height)) {
+            qp_dprintf("Frame %d has an invalid delta rect %d\n", (int)frame_number, (int)i);
+            return false;
+        }
+    }
+
     return true;
 }
 
@@ -247,8 +314,8 @@ bool qgf_validate_frame_data_descriptor(qp_stream_t *stream, uint16_t frame_numb
 }
 
 bool qgf_validate_stream(qp_stream_t *stream) {
-    uint16_t frame_count;
-    if (!qgf_read_graphics_descriptor(stream, NULL, NULL, &frame_count, NULL)) {
+    uint16_t image_width, image_height, frame_count;
+    if (!qgf_read_graphics_descriptor(stream, &image_width, &image_height, &frame_count, NULL)) {
         return false;
     }
 
@@ -259,7 +326,8 @@ bool qgf_validate_stream(qp_stream_t *stream) {
         bool    has_palette     = false;
         bool    is_panel_native = false;
         bool    has_delta       = false;
-        if (!qgf_validate_frame_descriptor(stream, i, &bpp, &has_palette, &is_panel_native, &has_delta)) {
+        bool    has_delta_rects = false;
+        if (!qgf_validate_frame_descriptor(stream, i, &bpp, &has_palette, &is_panel_native, &has_delta, &has_delta_rects)) {
             return false;
         }
 
@@ -269,7 +337,12 @@ bool qgf_validate_stream(qp_stream_t *stream) {
         }
 
         // If we've got a delta block, check it
-        if (has_delta && !qgf_validate_delta_descriptor(stream, i)) {
+        if (has_delta && !qgf_validate_delta_descriptor(stream, i, image_width, image_height)) {
+            return false;
+        }
+
+        // If we've got a delta rects block, check it
+        if (has_delta_rects && !qgf_validate_delta_rects_descriptor(stream, i, image_width, image_height)) {
             return false;
         }
 
@@ -56,6 +56,24 @@
 #    define QUANTUM_PAINTER_LOAD_FONTS_TO_RAM FALSE
 #endif
 
+#ifndef QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES
+/**
+ * @def This controls the number of pre-rendered glyphs that are kept in RAM, already converted to the panel's native
+ *      pixel format. Glyphs are keyed by device, font, code point and colors, and the least-recently-used glyph is
+ *      evicted when the cache is full. Redrawing a cached glyph skips decoding and palette conversion entirely.
+ *      Defaults to 0 (disabled); each entry costs \ref QUANTUM_PAINTER_GLYPH_CACHE_ENTRY_SIZE bytes of RAM.
+ */
+#    define QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES 0
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES
+
+#ifndef QUANTUM_PAINTER_GLYPH_CACHE_ENTRY_SIZE
+/**
+ * @def This controls the size (in bytes) of native pixel data held by each glyph cache entry. Glyphs whose native
+ *      pixel data does not fit are rendered directly from the font, as if the cache were disabled.
+ */
+#    define QUANTUM_PAINTER_GLYPH_CACHE_ENTRY_SIZE 256
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_ENTRY_SIZE
+
 #ifndef QUANTUM_PAINTER_CONCURRENT_ANIMATIONS
 /**
  * @def This controls the maximum number of animations that Quantum Painter can play simultaneously. Increasing this
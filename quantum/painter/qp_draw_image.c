@@ -122,6 +122,8 @@ typedef struct qgf_frame_info_t {
     uint16_t              right;
     uint16_t              bottom;
     uint16_t              delay;
+    uint16_t              rect_count;
+    uint32_t              rects_offset;
 } qgf_frame_info_t;
 
 static bool qp_drawimage_prepare_frame_for_stream_read(painter_device_t device, qgf_image_handle_t *qgf_image, uint16_t frame_number, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, qgf_frame_info_t *info) {
@@ -197,6 +199,20 @@ static bool qp_drawimage_prepare_frame_for_stream_read(painter_device_t device,
         info->bottom = delta_descriptor.bottom;
     }
 
+    // Handle delta rects if needed -- remember where they live, the pixel data follows immediately after
+    info->rect_count = 0;
+    if (info->is_delta && (frame_descriptor.flags & QGF_FRAME_FLAG_DELTA_RECTS) == QGF_FRAME_FLAG_DELTA_RECTS) {
+        if (!qgf_read_delta_rects_descriptor(&qgf_image->stream, &info->rect_count)) {
+            return false;
+        }
+
+        info->rects_offset = qp_stream_tell(&qgf_image->stream);
+        if (qp_stream_seek(&qgf_image->stream, info->rect_count * sizeof(qgf_delta_rect_v1_t), SEEK_CUR) < 0) {
+            qp_dprintf("Failed to skip delta rects\n");
+            return false;
+        }
+    }
+
     // Read the data block
     qgf_data_v1_t data_descriptor;
     if (qp_stream_read(&data_descriptor, sizeof(qgf_data_v1_t), 1, &qgf_image->stream) != 1) {
@@ -233,27 +249,6 @@ static bool qp_drawimage_recolor_impl(painter_device_t device, uint16_t x, uint1
         return false;
     }
 
-    uint16_t l, t, r, b;
-    if (frame_info->is_delta) {
-        l = x + frame_info->left;
-        t = y + frame_info->top;
-        r = x + frame_info->right;
-        b = y + frame_info->bottom;
-    } else {
-        l = x;
-        t = y;
-        r = x + image->width - 1;
-        b = y + image->height - 1;
-    }
-    uint32_t pixel_count = ((uint32_t)(r - l + 1)) * (b - t + 1);
-
-    // Configure where we're going to be rendering to
-    if (!driver->driver_vtable->viewport(device, l, t, r, b)) {
-        qp_dprintf("qp_drawimage_recolor: fail (could not set viewport)\n");
-        qp_comms_stop(device);
-        return false;
-    }
-
     // Set up the input state
     qp_internal_byte_input_state_t  input_state    = {.device = device, .src_stream = &qgf_image->stream};
     qp_internal_byte_input_callback input_callback = qp_internal_prepare_input_state(&input_state, frame_info->compression_scheme);
@@ -263,8 +258,64 @@ static bool qp_drawimage_recolor_impl(painter_device_t device, uint16_t x, uint1
         return false;
     }
 
-    // Decode and stream pixels
-    bool ret = qp_internal_appender(device, frame_info->bpp, pixel_count, input_callback, &input_state);
+    bool ret;
+    if (frame_info->rect_count > 0) {
+        // Only upload the dirty rectangles, the decoder state carries across each of them
+        ret = true;
+        for (uint16_t i = 0; ret && i < frame_info->rect_count; ++i) {
+            // Fetch the rect, then return to where the pixel data was up to
+            qgf_delta_rect_v1_t rect;
+            int32_t             data_pos = qp_stream_tell(&qgf_image->stream);
+            if (data_pos < 0 || qp_stream_setpos(&qgf_image->stream, frame_info->rects_offset + i * sizeof(qgf_delta_rect_v1_t)) < 0) {
+                qp_dprintf("qp_drawimage_recolor: fail (could not seek to delta rect %d)\n", (int)i);
+                ret = false;
+                break;
+            }
+            if (qp_stream_read(&rect, sizeof(qgf_delta_rect_v1_t), 1, &qgf_image->stream) != 1) {
+                qp_dprintf("qp_drawimage_recolor: fail (could not read delta rect %d)\n", (int)i);
+                ret = false;
+                break;
+            }
+            if (qp_stream_setpos(&qgf_image->stream, data_pos) < 0) {
+                qp_dprintf("qp_drawimage_recolor: fail (could not return to pixel data)\n");
+                ret = false;
+                break;
+            }
+
+            if (!driver->driver_vtable->viewport(device, x + rect.left, y + rect.top, x + rect.right, y + rect.bottom)) {
+                qp_dprintf("qp_drawimage_recolor: fail (could not set viewport)\n");
+                ret = false;
+                break;
+            }
+
+            uint32_t pixel_count = ((uint32_t)(rect.right - rect.left + 1)) * (rect.bottom - rect.top + 1);
+            ret                  = qp_internal_appender(device, frame_info->bpp, pixel_count, input_callback, &input_state);
+        }
+    } else {
+        uint16_t l, t, r, b;
+        if (frame_info->is_delta) {
+            l = x + frame_info->left;
+            t = y + frame_info->top;
+            r = x + frame_info->right;
+            b = y + frame_info->bottom;
+        } else {
+            l = x;
+            t = y;
+            r = x + image->width - 1;
+            b = y + image->height - 1;
+        }
+        uint32_t pixel_count = ((uint32_t)(r - l + 1)) * (b - t + 1);
+
+        // Configure where we're going to be rendering to
+        if (!driver->driver_vtable->viewport(device, l, t, r, b)) {
+            qp_dprintf("qp_drawimage_recolor: fail (could not set viewport)\n");
+            qp_comms_stop(device);
+            return false;
+        }
+
+        // Decode and stream pixels
+        ret = qp_internal_appender(device, frame_info->bpp, pixel_count, input_callback, &input_state);
+    }
 
     qp_dprintf("qp_drawimage_recolor: %s\n", ret ? "ok" : "fail");
     qp_comms_stop(device);
@@ -36,6 +36,74 @@ typedef struct qff_font_handle_t {
 
 static qff_font_handle_t font_descriptors[QUANTUM_PAINTER_NUM_FONTS] = {0};
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Glyph cache
+
+#if QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES > 0
+
+// Glyph data already converted to the panel's native pixel format, ready to be sent with a single pixdata call
+typedef struct qp_glyph_cache_entry_t {
+    painter_device_t   device;
+    qff_font_handle_t *font; // NULL if the entry is unused
+    uint32_t           code_point;
+    qp_pixel_t         fg_hsv888;
+    qp_pixel_t         bg_hsv888;
+    uint32_t           last_used;
+    __attribute__((__aligned__(4))) uint8_t pixdata[QUANTUM_PAINTER_GLYPH_CACHE_ENTRY_SIZE];
+} qp_glyph_cache_entry_t;
+
+static qp_glyph_cache_entry_t glyph_cache[QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES] = {0};
+static uint32_t               glyph_cache_counter                              = 0;
+
+static qp_glyph_cache_entry_t *qp_glyph_cache_find(painter_device_t device, qff_font_handle_t *qff_font, uint32_t code_point, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888) {
+    for (int i = 0; i < QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES; ++i) {
+        qp_glyph_cache_entry_t *entry = &glyph_cache[i];
+        if (entry->font == qff_font && entry->device == device && entry->code_point == code_point && memcmp(&entry->fg_hsv888.hsv888, &fg_hsv888.hsv888, sizeof(fg_hsv888.hsv888)) == 0 && memcmp(&entry->bg_hsv888.hsv888, &bg_hsv888.hsv888, sizeof(bg_hsv888.hsv888)) == 0) {
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+// Returns an unused entry if available, otherwise the least-recently-used one
+static qp_glyph_cache_entry_t *qp_glyph_cache_evict(void) {
+    qp_glyph_cache_entry_t *victim = &glyph_cache[0];
+    for (int i = 0; i < QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES; ++i) {
+        qp_glyph_cache_entry_t *entry = &glyph_cache[i];
+        if (entry->font == NULL) {
+            return entry;
+        }
+        if ((int32_t)(entry->last_used - victim->last_used) < 0) {
+            victim = entry;
+        }
+    }
+    victim->font = NULL;
+    return victim;
+}
+
+static void qp_glyph_cache_invalidate_font(qff_font_handle_t *qff_font) {
+    for (int i = 0; i < QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES; ++i) {
+        if (glyph_cache[i].font == qff_font) {
+            glyph_cache[i].font = NULL;
+        }
+    }
+}
+
+// Output state/callback used to decode a glyph into a cache entry instead of the global pixdata buffer
+typedef struct qp_glyph_cache_output_state_t {
+    painter_device_t device;
+    uint8_t *        target_buffer;
+    uint32_t         pixel_write_pos;
+} qp_glyph_cache_output_state_t;
+
+static bool qp_glyph_cache_pixel_appender(qp_pixel_t *palette, uint8_t index, void *cb_arg) {
+    qp_glyph_cache_output_state_t *state  = (qp_glyph_cache_output_state_t *)cb_arg;
+    painter_driver_t *             driver = (painter_driver_t *)state->device;
+    return driver->driver_vtable->append_pixels(state->device, state->target_buffer, palette, state->pixel_write_pos++, 1, &index);
+}
+
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES > 0
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Helper: load font from stream
 
@@ -151,6 +219,11 @@ bool qp_close_font(painter_font_handle_t font) {
     }
 #endif // QUANTUM_PAINTER_LOAD_FONTS_TO_RAM
 
+#if QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES > 0
+    // Font slots get reused, so any cached glyphs are no longer valid
+    qp_glyph_cache_invalidate_font(qff_font);
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES > 0
+
     // Free up this font for use elsewhere.
     qp_stream_close(&qff_font->stream);
     qff_font->validate_ok = false;
@@ -164,6 +237,7 @@ bool qp_close_font(painter_font_handle_t font) {
 typedef bool (*code_point_handler)(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t width, uint8_t height, void *cb_arg);
 
 // Helper that sets up the palette (if required) and returns the offset in the stream that the data starts
+// Comms are owned by the caller, which is responsible for stopping them on failure
 static inline bool qp_drawtext_prepare_font_for_render(painter_device_t device, qff_font_handle_t *qff_font, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, uint32_t *data_offset) {
     painter_driver_t *driver = (painter_driver_t *)device;
 
@@ -205,7 +279,6 @@ static inline bool qp_drawtext_prepare_font_for_render(painter_device_t device,
         // Convert the palette to native format
         if (!driver->driver_vtable->palette_convert(device, palette_entries, qp_internal_global_pixel_lookup_table)) {
             qp_dprintf("qp_drawtext_recolor: fail (could not convert pixels to native)\n");
-            qp_comms_stop(device);
             return false;
         }
     }
@@ -345,8 +418,70 @@ typedef struct code_point_iter_drawglyph_state_t {
     qp_internal_byte_input_callback   input_callback;
     qp_internal_byte_input_state_t *  input_state;
     qp_internal_pixel_output_state_t *output_state;
+#if QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES > 0
+    qp_pixel_t fg_hsv888;
+    qp_pixel_t bg_hsv888;
+    bool       palette_prepared;
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES > 0
 } code_point_iter_drawglyph_state_t;
 
+#if QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES > 0
+// Palette preparation is deferred until the first glyph that actually needs decoding, so fully-cached strings skip it
+static inline bool qp_drawtext_ensure_palette(code_point_iter_drawglyph_state_t *state, qff_font_handle_t *qff_font) {
+    if (state->palette_prepared) {
+        return true;
+    }
+
+    // Preparing the palette moves the stream, so restore the glyph position afterwards
+    int32_t  glyph_pos = qp_stream_tell(&qff_font->stream);
+    uint32_t data_offset;
+    if (!qp_drawtext_prepare_font_for_render(state->device, qff_font, state->fg_hsv888, state->bg_hsv888, &data_offset)) {
+        qp_dprintf("Failed to prepare font for rendering.\n");
+        return false;
+    }
+    if (qp_stream_setpos(&qff_font->stream, glyph_pos) < 0) {
+        qp_dprintf("Failed to restore stream position after preparing font\n");
+        return false;
+    }
+
+    state->palette_prepared = true;
+    return true;
+}
+
+// Draws the glyph from the cache, decoding it into a new cache entry first if required
+static inline bool qp_drawtext_drawglyph_cached(code_point_iter_drawglyph_state_t *state, qff_font_handle_t *qff_font, uint32_t code_point, uint32_t pixel_count) {
+    painter_driver_t *driver = (painter_driver_t *)state->device;
+
+    // Colors are irrelevant for fonts with their own palette, so don't let them split the cache
+    qp_pixel_t fg_hsv888 = qff_font->has_palette ? (qp_pixel_t){.dummy = 0} : state->fg_hsv888;
+    qp_pixel_t bg_hsv888 = qff_font->has_palette ? (qp_pixel_t){.dummy = 0} : state->bg_hsv888;
+
+    qp_glyph_cache_entry_t *entry = qp_glyph_cache_find(state->device, qff_font, code_point, fg_hsv888, bg_hsv888);
+    if (entry == NULL) {
+        if (!qp_drawtext_ensure_palette(state, qff_font)) {
+            return false;
+        }
+
+        entry = qp_glyph_cache_evict();
+
+        // Decode the pixel data for the glyph into the cache entry
+        qp_glyph_cache_output_state_t output_state = {.device = state->device, .target_buffer = entry->pixdata, .pixel_write_pos = 0};
+        if (!qp_internal_decode_palette(state->device, pixel_count, qff_font->bpp, state->input_callback, state->input_state, qp_internal_global_pixel_lookup_table, qp_glyph_cache_pixel_appender, &output_state)) {
+            return false;
+        }
+
+        entry->device     = state->device;
+        entry->font       = qff_font;
+        entry->code_point = code_point;
+        entry->fg_hsv888  = fg_hsv888;
+        entry->bg_hsv888  = bg_hsv888;
+    }
+
+    entry->last_used = ++glyph_cache_counter;
+    return driver->driver_vtable->pixdata(state->device, entry->pixdata, pixel_count);
+}
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES > 0
+
 // Codepoint handler callback: drawing
 static inline bool qp_font_code_point_handler_drawglyph(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t width, uint8_t height, void *cb_arg) {
     code_point_iter_drawglyph_state_t *state  = (code_point_iter_drawglyph_state_t *)cb_arg;
@@ -364,8 +499,20 @@ static inline bool qp_font_code_point_handler_drawglyph(qff_font_handle_t *qff_f
     // Move the x-position for the next glyph
     state->xpos += width;
 
-    // Decode the pixel data for the glyph, and stream it
     uint32_t pixel_count = ((uint32_t)width) * height;
+
+#if QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES > 0
+    // Only palette-based glyphs are cached, native-format glyphs are already streamed as-is
+    if (qff_font->bpp <= 8 && ((pixel_count * driver->native_bits_per_pixel + 7) / 8) <= (QUANTUM_PAINTER_GLYPH_CACHE_ENTRY_SIZE)) {
+        return qp_drawtext_drawglyph_cached(state, qff_font, code_point, pixel_count);
+    }
+
+    if (!qp_drawtext_ensure_palette(state, qff_font)) {
+        return false;
+    }
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES > 0
+
+    // Decode the pixel data for the glyph, and stream it
     return qp_internal_appender(state->device, qff_font->bpp, pixel_count, state->input_callback, state->input_state);
 }
 
@@ -441,12 +588,19 @@ int16_t qp_drawtext_recolor(painter_device_t device, uint16_t x, uint16_t y, pai
 
     qp_pixel_t fg_hsv888 = {.hsv888 = {.h = hue_fg, .s = sat_fg, .v = val_fg}};
     qp_pixel_t bg_hsv888 = {.hsv888 = {.h = hue_bg, .s = sat_bg, .v = val_bg}};
-    uint32_t   data_offset;
+#if QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES > 0
+    // Palette preparation is deferred to the first glyph missing the cache
+    state.fg_hsv888        = fg_hsv888;
+    state.bg_hsv888        = bg_hsv888;
+    state.palette_prepared = false;
+#else  // QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES > 0
+    uint32_t data_offset;
     if (!qp_drawtext_prepare_font_for_render(driver, qff_font, fg_hsv888, bg_hsv888, &data_offset)) {
         qp_dprintf("qp_drawtext_recolor: fail (failed to prepare font for rendering)\n");
         qp_comms_stop(device);
         return false;
     }
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES > 0
 
     // Iterate the codepoints with the drawglyph callback
     bool ret = qp_iterate_code_points(qff_font, str, qp_font_code_point_handler_drawglyph, &state);
@@ -0,0 +1,83 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <cstdio>
+#include <functional>
+
+#include "qp_test_common.hpp"
+
+uint16_t QuantumPainterTest::framebuffer[QuantumPainterTest::width * QuantumPainterTest::height];
+
+class QuantumPainterBenchmark : public QuantumPainterTest {
+   protected:
+    // Repeatedly invokes the supplied draw operation, reporting the throughput in pixels per second
+    void benchmark(const char *name, uint32_t pixels_per_iteration, const std::function<bool(void)> &draw) {
+        constexpr int iterations = 2000;
+        auto          start      = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; ++i) {
+            ASSERT_TRUE(draw());
+        }
+        auto   end     = std::chrono::steady_clock::now();
+        double seconds = std::chrono::duration<double>(end - start).count();
+        double rate    = (double)pixels_per_iteration * iterations / (seconds > 0 ? seconds : 1e-9);
+        printf("[ BENCH    ] %-24s %12.0f pixels/s\n", name, rate);
+        EXPECT_GT(rate, 0);
+    }
+};
+
+TEST_F(QuantumPainterBenchmark, RectFilled) {
+    benchmark("qp_rect (filled)", width * height, [this]() { return qp_rect(device, 0, 0, width - 1, height - 1, 0, 0, 255, true); });
+}
+
+TEST_F(QuantumPainterBenchmark, RectOutline) {
+    benchmark("qp_rect (outline)", 2 * (width + height) - 4, [this]() { return qp_rect(device, 0, 0, width - 1, height - 1, 0, 0, 255, false); });
+}
+
+TEST_F(QuantumPainterBenchmark, CircleFilled) {
+    // Measured against the bounding box
+    benchmark("qp_circle (filled)", 31 * 31, [this]() { return qp_circle(device, 15, 15, 15, 0, 0, 255, true); });
+}
+
+TEST_F(QuantumPainterBenchmark, EllipseFilled) {
+    // Measured against the bounding box
+    benchmark("qp_ellipse (filled)", 61 * 29, [this]() { return qp_ellipse(device, 30, 14, 30, 14, 0, 0, 255, true); });
+}
+
+TEST_F(QuantumPainterBenchmark, DrawImage1bpp) {
+    painter_image_handle_t image = qp_load_image_mem(gfx_test_checker_1bpp);
+    ASSERT_NE(image, nullptr);
+    benchmark("qp_drawimage (1bpp)", image->width * image->height, [this, image]() { return qp_drawimage(device, 0, 0, image); });
+    qp_close_image(image);
+}
+
+TEST_F(QuantumPainterBenchmark, DrawImage2bppRLE) {
+    painter_image_handle_t image = qp_load_image_mem(gfx_test_gradient_2bpp);
+    ASSERT_NE(image, nullptr);
+    benchmark("qp_drawimage (2bpp RLE)", image->width * image->height, [this, image]() { return qp_drawimage(device, 0, 0, image); });
+    qp_close_image(image);
+}
+
+TEST_F(QuantumPainterBenchmark, DrawText) {
+    painter_font_handle_t font = qp_load_font_mem(font_thintel15);
+    ASSERT_NE(font, nullptr);
+    static const char *text  = "0123456789";
+    int16_t            width = qp_textwidth(font, text);
+    benchmark("qp_drawtext", width * font->line_height, [this, font]() { return qp_drawtext(device, 0, 0, font, text) > 0; });
+    qp_close_font(font);
+}
+
+TEST_F(QuantumPainterBenchmark, Animate) {
+    painter_image_handle_t image = qp_load_image_mem(gfx_test_anim_1bpp);
+    ASSERT_NE(image, nullptr);
+    deferred_token token = qp_animate(device, 0, 0, image);
+    ASSERT_NE(token, INVALID_DEFERRED_TOKEN);
+    // Delta frames only cover part of the image, so this is measured against the full frame size
+    benchmark("qp_animate (per frame)", image->width * image->height, []() {
+        advance_time(100);
+        qp_internal_animation_tick();
+        return true;
+    });
+    qp_stop_animation(token);
+    qp_close_image(image);
+}
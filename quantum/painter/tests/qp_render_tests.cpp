@@ -0,0 +1,433 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+
+#include "qp_test_common.hpp"
+
+extern "C" {
+#include "qp_draw.h"
+#include "qp_surface_internal.h"
+}
+
+uint16_t QuantumPainterTest::framebuffer[QuantumPainterTest::width * QuantumPainterTest::height];
+
+class QuantumPainterRender : public QuantumPainterTest {};
+
+TEST_F(QuantumPainterRender, InitClearsSurface) {
+    for (uint16_t y = 0; y < height; ++y) {
+        for (uint16_t x = 0; x < width; ++x) {
+            EXPECT_EQ(pixel(x, y), 0x0000);
+        }
+    }
+}
+
+TEST_F(QuantumPainterRender, SetPixel) {
+    EXPECT_TRUE(qp_setpixel(device, 3, 2, 0, 0, 255));
+    EXPECT_EQ(pixel(3, 2), 0xFFFF);
+    EXPECT_EQ(pixel(2, 2), 0x0000);
+    EXPECT_EQ(pixel(3, 3), 0x0000);
+}
+
+TEST_F(QuantumPainterRender, RectFilled) {
+    EXPECT_TRUE(qp_rect(device, 1, 1, 4, 2, 0, 0, 255, true));
+    EXPECT_EQ(ascii(0, 0, 5, 3), golden({
+                                     "......",
+                                     ".####.",
+                                     ".####.",
+                                     "......",
+                                 }));
+}
+
+TEST_F(QuantumPainterRender, RectOutline) {
+    EXPECT_TRUE(qp_rect(device, 0, 0, 5, 4, 0, 0, 255, false));
+    EXPECT_EQ(ascii(0, 0, 6, 5), golden({
+                                     "######.",
+                                     "#....#.",
+                                     "#....#.",
+                                     "#....#.",
+                                     "######.",
+                                     ".......",
+                                 }));
+}
+
+TEST_F(QuantumPainterRender, RectColor) {
+    // Pure red in HSV
+    EXPECT_TRUE(qp_rect(device, 0, 0, 1, 1, 0, 255, 255, true));
+    EXPECT_EQ(pixel(0, 0), 0xF800);
+    EXPECT_EQ(pixel(1, 1), 0xF800);
+    EXPECT_EQ(pixel(2, 2), 0x0000);
+}
+
+TEST_F(QuantumPainterRender, Line) {
+    EXPECT_TRUE(qp_line(device, 0, 0, 5, 5, 0, 0, 255));
+    EXPECT_EQ(ascii(0, 0, 5, 5), golden({
+                                     "#.....",
+                                     ".#....",
+                                     "..#...",
+                                     "...#..",
+                                     "....#.",
+                                     ".....#",
+                                 }));
+}
+
+TEST_F(QuantumPainterRender, CircleOutline) {
+    EXPECT_TRUE(qp_circle(device, 4, 4, 4, 0, 0, 255, false));
+    EXPECT_EQ(ascii(0, 0, 8, 8), golden({
+                                     "....#....",
+                                     "..##.##..",
+                                     ".#.....#.",
+                                     ".#.....#.",
+                                     "#.......#",
+                                     ".#.....#.",
+                                     ".#.....#.",
+                                     "..##.##..",
+                                     "....#....",
+                                 }));
+}
+
+TEST_F(QuantumPainterRender, CircleFilled) {
+    EXPECT_TRUE(qp_circle(device, 4, 4, 4, 0, 0, 255, true));
+    EXPECT_EQ(ascii(0, 0, 8, 8), golden({
+                                     "....#....",
+                                     "..#####..",
+                                     ".#######.",
+                                     ".#######.",
+                                     "#########",
+                                     ".#######.",
+                                     ".#######.",
+                                     "..#####..",
+                                     "....#....",
+                                 }));
+}
+
+TEST_F(QuantumPainterRender, EllipseOutline) {
+    EXPECT_TRUE(qp_ellipse(device, 6, 3, 6, 3, 0, 0, 255, false));
+    EXPECT_EQ(ascii(0, 0, 12, 6), golden({
+                                      "...#######...",
+                                      ".##.......##.",
+                                      "#...........#",
+                                      "#...........#",
+                                      "#...........#",
+                                      ".##.......##.",
+                                      "...#######...",
+                                  }));
+}
+
+TEST_F(QuantumPainterRender, EllipseFilled) {
+    EXPECT_TRUE(qp_ellipse(device, 6, 3, 6, 3, 0, 0, 255, true));
+    EXPECT_EQ(ascii(0, 0, 12, 6), golden({
+                                      "...#######...",
+                                      ".###########.",
+                                      "#############",
+                                      "#############",
+                                      "#############",
+                                      ".###########.",
+                                      "...#######...",
+                                  }));
+}
+
+TEST_F(QuantumPainterRender, EllipseFilledIgnoresStalePixdata) {
+    // Leave the shared pixdata buffer full of red, then clear the surface
+    EXPECT_TRUE(qp_rect(device, 0, 0, width - 1, height - 1, 0, 255, 255, true));
+    EXPECT_TRUE(qp_rect(device, 0, 0, width - 1, height - 1, 0, 0, 0, true));
+
+    // Rows of a filled ellipse are up to twice its radius wide, all of which must be in the requested color
+    EXPECT_TRUE(qp_ellipse(device, 20, 6, 20, 6, 0, 0, 255, true));
+    for (uint16_t y = 0; y <= 12; ++y) {
+        for (uint16_t x = 0; x <= 40; ++x) {
+            EXPECT_NE(pixel(x, y), 0xF800) << "Stale pixel at " << x << "," << y;
+        }
+    }
+    EXPECT_EQ(pixel(0, 6), 0xFFFF);
+    EXPECT_EQ(pixel(40, 6), 0xFFFF);
+}
+
+TEST_F(QuantumPainterRender, DrawImage1bpp) {
+    painter_image_handle_t image = qp_load_image_mem(gfx_test_checker_1bpp);
+    ASSERT_NE(image, nullptr);
+    EXPECT_EQ(image->width, 16);
+    EXPECT_EQ(image->height, 8);
+    EXPECT_EQ(image->frame_count, 1);
+
+    EXPECT_TRUE(qp_drawimage(device, 1, 1, image));
+    EXPECT_EQ(ascii(0, 0, 17, 9), golden({
+                                      "..................",
+                                      ".################.",
+                                      ".#..............#.",
+                                      ".#.##..##..##...#.",
+                                      ".#.##..##..##...#.",
+                                      ".#...##..##..##.#.",
+                                      ".#...##..##..##.#.",
+                                      ".#..............#.",
+                                      ".################.",
+                                      "..................",
+                                  }));
+    EXPECT_TRUE(qp_close_image(image));
+}
+
+TEST_F(QuantumPainterRender, DrawImage2bppRLE) {
+    painter_image_handle_t image = qp_load_image_mem(gfx_test_gradient_2bpp);
+    ASSERT_NE(image, nullptr);
+
+    EXPECT_TRUE(qp_drawimage(device, 0, 0, image));
+    EXPECT_EQ(ascii(0, 0, 11, 11), golden({
+                                       ".........-+#",
+                                       ".........-+#",
+                                       ".........-+#",
+                                       "--------.-+#",
+                                       "--------.-+#",
+                                       "--------.-+#",
+                                       "++++++++.-+#",
+                                       "++++++++.-+#",
+                                       "++++++++.-+#",
+                                       "########.-+#",
+                                       "########.-+#",
+                                       "########.-+#",
+                                   }));
+    EXPECT_TRUE(qp_close_image(image));
+}
+
+TEST_F(QuantumPainterRender, DrawImageRecolor) {
+    painter_image_handle_t image = qp_load_image_mem(gfx_test_checker_1bpp);
+    ASSERT_NE(image, nullptr);
+
+    // Foreground red, background blue
+    EXPECT_TRUE(qp_drawimage_recolor(device, 0, 0, image, 0, 255, 255, 170, 255, 255));
+    EXPECT_EQ(pixel(0, 0), 0xF800);
+    EXPECT_EQ(pixel(1, 1), 0x001F);
+    EXPECT_TRUE(qp_close_image(image));
+}
+
+TEST_F(QuantumPainterRender, DrawText) {
+    painter_font_handle_t font = qp_load_font_mem(font_thintel15);
+    ASSERT_NE(font, nullptr);
+    EXPECT_EQ(font->line_height, 11);
+
+    int16_t width = qp_textwidth(font, "Hi1");
+    EXPECT_GT(width, 0);
+    EXPECT_EQ(qp_drawtext(device, 0, 0, font, "Hi1"), width);
+    EXPECT_EQ(ascii(0, 0, width, 10), golden({
+                                          "............",
+                                          "#..#....#...",
+                                          "#..#.#.##...",
+                                          "#..#....#...",
+                                          "####.#..#...",
+                                          "#..#.#..#...",
+                                          "#..#.#..#...",
+                                          "#..#.#.###..",
+                                          "............",
+                                          "............",
+                                          "............",
+                                      }));
+    EXPECT_TRUE(qp_close_font(font));
+}
+
+TEST_F(QuantumPainterRender, DrawTextRepeated) {
+    painter_font_handle_t font = qp_load_font_mem(font_thintel15);
+    ASSERT_NE(font, nullptr);
+
+    // Redraws must be identical, whether or not glyphs are served from the glyph cache
+    int16_t width = qp_drawtext(device, 0, 0, font, "88");
+    ASSERT_GT(width, 0);
+    const std::string first = ascii(0, 0, width - 1, font->line_height - 1);
+    EXPECT_TRUE(qp_rect(device, 0, 0, width - 1, font->line_height - 1, 0, 0, 0, true));
+    EXPECT_EQ(qp_drawtext(device, 0, 0, font, "88"), width);
+    EXPECT_EQ(ascii(0, 0, width - 1, font->line_height - 1), first);
+
+    // Recoloring the same glyphs must not reuse the previously-rendered colors
+    EXPECT_EQ(qp_drawtext_recolor(device, 0, 0, font, "88", 0, 255, 255, 0, 0, 0), width);
+    bool found_red = false;
+    for (uint16_t y = 0; y < font->line_height; ++y) {
+        for (uint16_t x = 0; x < width; ++x) {
+            EXPECT_NE(pixel(x, y), 0xFFFF);
+            found_red |= pixel(x, y) == 0xF800;
+        }
+    }
+    EXPECT_TRUE(found_red);
+
+    // Closing and reloading the font must not serve stale glyphs
+    EXPECT_TRUE(qp_close_font(font));
+    font = qp_load_font_mem(font_thintel15);
+    ASSERT_NE(font, nullptr);
+    EXPECT_EQ(qp_drawtext(device, 0, 0, font, "88"), width);
+    EXPECT_EQ(ascii(0, 0, width - 1, font->line_height - 1), first);
+    EXPECT_TRUE(qp_close_font(font));
+}
+
+static int                   comms_stop_count;
+static const painter_comms_vtable_t *original_comms_vtable;
+
+static void counting_comms_stop(painter_device_t device) {
+    ++comms_stop_count;
+    original_comms_vtable->comms_stop(device);
+}
+
+static bool failing_palette_convert(painter_device_t device, int16_t palette_size, qp_pixel_t *palette) {
+    return false;
+}
+
+TEST_F(QuantumPainterRender, DrawTextPaletteFailureStopsCommsOnce) {
+    painter_font_handle_t font = qp_load_font_mem(font_thintel15);
+    ASSERT_NE(font, nullptr);
+
+    // Swap in vtables which fail palette conversion and count comms stops
+    painter_driver_t *              driver          = (painter_driver_t *)device;
+    const painter_driver_vtable_t * original_driver = driver->driver_vtable;
+    surface_painter_driver_vtable_t driver_vtable   = *(const surface_painter_driver_vtable_t *)original_driver;
+    driver_vtable.base.palette_convert              = failing_palette_convert;
+    original_comms_vtable                           = driver->comms_vtable;
+    painter_comms_vtable_t comms_vtable             = *original_comms_vtable;
+    comms_vtable.comms_stop                         = counting_comms_stop;
+    driver->driver_vtable                           = &driver_vtable.base;
+    driver->comms_vtable                            = &comms_vtable;
+
+    qp_internal_invalidate_palette();
+    comms_stop_count = 0;
+    EXPECT_EQ(qp_drawtext_recolor(device, 0, 0, font, "Hi", 85, 255, 255, 0, 0, 0), 0);
+    EXPECT_EQ(comms_stop_count, 1);
+
+    driver->driver_vtable = original_driver;
+    driver->comms_vtable  = original_comms_vtable;
+    qp_internal_invalidate_palette();
+    EXPECT_TRUE(qp_close_font(font));
+}
+
+TEST_F(QuantumPainterRender, Animate) {
+    painter_image_handle_t image = qp_load_image_mem(gfx_test_anim_1bpp);
+    ASSERT_NE(image, nullptr);
+    EXPECT_EQ(image->frame_count, 3);
+
+    deferred_token token = qp_animate(device, 0, 0, image);
+    ASSERT_NE(token, INVALID_DEFERRED_TOKEN);
+
+    const std::string frame0 = golden({
+        "........",
+        "........",
+        "........",
+        ".##.....",
+        ".##.....",
+        "........",
+        "........",
+        "........",
+    });
+    const std::string frame1 = golden({
+        "........",
+        "........",
+        "........",
+        "...##...",
+        "...##...",
+        "........",
+        "........",
+        "........",
+    });
+    const std::string frame2 = golden({
+        "........",
+        "........",
+        "........",
+        ".....##.",
+        ".....##.",
+        "........",
+        "........",
+        "........",
+    });
+
+    EXPECT_EQ(ascii(0, 0, 7, 7), frame0);
+
+    // Not yet time for the next frame
+    advance_time(50);
+    qp_internal_animation_tick();
+    EXPECT_EQ(ascii(0, 0, 7, 7), frame0);
+
+    advance_time(50);
+    qp_internal_animation_tick();
+    EXPECT_EQ(ascii(0, 0, 7, 7), frame1);
+
+    advance_time(100);
+    qp_internal_animation_tick();
+    EXPECT_EQ(ascii(0, 0, 7, 7), frame2);
+
+    // Wraps back to the first (full) frame
+    advance_time(100);
+    qp_internal_animation_tick();
+    EXPECT_EQ(ascii(0, 0, 7, 7), frame0);
+
+    qp_stop_animation(token);
+    advance_time(100);
+    qp_internal_animation_tick();
+    EXPECT_EQ(ascii(0, 0, 7, 7), frame0);
+
+    EXPECT_TRUE(qp_close_image(image));
+}
+
+TEST_F(QuantumPainterRender, AnimateDeltaRects) {
+    painter_image_handle_t image = qp_load_image_mem(gfx_test_anim_rects_1bpp);
+    ASSERT_NE(image, nullptr);
+    EXPECT_EQ(image->frame_count, 2);
+
+    deferred_token token = qp_animate(device, 0, 0, image);
+    ASSERT_NE(token, INVALID_DEFERRED_TOKEN);
+    EXPECT_EQ(ascii(0, 0, 15, 7), golden({
+                                      "................",
+                                      ".#..............",
+                                      "................",
+                                      "................",
+                                      "................",
+                                      "................",
+                                      "..............#.",
+                                      "................",
+                                  }));
+
+    // Paint over the image; only the dirty rectangles of the delta frame should be redrawn
+    EXPECT_TRUE(qp_rect(device, 0, 0, 15, 7, 0, 0, 150, true));
+    advance_time(100);
+    qp_internal_animation_tick();
+    EXPECT_EQ(ascii(0, 0, 15, 7), golden({
+                                      "++++++++++++++++",
+                                      "+..+++++++++++++",
+                                      "+.#+++++++++++++",
+                                      "++++++++++++++++",
+                                      "++++++++++++++++",
+                                      "+++++++++++++#.+",
+                                      "+++++++++++++..+",
+                                      "++++++++++++++++",
+                                  }));
+
+    qp_stop_animation(token);
+    EXPECT_TRUE(qp_close_image(image));
+}
+
+TEST_F(QuantumPainterRender, DeltaRectsOutsideImageRejected) {
+    const std::vector<uint8_t> original(gfx_test_anim_rects_1bpp, gfx_test_anim_rects_1bpp + gfx_test_anim_rects_1bpp_length);
+
+    // Locate the delta descriptor and the first dirty rect
+    const uint8_t delta_header[] = {0x04, 0xFB, 0x08, 0x00, 0x00};
+    const uint8_t rects_header[] = {0x06, 0xF9, 0x10, 0x00, 0x00};
+    auto          delta          = std::search(original.begin(), original.end(), std::begin(delta_header), std::end(delta_header)) - original.begin() + sizeof(delta_header);
+    auto          rect           = std::search(original.begin(), original.end(), std::begin(rects_header), std::end(rects_header)) - original.begin() + sizeof(rects_header);
+    ASSERT_LT(delta, original.size());
+    ASSERT_LT(rect, original.size());
+
+    auto loads = [](std::vector<uint8_t> data) {
+        painter_image_handle_t image = qp_load_image_mem(data.data());
+        if (image) {
+            qp_close_image(image);
+        }
+        return image != nullptr;
+    };
+    ASSERT_TRUE(loads(original));
+
+    // Each field is little-endian: left, top, right, bottom
+    auto patched = [&original](size_t offset, size_t field, uint16_t value) {
+        std::vector<uint8_t> data    = original;
+        data[offset + field * 2]     = value & 0xFF;
+        data[offset + field * 2 + 1] = value >> 8;
+        return data;
+    };
+    EXPECT_FALSE(loads(patched(rect, 2, 0))) << "Rect with right < left should be rejected";
+    EXPECT_FALSE(loads(patched(rect, 3, 0))) << "Rect with bottom < top should be rejected";
+    EXPECT_FALSE(loads(patched(rect, 2, 16))) << "Rect beyond the image width should be rejected";
+    EXPECT_FALSE(loads(patched(rect, 3, 8))) << "Rect beyond the image height should be rejected";
+    EXPECT_FALSE(loads(patched(delta, 2, 0))) << "Inverted delta area should be rejected";
+    EXPECT_FALSE(loads(patched(delta, 3, 0xFFFF))) << "Delta area beyond the image should be rejected";
+}
@@ -0,0 +1,29 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern const uint32_t gfx_test_checker_1bpp_length;
+extern const uint8_t  gfx_test_checker_1bpp[];
+
+extern const uint32_t gfx_test_gradient_2bpp_length;
+extern const uint8_t  gfx_test_gradient_2bpp[];
+
+extern const uint32_t gfx_test_anim_1bpp_length;
+extern const uint8_t  gfx_test_anim_1bpp[];
+
+extern const uint32_t gfx_test_anim_rects_1bpp_length;
+extern const uint8_t  gfx_test_anim_rects_1bpp[];
+
+extern const uint32_t font_thintel15_length;
+extern const uint8_t  font_thintel15[];
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,68 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "qp.h"
+#include "timer.h"
+#include "qp_test_assets.h"
+
+painter_device_t qp_make_rgb565_surface(uint16_t panel_width, uint16_t panel_height, void *buffer);
+void             qp_internal_animation_tick(void);
+void             advance_time(uint32_t ms);
+}
+
+// Host-side render target: an RGB565 surface backed by an in-memory framebuffer
+class QuantumPainterTest : public ::testing::Test {
+   public:
+    static constexpr uint16_t width  = 64;
+    static constexpr uint16_t height = 32;
+
+   protected:
+    void SetUp() override {
+        // Surfaces are allocated from a fixed-size table, so the same device is reused across tests
+        static painter_device_t surface = qp_make_rgb565_surface(width, height, framebuffer);
+        device                          = surface;
+        ASSERT_NE(device, nullptr);
+        ASSERT_TRUE(qp_init(device, QP_ROTATION_0));
+        // The animation executor keeps its own last-execution time, so only ever move the clock forwards
+        advance_time(1000);
+    }
+
+    uint16_t pixel(uint16_t x, uint16_t y) const {
+        // The surface stores pixels byte-swapped, ready for SPI transmission
+        return __builtin_bswap16(framebuffer[y * width + x]);
+    }
+
+    // Renders the supplied region as ASCII art, one character per pixel, based on green-channel brightness
+    std::string ascii(uint16_t l, uint16_t t, uint16_t r, uint16_t b) const {
+        static const char levels[] = ".-+#";
+        std::string       out;
+        for (uint16_t y = t; y <= b; ++y) {
+            for (uint16_t x = l; x <= r; ++x) {
+                uint8_t g6 = (pixel(x, y) >> 5) & 0x3F;
+                out += levels[g6 >> 4];
+            }
+            out += '\n';
+        }
+        return out;
+    }
+
+    static std::string golden(const std::vector<std::string> &rows) {
+        std::string out;
+        for (auto &row : rows) {
+            out += row + '\n';
+        }
+        return out;
+    }
+
+    painter_device_t device = nullptr;
+    static uint16_t  framebuffer[width * height];
+};
@@ -0,0 +1,63 @@
+# qp_render deliberately enables no panel drivers, so it also covers surface-only builds with no registered devices
+qp_render_DEFS := \
+	-DMATRIX_ROWS=1 \
+	-DMATRIX_COLS=1 \
+	-DNO_PRINT \
+	-DNO_DEBUG \
+	-DQUANTUM_PAINTER_ENABLE \
+	-DQUANTUM_PAINTER_ANIMATIONS_ENABLE \
+	-DQUANTUM_PAINTER_SURFACE_ENABLE \
+	-DQUANTUM_PAINTER_DUMMY_COMMS_ENABLE \
+	-DQUANTUM_PAINTER_DISPLAY_TIMEOUT=0 \
+	-DQUANTUM_PAINTER_DEBUG_ENABLE_FLUSH_TASK_OUTPUT
+
+qp_common_SRC := \
+	$(QUANTUM_PATH)/unicode/utf8.c \
+	$(QUANTUM_PATH)/color.c \
+	$(QUANTUM_PATH)/deferred_exec.c \
+	$(QUANTUM_PATH)/painter/qp.c \
+	$(QUANTUM_PATH)/painter/qp_internal.c \
+	$(QUANTUM_PATH)/painter/qp_stream.c \
+	$(QUANTUM_PATH)/painter/qgf.c \
+	$(QUANTUM_PATH)/painter/qff.c \
+	$(QUANTUM_PATH)/painter/qp_draw_core.c \
+	$(QUANTUM_PATH)/painter/qp_draw_codec.c \
+	$(QUANTUM_PATH)/painter/qp_draw_circle.c \
+	$(QUANTUM_PATH)/painter/qp_draw_ellipse.c \
+	$(QUANTUM_PATH)/painter/qp_draw_image.c \
+	$(QUANTUM_PATH)/painter/qp_draw_text.c \
+	$(QUANTUM_PATH)/painter/qp_comms.c \
+	$(DRIVER_PATH)/painter/comms/qp_comms_dummy.c \
+	$(DRIVER_PATH)/painter/generic/qp_surface_common.c \
+	$(DRIVER_PATH)/painter/generic/qp_surface_rgb565.c \
+	$(PLATFORM_PATH)/timer.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c
+
+qp_render_SRC := \
+	$(QUANTUM_PATH)/painter/tests/qp_test_assets.c \
+	$(QUANTUM_PATH)/painter/tests/qp_render_tests.cpp \
+	$(qp_common_SRC)
+
+qp_render_INC := \
+	$(QUANTUM_PATH)/painter \
+	$(QUANTUM_PATH)/painter/tests \
+	$(QUANTUM_PATH)/unicode \
+	$(DRIVER_PATH)/painter/comms \
+	$(DRIVER_PATH)/painter/generic
+
+qp_render_glyph_cache_DEFS := \
+	$(qp_render_DEFS) \
+	-DQUANTUM_PAINTER_GLYPH_CACHE_ENTRIES=16
+qp_render_glyph_cache_SRC := \
+	$(qp_render_SRC)
+qp_render_glyph_cache_INC := \
+	$(qp_render_INC)
+
+qp_benchmark_DEFS := \
+	$(qp_render_DEFS)
+qp_benchmark_SRC := \
+	$(QUANTUM_PATH)/painter/tests/qp_test_assets.c \
+	$(QUANTUM_PATH)/painter/tests/qp_benchmark_tests.cpp \
+	$(qp_common_SRC)
+qp_benchmark_INC := \
+	$(qp_render_INC)
@@ -0,0 +1,6 @@
+TEST_LIST += \
+	qp_render \
+	qp_render_glyph_cache
+
+BENCHMARK_LIST += \
+	qp_benchmark
@@ -189,6 +189,131 @@ __attribute__((weak)) bool apply_autocorrect(uint8_t backspaces, const char *str
     return true;
 }
 
+#if defined(AUTOCORRECT_DATA_VERSION) && AUTOCORRECT_DATA_VERSION >= 2
+typedef uint32_t autocorrect_offset_t;
+
+/**
+ * @brief Reads a 24-bit little endian node link from `autocorrect_data`.
+ *
+ * @param offset byte offset of the link
+ * @return autocorrect_offset_t byte offset of the linked node
+ */
+static inline autocorrect_offset_t autocorrect_read_link(autocorrect_offset_t offset) {
+    return pgm_read_byte(autocorrect_data + offset) | (uint16_t)pgm_read_byte(autocorrect_data + offset + 1) << 8 | (autocorrect_offset_t)pgm_read_byte(autocorrect_data + offset + 2) << 16;
+}
+
+/**
+ * @brief Searches the typo buffer for a typo, walking the DAWG stored in `autocorrect_data`.
+ *
+ * Chain nodes are compared against the buffer a run at a time, and the
+ * sorted keycodes of branch nodes are binary searched.
+ *
+ * @return autocorrect_offset_t byte offset of the matched leaf node, or 0 if there is no typo
+ */
+static autocorrect_offset_t autocorrect_find_typo(void) {
+    autocorrect_offset_t state = 0;
+    int8_t               i     = typo_buffer_size - 1;
+
+    for (;;) {
+        const uint8_t code = pgm_read_byte(autocorrect_data + state);
+
+        if (code & 128) { // A leaf, the root node never is one.
+            return state;
+        }
+
+        const uint8_t count = code & 31;
+        if (code & 64) { // Binary search for the keycode in a branch node.
+            if (i < 0) {
+                return 0;
+            }
+            const uint8_t key_i = typo_buffer[i--];
+            uint8_t       lo = 0, hi = count;
+            while (lo < hi) {
+                const uint8_t mid = (lo + hi) / 2;
+                if (pgm_read_byte(autocorrect_data + state + 1 + mid) < key_i) {
+                    lo = mid + 1;
+                } else {
+                    hi = mid;
+                }
+            }
+            if (lo >= count || pgm_read_byte(autocorrect_data + state + 1 + lo) != key_i) {
+                return 0;
+            }
+
+            // Follow link to child node, the first child may be stored inline after the links.
+            const autocorrect_offset_t links = state + 1 + count;
+            if (!(code & 32)) {
+                state = autocorrect_read_link(links + 3 * lo);
+            } else if (lo) {
+                state = autocorrect_read_link(links + 3 * (lo - 1));
+            } else {
+                state = links + 3 * (count - 1);
+            }
+        } else { // Match a run of keycodes in a chain node.
+            if (count > i + 1) {
+                return 0;
+            }
+            for (uint8_t j = 1; j <= count; ++j) {
+                if (pgm_read_byte(autocorrect_data + state + j) != typo_buffer[i--]) {
+                    return 0;
+                }
+            }
+            state = (code & 32) ? state + 1 + count : autocorrect_read_link(state + 1 + count);
+        }
+
+        // Stop if `state` becomes an invalid index. This should not normally
+        // happen, it is a safeguard in case of a bug, data corruption, etc.
+        if (state >= DICTIONARY_SIZE) {
+            return 0;
+        }
+    }
+}
+#else
+typedef uint16_t autocorrect_offset_t;
+
+/**
+ * @brief Searches the typo buffer for a typo, walking the trie stored in `autocorrect_data`.
+ *
+ * Kept for autocorrect_data.h files generated before the DAWG format.
+ *
+ * @return autocorrect_offset_t byte offset of the matched leaf node, or 0 if there is no typo
+ */
+static autocorrect_offset_t autocorrect_find_typo(void) {
+    autocorrect_offset_t state = 0;
+    uint8_t              code  = pgm_read_byte(autocorrect_data + state);
+    for (int8_t i = typo_buffer_size - 1; i >= 0; --i) {
+        uint8_t const key_i = typo_buffer[i];
+
+        if (code & 64) { // Check for match in node with multiple children.
+            code &= 63;
+            for (; code != key_i; code = pgm_read_byte(autocorrect_data + (state += 3))) {
+                if (!code) return 0;
+            }
+            // Follow link to child node.
+            state = (pgm_read_byte(autocorrect_data + state + 1) | pgm_read_byte(autocorrect_data + state + 2) << 8);
+            // Check for match in node with single child.
+        } else if (code != key_i) {
+            return 0;
+        } else if (!(code = pgm_read_byte(autocorrect_data + (++state)))) {
+            ++state;
+        }
+
+        // Stop if `state` becomes an invalid index. This should not normally
+        // happen, it is a safeguard in case of a bug, data corruption, etc.
+        if (state >= DICTIONARY_SIZE) {
+            return 0;
+        }
+
+        code = pgm_read_byte(autocorrect_data + state);
+
+        if (code & 128) { // A typo was found!
+            return state;
+        }
+    }
+    return 0;
+}
+#endif
+
 /**
  * @brief Process handler for autocorrect feature
  *
@@ -279,98 +404,74 @@ bool process_autocorrect(uint16_t keycode, keyrecord_t *record) {
         return true;
     }
 
-    // Check for typo in buffer using a trie stored in `autocorrect_data`.
-    uint16_t state = 0;
-    uint8_t  code  = pgm_read_byte(autocorrect_data + state);
-    for (int8_t i = typo_buffer_size - 1; i >= 0; --i) {
-        uint8_t const key_i = typo_buffer[i];
-
-        if (code & 64) { // Check for match in node with multiple children.
-            code &= 63;
-            for (; code != key_i; code = pgm_read_byte(autocorrect_data + (state += 3))) {
-                if (!code) return true;
-            }
-            // Follow link to child node.
-            state = (pgm_read_byte(autocorrect_data + state + 1) | pgm_read_byte(autocorrect_data + state + 2) << 8);
-            // Check for match in node with single child.
-        } else if (code != key_i) {
-            return true;
-        } else if (!(code = pgm_read_byte(autocorrect_data + (++state)))) {
-            ++state;
-        }
+    // Check for typo in buffer using the trie stored in `autocorrect_data`.
+    const autocorrect_offset_t state = autocorrect_find_typo();
+    if (!state) {
+        return true;
+    }
 
-        // Stop if `state` becomes an invalid index. This should not normally
-        // happen, it is a safeguard in case of a bug, data corruption, etc.
-        if (state >= DICTIONARY_SIZE) {
-            return true;
+    // A typo was found! Apply autocorrect.
+    const uint8_t code       = pgm_read_byte(autocorrect_data + state);
+    const uint8_t backspaces = (code & 63) + !record->event.pressed;
+    const char *  changes    = (const char *)(autocorrect_data + state + 1);
+
+    /* Gather info about the typo'd word
+     *
+     * Since buffer may contain several words, delimited by spaces, we
+     * iterate from the end to find the start and length of the typo
+     */
+    char typo[AUTOCORRECT_MAX_LENGTH + 1] = {0}; // extra char for null terminator
+
+    uint8_t typo_len   = 0;
+    uint8_t typo_start = 0;
+    bool    space_last = typo_buffer[typo_buffer_size - 1] == KC_SPC;
+    for (uint8_t i = typo_buffer_size; i > 0; --i) {
+        // stop counting after finding space (unless it is the last thing)
+        if (typo_buffer[i - 1] == KC_SPC && i != typo_buffer_size) {
+            typo_start = i;
+            break;
         }
 
-        code = pgm_read_byte(autocorrect_data + state);
-
-        if (code & 128) { // A typo was found! Apply autocorrect.
-            const uint8_t backspaces = (code & 63) + !record->event.pressed;
-            const char *  changes    = (const char *)(autocorrect_data + state + 1);
-
-            /* Gather info about the typo'd word
-             *
-             * Since buffer may contain several words, delimited by spaces, we
-             * iterate from the end to find the start and length of the typo
-             */
-            char typo[AUTOCORRECT_MAX_LENGTH + 1] = {0}; // extra char for null terminator
-
-            uint8_t typo_len   = 0;
-            uint8_t typo_start = 0;
-            bool    space_last = typo_buffer[typo_buffer_size - 1] == KC_SPC;
-            for (uint8_t i = typo_buffer_size; i > 0; --i) {
-                // stop counting after finding space (unless it is the last thing)
-                if (typo_buffer[i - 1] == KC_SPC && i != typo_buffer_size) {
-                    typo_start = i;
-                    break;
-                }
-
-                ++typo_len;
-            }
-
-            // when detecting 'typo:', reduce the length of the string by one
-            if (space_last) {
-                --typo_len;
-            }
+        ++typo_len;
+    }
 
-            // convert buffer of keycodes into a string
-            for (uint8_t i = 0; i < typo_len; ++i) {
-                typo[i] = typo_buffer[typo_start + i] - KC_A + 'a';
-            }
+    // when detecting 'typo:', reduce the length of the string by one
+    if (space_last) {
+        --typo_len;
+    }
 
-            /* Gather the corrected word
-             *
-             * A) Correction of 'typo:' -- Code takes into account
-             * an extra backspace to delete the space (which we dont copy)
-             * for this reason the offset is correct to "skip" the null terminator
-             *
-             * B) When correcting 'typo' -- Need extra offset for terminator
-             */
-            char correct[AUTOCORRECT_MAX_LENGTH + 10] = {0}; // let's hope this is big enough
-
-            uint8_t offset = space_last ? backspaces : backspaces + 1;
-            strcpy(correct, typo);
-            strcpy_P(correct + typo_len - offset, changes);
-
-            if (apply_autocorrect(backspaces, changes, typo, correct)) {
-                for (uint8_t i = 0; i < backspaces; ++i) {
-                    tap_code(KC_BSPC);
-                }
-                send_string_P(changes);
-            }
+    // convert buffer of keycodes into a string
+    for (uint8_t i = 0; i < typo_len; ++i) {
+        typo[i] = typo_buffer[typo_start + i] - KC_A + 'a';
+    }
 
-            if (keycode == KC_SPC) {
-                typo_buffer[0]   = KC_SPC;
-                typo_buffer_size = 1;
-                return true;
-            } else {
-                typo_buffer_size = 0;
-                return false;
-            }
+    /* Gather the corrected word
+     *
+     * A) Correction of 'typo:' -- Code takes into account
+     * an extra backspace to delete the space (which we dont copy)
+     * for this reason the offset is correct to "skip" the null terminator
+     *
+     * B) When correcting 'typo' -- Need extra offset for terminator
+     */
+    char correct[AUTOCORRECT_MAX_LENGTH + 10] = {0}; // let's hope this is big enough
+
+    uint8_t offset = space_last ? backspaces : backspaces + 1;
+    strcpy(correct, typo);
+    strcpy_P(correct + typo_len - offset, changes);
+
+    if (apply_autocorrect(backspaces, changes, typo, correct)) {
+        for (uint8_t i = 0; i < backspaces; ++i) {
+            tap_code(KC_BSPC);
         }
+        send_string_P(changes);
+    }
+
+    if (keycode == KC_SPC) {
+        typo_buffer[0]   = KC_SPC;
+        typo_buffer_size = 1;
+        return true;
+    } else {
+        typo_buffer_size = 0;
+        return false;
     }
-    return true;
 }
@@ -16,9 +16,12 @@
 
 #include "process_combo.h"
 #include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
 #include "process_auto_shift.h"
 #include "caps_word.h"
 #include "timer.h"
+#include "timeouts.h"
 #include "wait.h"
 #include "keyboard.h"
 #include "keymap_common.h"
@@ -89,18 +92,115 @@ typedef struct {
     keyrecord_t record;
     uint16_t    combo_index;
     uint16_t    keycode;
+    uint16_t    pending_combo; // combo completed by this key while the combo buffer was full, or -1
 } queued_record_t;
 static uint8_t         key_buffer_size = 0;
 static queued_record_t key_buffer[COMBO_KEY_BUFFER_LENGTH];
 
+/* Combo completed by the key being processed while the combo buffer was
+ * full. It is kept pending on that key's key_buffer record, and applied after
+ * the buffered combos. */
+static uint16_t combo_pending  = -1;
+static bool     combos_pending = false;
+
+/* Set of key_buffer slots, one bit per slot. Only the first 32 slots are
+ * tracked, combos with keys in later slots use the full key_buffer scan. */
+#if COMBO_KEY_BUFFER_LENGTH > 16
+typedef uint32_t combo_key_mask_t;
+#elif COMBO_KEY_BUFFER_LENGTH > 8
+typedef uint16_t combo_key_mask_t;
+#else
+typedef uint8_t combo_key_mask_t;
+#endif
+#define KEY_BUFFER_TRACKED_SLOTS (sizeof(combo_key_mask_t) * 8)
+#define KEY_BUFFER_SLOT(i) ((combo_key_mask_t)1 << (i))
+#define KEY_BUFFER_SLOT_TRACKED(i) ((i) < KEY_BUFFER_TRACKED_SLOTS)
+
+/* Fully pressed combos waiting to be applied, in the order they were
+ * completed. Buffered combos never overlap, as the smaller of two
+ * overlapping combos is dropped. */
 typedef struct {
-    uint16_t combo_index;
+    uint16_t         combo_index;
+    combo_key_mask_t key_mask; // key_buffer slots holding the combo's keys
+    uint8_t          key_count;
+    bool             key_mask_valid; // false if some key isn't in key_buffer
 } queued_combo_t;
-static uint8_t        combo_buffer_write = 0;
-static uint8_t        combo_buffer_read  = 0;
+static uint8_t        combo_buffer_size = 0;
 static queued_combo_t combo_buffer[COMBO_BUFFER_LENGTH];
 
-#define INCREMENT_MOD(i) i = (i + 1) % COMBO_BUFFER_LENGTH
+#if COMBO_INDEX_SIZE > 0
+/* Reverse index of combo keys, sorted by keycode and then combo index, so
+ * only the combos containing a keycode need to be evaluated. */
+typedef struct {
+    uint16_t keycode;
+    uint16_t combo_index;
+} combo_index_entry_t;
+static combo_index_entry_t combo_index[COMBO_INDEX_SIZE];
+static uint16_t            combo_index_size  = 0;
+static uint16_t            combo_index_count = 0;
+static bool                combo_index_valid = false;
+static bool                combo_index_fits  = false;
+
+static int combo_index_compare(const void *a, const void *b) {
+    const combo_index_entry_t *lhs = a;
+    const combo_index_entry_t *rhs = b;
+    if (lhs->keycode != rhs->keycode) {
+        return lhs->keycode < rhs->keycode ? -1 : 1;
+    }
+    // Combos with the same keycode are visited in index order.
+    return lhs->combo_index < rhs->combo_index ? -1 : (lhs->combo_index > rhs->combo_index);
+}
+
+static void build_combo_index(void) {
+    combo_index_size  = 0;
+    combo_index_count = combo_count();
+    combo_index_valid = true;
+    combo_index_fits  = true;
+
+    for (uint16_t idx = 0; idx < combo_index_count; ++idx) {
+        combo_t *combo = combo_get(idx);
+        uint16_t key;
+        for (uint8_t i = 0; (key = pgm_read_word(&combo->keys[i])) != COMBO_END; ++i) {
+            if (combo_index_size >= COMBO_INDEX_SIZE) {
+                // Too many combo keys, fall back to checking every combo.
+                combo_index_fits = false;
+                return;
+            }
+            combo_index[combo_index_size++] = (combo_index_entry_t){.keycode = key, .combo_index = idx};
+        }
+    }
+
+    qsort(combo_index, combo_index_size, sizeof(combo_index_entry_t), combo_index_compare);
+
+    // Drop keys listed twice in the same combo, which are now adjacent.
+    uint16_t unique = 0;
+    for (uint16_t i = 0; i < combo_index_size; ++i) {
+        if (unique == 0 || combo_index_compare(&combo_index[unique - 1], &combo_index[i]) != 0) {
+            combo_index[unique++] = combo_index[i];
+        }
+    }
+    combo_index_size = unique;
+}
+
+static uint16_t combo_index_lower_bound(uint16_t keycode) {
+    uint16_t lo = 0, hi = combo_index_size;
+    while (lo < hi) {
+        uint16_t mid = lo + (hi - lo) / 2;
+        if (combo_index[mid].keycode < keycode) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+#endif
+
+void combo_reset_index(void) {
+#if COMBO_INDEX_SIZE > 0
+    combo_index_valid = false;
+#endif
+}
 
 #ifndef EXTRA_SHORT_COMBOS
 /* flags are their own elements in combo_t struct. */
@@ -262,19 +362,24 @@ static inline void dump_key_buffer(void) {
     }
 
     key_buffer_next = key_buffer_size = 0;
+    combos_pending                    = false;
 }
 
-#define NO_COMBO_KEYS_ARE_DOWN (0 == COMBO_STATE(combo))
-#define ALL_COMBO_KEYS_ARE_DOWN(state, key_count) (((1 << key_count) - 1) == state)
+#if defined(EXTRA_EXTRA_LONG_COMBOS)
+#    define COMBO_KEY_BIT(key_index) ((uint32_t)1 << (key_index))
+#else
+#    define COMBO_KEY_BIT(key_index) (1 << (key_index))
+#endif
+#define ALL_COMBO_KEYS_ARE_DOWN(state, key_count) (((COMBO_KEY_BIT(key_count - 1) << 1) - 1) == state)
 #define ONLY_ONE_KEY_IS_DOWN(state) !(state & (state - 1))
-#define KEY_NOT_YET_RELEASED(state, key_index) ((1 << key_index) & state)
-#define KEY_STATE_DOWN(state, key_index) \
-    do {                                 \
-        state |= (1 << key_index);       \
+#define KEY_NOT_YET_RELEASED(state, key_index) (COMBO_KEY_BIT(key_index) & state)
+#define KEY_STATE_DOWN(state, key_index)    \
+    do {                                    \
+        state |= COMBO_KEY_BIT(key_index);  \
     } while (0)
-#define KEY_STATE_UP(state, key_index) \
-    do {                               \
-        state &= ~(1 << key_index);    \
+#define KEY_STATE_UP(state, key_index)      \
+    do {                                    \
+        state &= ~COMBO_KEY_BIT(key_index); \
     } while (0)
 
 static inline void _find_key_index_and_count(const uint16_t *keys, uint16_t keycode, uint16_t *key_index, uint8_t *key_count) {
@@ -286,23 +391,26 @@ static inline void _find_key_index_and_count(const uint16_t *keys, uint16_t keyc
     }
 }
 
-void drop_combo_from_buffer(uint16_t combo_index) {
-    /* Mark a combo as processed from the buffer. If the buffer is in the
-     * beginning of the buffer, drop it.  */
-    uint8_t i = combo_buffer_read;
-    while (i != combo_buffer_write) {
-        queued_combo_t *qcombo = &combo_buffer[i];
-
-        if (qcombo->combo_index == combo_index) {
-            combo_t *combo = combo_get(combo_index);
-            DISABLE_COMBO(combo);
-
-            if (i == combo_buffer_read) {
-                INCREMENT_MOD(combo_buffer_read);
-            }
-            break;
+static void remove_combo_from_buffer(uint8_t i) {
+    combo_buffer_size--;
+    memmove(&combo_buffer[i], &combo_buffer[i + 1], (combo_buffer_size - i) * sizeof(queued_combo_t));
+}
+
+static queued_combo_t *find_buffered_combo(uint16_t combo_index) {
+    for (uint8_t i = 0; i < combo_buffer_size; i++) {
+        if (combo_buffer[i].combo_index == combo_index) {
+            return &combo_buffer[i];
         }
-        INCREMENT_MOD(i);
+    }
+    return NULL;
+}
+
+void drop_combo_from_buffer(uint16_t combo_index) {
+    /* Mark a combo as processed and remove it from the buffer. */
+    queued_combo_t *qcombo = find_buffered_combo(combo_index);
+    if (qcombo) {
+        DISABLE_COMBO(combo_get(combo_index));
+        remove_combo_from_buffer(qcombo - combo_buffer);
     }
 }
 
@@ -311,9 +419,16 @@ void apply_combo(uint16_t combo_index, combo_t *combo) {
      * disable the other keys. */
 
     if (COMBO_DISABLED(combo)) {
+        drop_combo_from_buffer(combo_index);
         return;
     }
 
+    // only visit the key_buffer slots holding the combo's keys, if known
+    queued_combo_t *qcombo = find_buffered_combo(combo_index);
+    if (qcombo && !qcombo->key_mask_valid) {
+        qcombo = NULL;
+    }
+
     // state to check against so we find the last key of the combo from the buffer
 #if defined(EXTRA_EXTRA_LONG_COMBOS)
     uint32_t state = 0;
@@ -324,6 +439,10 @@ void apply_combo(uint16_t combo_index, combo_t *combo) {
 #endif
 
     for (uint8_t key_buffer_i = 0; key_buffer_i < key_buffer_size; key_buffer_i++) {
+        if (qcombo && (!KEY_BUFFER_SLOT_TRACKED(key_buffer_i) || !(qcombo->key_mask & KEY_BUFFER_SLOT(key_buffer_i)))) {
+            continue;
+        }
+
         queued_record_t *qrecord = &key_buffer[key_buffer_i];
         keyrecord_t *    record  = &qrecord->record;
         uint16_t         keycode = qrecord->keycode;
@@ -357,20 +476,64 @@ void apply_combo(uint16_t combo_index, combo_t *combo) {
     drop_combo_from_buffer(combo_index);
 }
 
+static bool combo_keys_applied(combo_t *combo) {
+    /* Checks if any of a combo's keys has already been used by an applied combo. */
+    for (uint8_t key_buffer_i = 0; key_buffer_i < key_buffer_size; key_buffer_i++) {
+        keyevent_t event = key_buffer[key_buffer_i].record.event;
+        if (!IS_NOEVENT(event) && !IS_COMBOEVENT(event)) {
+            continue;
+        }
+
+        uint8_t  key_count = 0;
+        uint16_t key_index = -1;
+        _find_key_index_and_count(combo->keys, key_buffer[key_buffer_i].keycode, &key_index, &key_count);
+        if (-1 != (int16_t)key_index) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void apply_pending_combos(void) {
+    /* Apply the combos left pending by a full combo buffer, once the buffered
+     * ones have been applied, unless one of those took their keys. */
+    for (uint8_t key_buffer_i = 0; key_buffer_i < key_buffer_size; key_buffer_i++) {
+        uint16_t combo_index = key_buffer[key_buffer_i].pending_combo;
+        if (combo_index == (uint16_t)-1) {
+            continue;
+        }
+        key_buffer[key_buffer_i].pending_combo = -1;
+
+        combo_t *combo = combo_get(combo_index);
+#ifdef COMBO_MUST_TAP_PER_COMBO
+        if (get_combo_must_tap(combo_index, combo)) {
+            // Tap-only combos are applied on key release only.
+            continue;
+        }
+#endif
+        if (!COMBO_ACTIVE(combo) && !combo_keys_applied(combo)) {
+            apply_combo(combo_index, combo);
+        }
+    }
+}
+
 static inline void apply_combos(void) {
-    // Apply all buffered normal combos.
-    for (uint8_t i = combo_buffer_read; i != combo_buffer_write; INCREMENT_MOD(i)) {
-        queued_combo_t *buffered_combo = &combo_buffer[i];
-        combo_t *       combo          = combo_get(buffered_combo->combo_index);
+    // Apply all buffered normal combos, each one is removed from the buffer once applied.
+    while (combo_buffer_size > 0) {
+        uint16_t combo_index = combo_buffer[0].combo_index;
+        combo_t *combo       = combo_get(combo_index);
 
 #ifdef COMBO_MUST_TAP_PER_COMBO
-        if (get_combo_must_tap(buffered_combo->combo_index, combo)) {
+        if (get_combo_must_tap(combo_index, combo)) {
             // Tap-only combos are applied on key release only, so let's drop 'em here.
-            drop_combo_from_buffer(buffered_combo->combo_index);
+            drop_combo_from_buffer(combo_index);
             continue;
         }
 #endif
-        apply_combo(buffered_combo->combo_index, combo);
+        apply_combo(combo_index, combo);
+    }
+    if (combos_pending) {
+        apply_pending_combos();
     }
     dump_key_buffer();
     clear_combos();
@@ -400,6 +563,94 @@ combo_t *overlaps(combo_t *combo1, combo_t *combo2) {
     return combo1;
 }
 
+static bool drop_overlapping_pending_combo(uint16_t *pending_index, uint16_t combo_index, combo_t *combo) {
+    /* Resolves an overlap between a fully pressed combo and one left pending
+     * by a full combo buffer, the same way as for buffered combos. Returns
+     * true if the fully pressed combo has to be dropped. */
+    if (*pending_index == (uint16_t)-1) {
+        return false;
+    }
+    if (*pending_index == combo_index) {
+        // pressed again, it will be buffered or left pending anew
+        *pending_index = -1;
+        return false;
+    }
+
+    combo_t *pending = combo_get(*pending_index);
+    combo_t *drop    = overlaps(pending, combo);
+    if (drop == combo) {
+        return true;
+    }
+    if (drop == pending) {
+        DISABLE_COMBO(pending);
+        *pending_index = -1;
+    }
+    return false;
+}
+
+static bool drop_overlapping_pending_combos(uint16_t combo_index, combo_t *combo) {
+    if (drop_overlapping_pending_combo(&combo_pending, combo_index, combo)) {
+        return true;
+    }
+    if (!combos_pending) {
+        return false;
+    }
+    for (uint8_t key_buffer_i = 0; key_buffer_i < key_buffer_size; key_buffer_i++) {
+        if (drop_overlapping_pending_combo(&key_buffer[key_buffer_i].pending_combo, combo_index, combo)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static queued_combo_t queue_combo(uint16_t combo_index, combo_t *combo, uint8_t key_count, uint16_t keycode) {
+    /* Collect the key_buffer slots holding the keys of a combo that was just
+     * fully pressed. The key being pressed isn't buffered yet, it will take
+     * the next free slot. */
+    queued_combo_t qcombo = {
+        .combo_index    = combo_index,
+        .key_mask       = 0,
+        .key_count      = key_count,
+        .key_mask_valid = true,
+    };
+
+    uint16_t key;
+    for (uint8_t i = 0; (key = pgm_read_word(&combo->keys[i])) != COMBO_END; ++i) {
+        combo_key_mask_t key_slots = 0;
+        for (uint8_t key_buffer_i = 0; key_buffer_i < key_buffer_size; key_buffer_i++) {
+            if (key_buffer[key_buffer_i].keycode != key) {
+                continue;
+            }
+            if (KEY_BUFFER_SLOT_TRACKED(key_buffer_i)) {
+                key_slots |= KEY_BUFFER_SLOT(key_buffer_i);
+            } else {
+                qcombo.key_mask_valid = false;
+            }
+        }
+        if (key == keycode && key_buffer_size < COMBO_KEY_BUFFER_LENGTH) {
+            if (KEY_BUFFER_SLOT_TRACKED(key_buffer_size)) {
+                key_slots |= KEY_BUFFER_SLOT(key_buffer_size);
+            } else {
+                qcombo.key_mask_valid = false;
+            }
+        }
+        if (!key_slots) {
+            qcombo.key_mask_valid = false;
+        }
+        qcombo.key_mask |= key_slots;
+    }
+    return qcombo;
+}
+
+static bool queued_combos_overlap(queued_combo_t *qcombo1, queued_combo_t *qcombo2) {
+    /* Buffered combos are fully pressed, so they share a keycode exactly when
+     * they share a key_buffer slot. */
+    if (qcombo1->key_mask_valid && qcombo2->key_mask_valid) {
+        return qcombo1->key_mask & qcombo2->key_mask;
+    }
+    return overlaps(combo_get(qcombo1->combo_index), combo_get(qcombo2->combo_index)) != NULL;
+}
+
 #if defined(COMBO_MUST_PRESS_IN_ORDER) || defined(COMBO_MUST_PRESS_IN_ORDER_PER_COMBO)
 static bool keys_pressed_in_order(uint16_t combo_index, combo_t *combo, uint16_t key_index, uint16_t keycode, keyrecord_t *record) {
 #    ifdef COMBO_MUST_PRESS_IN_ORDER_PER_COMBO
@@ -409,7 +660,7 @@ static bool keys_pressed_in_order(uint16_t combo_index, combo_t *combo, uint16_t
 #    endif
     if (
         // The `state` bit for the key being pressed.
-        (1 << key_index) ==
+        COMBO_KEY_BIT(key_index) ==
         // The *next* combo key's bit.
         (COMBO_STATE(combo) + 1)
         // E.g. two keys already pressed: `state == 11`.
@@ -462,34 +713,43 @@ static combo_key_action_t process_single_combo(combo_t *combo, uint16_t keycode,
 #endif
             {
 
-                // disable readied combos that overlap with this combo
-                combo_t *drop = NULL;
-                for (uint8_t combo_buffer_i = combo_buffer_read; combo_buffer_i != combo_buffer_write; INCREMENT_MOD(combo_buffer_i)) {
-                    queued_combo_t *qcombo         = &combo_buffer[combo_buffer_i];
-                    combo_t *       buffered_combo = combo_get(qcombo->combo_index);
-
-                    if ((drop = overlaps(buffered_combo, combo))) {
-                        DISABLE_COMBO(drop);
-                        if (drop == combo) {
-                            // stop checking for overlaps if dropped combo was current combo.
-                            break;
-                        } else if (combo_buffer_i == combo_buffer_read && drop == buffered_combo) {
-                            /* Drop the disabled buffered combo from the buffer if
-                             * it is in the beginning of the buffer. */
-                            INCREMENT_MOD(combo_buffer_read);
-                        }
+                // disable readied combos that overlap with this combo, the
+                // one with less keys is dropped (the readied one on a tie).
+                queued_combo_t qcombo  = queue_combo(combo_index, combo, key_count, keycode);
+                bool           dropped = false;
+                for (uint8_t combo_buffer_i = 0; combo_buffer_i < combo_buffer_size;) {
+                    queued_combo_t *buffered = &combo_buffer[combo_buffer_i];
+
+                    if (!queued_combos_overlap(buffered, &qcombo)) {
+                        combo_buffer_i++;
+                    } else if (qcombo.key_count < buffered->key_count) {
+                        // stop checking for overlaps if dropped combo was current combo.
+                        dropped = true;
+                        break;
+                    } else {
+                        DISABLE_COMBO(combo_get(buffered->combo_index));
+                        remove_combo_from_buffer(combo_buffer_i);
                     }
                 }
 
-                if (drop != combo) {
+                if (!dropped) {
+                    dropped = drop_overlapping_pending_combos(combo_index, combo);
+                }
+
+                if (!dropped && combo_buffer_size < COMBO_BUFFER_LENGTH) {
                     // save this combo to buffer
-                    combo_buffer[combo_buffer_write] = (queued_combo_t){
-                        .combo_index = combo_index,
-                    };
-                    INCREMENT_MOD(combo_buffer_write);
+                    combo_buffer[combo_buffer_size++] = qcombo;
 
                     // get possible longer waiting time for tap-/hold-only combos.
                     longest_term = _get_wait_time(combo_index, combo);
+                } else if (!dropped) {
+                    // the buffer is full, keep this combo pending on the key
+                    // being pressed, combos pressed by the same key overlap
+                    // with it and were resolved above
+                    combo_pending = combo_index;
+                    longest_term  = _get_wait_time(combo_index, combo);
+                } else {
+                    DISABLE_COMBO(combo);
                 }
             } // if timer elapsed end
         }
@@ -509,6 +769,8 @@ static combo_key_action_t process_single_combo(combo_t *combo, uint16_t keycode,
             if (COMBO_DISABLED(combo) || _get_combo_must_hold(combo_index, combo)) {
                 // combo wasn't tappable, disable it and drop it from buffer.
                 drop_combo_from_buffer(combo_index);
+                // it may also have been left pending by a full buffer
+                DISABLE_COMBO(combo);
                 key_is_part_of_combo = false;
             }
 #ifdef COMBO_MUST_TAP_PER_COMBO
@@ -551,9 +813,20 @@ static combo_key_action_t process_single_combo(combo_t *combo, uint16_t keycode,
     return key_is_part_of_combo ? COMBO_KEY_PRESSED : COMBO_KEY_NOT_PRESSED;
 }
 
+/* Lets combo_task() run once the current combo term runs out, instead of on every scan. */
+static void schedule_combo_timeout(void) {
+#ifndef COMBO_NO_TIMER
+    if (timer) {
+        uint16_t elapsed = timer_elapsed(timer);
+        timeout_schedule_in(TIMEOUT_COMBO, elapsed > longest_term ? 0 : longest_term - elapsed + 1);
+        return;
+    }
+#endif
+    timeout_cancel(TIMEOUT_COMBO);
+}
+
 bool process_combo(uint16_t keycode, keyrecord_t *record) {
-    uint8_t is_combo_key          = COMBO_KEY_NOT_PRESSED;
-    bool    no_combo_keys_pressed = true;
+    uint8_t is_combo_key = COMBO_KEY_NOT_PRESSED;
 
     if (keycode == QK_COMBO_ON && record->event.pressed) {
         combo_enable();
@@ -581,10 +854,24 @@ bool process_combo(uint16_t keycode, keyrecord_t *record) {
     }
 #endif
 
-    for (uint16_t idx = 0; idx < combo_count(); ++idx) {
-        combo_t *combo = combo_get(idx);
-        is_combo_key |= process_single_combo(combo, keycode, record, idx);
-        no_combo_keys_pressed = no_combo_keys_pressed && (NO_COMBO_KEYS_ARE_DOWN || COMBO_ACTIVE(combo) || COMBO_DISABLED(combo));
+#if COMBO_INDEX_SIZE > 0
+    if (!combo_index_valid || combo_index_count != combo_count()) {
+        build_combo_index();
+    }
+
+    if (combo_index_fits) {
+        // Combos not containing the keycode are left untouched by process_single_combo, so skip them entirely.
+        for (uint16_t i = combo_index_lower_bound(keycode); i < combo_index_size && combo_index[i].keycode == keycode; ++i) {
+            uint16_t idx = combo_index[i].combo_index;
+            is_combo_key |= process_single_combo(combo_get(idx), keycode, record, idx);
+        }
+    } else
+#endif
+    {
+        for (uint16_t idx = 0; idx < combo_count(); ++idx) {
+            combo_t *combo = combo_get(idx);
+            is_combo_key |= process_single_combo(combo, keycode, record, idx);
+        }
     }
 
     if (record->event.pressed && is_combo_key) {
@@ -605,14 +892,27 @@ bool process_combo(uint16_t keycode, keyrecord_t *record) {
         {
             if (key_buffer_size < COMBO_KEY_BUFFER_LENGTH) {
                 key_buffer[key_buffer_size++] = (queued_record_t){
-                    .record      = *record,
-                    .keycode     = keycode,
-                    .combo_index = -1, // this will be set when applying combos
+                    .record        = *record,
+                    .keycode       = keycode,
+                    .combo_index   = -1, // this will be set when applying combos
+                    .pending_combo = combo_pending,
                 };
+                combos_pending |= combo_pending != (uint16_t)-1;
+                combo_pending = -1;
             }
         }
+#ifdef COMBO_PROCESS_KEY_REPRESS
+        else if (key_buffer_size < COMBO_KEY_BUFFER_LENGTH && KEY_BUFFER_SLOT_TRACKED(key_buffer_size)) {
+            // combos completed by this key expected it in the next key_buffer slot
+            for (uint8_t i = 0; i < combo_buffer_size; i++) {
+                if (combo_buffer[i].key_mask & KEY_BUFFER_SLOT(key_buffer_size)) {
+                    combo_buffer[i].key_mask_valid = false;
+                }
+            }
+        }
+#endif
     } else {
-        if (combo_buffer_read != combo_buffer_write) {
+        if (combo_buffer_size > 0 || combos_pending) {
             // some combo is prepared
             apply_combos();
         } else {
@@ -624,6 +924,12 @@ bool process_combo(uint16_t keycode, keyrecord_t *record) {
             clear_combos();
         }
     }
+    if (combo_pending != (uint16_t)-1) {
+        // the key completing the pending combo couldn't be buffered
+        DISABLE_COMBO(combo_get(combo_pending));
+        combo_pending = -1;
+    }
+    schedule_combo_timeout();
     return !is_combo_key;
 }
 
@@ -634,7 +940,7 @@ void combo_task(void) {
 
 #ifndef COMBO_NO_TIMER
     if (timer && timer_elapsed(timer) > longest_term) {
-        if (combo_buffer_read != combo_buffer_write) {
+        if (combo_buffer_size > 0 || combos_pending) {
             apply_combos();
             longest_term = 0;
             timer        = 0;
@@ -644,6 +950,7 @@ void combo_task(void) {
             clear_combos();
         }
     }
+    schedule_combo_timeout();
 #endif
 }
 
@@ -656,9 +963,10 @@ void combo_disable(void) {
     timer = 0;
 #endif
     b_combo_enable    = false;
-    combo_buffer_read = combo_buffer_write;
+    combo_buffer_size = 0;
     clear_combos();
     dump_key_buffer();
+    timeout_cancel(TIMEOUT_COMBO);
 }
 
 void combo_toggle(void) {
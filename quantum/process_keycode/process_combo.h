@@ -38,6 +38,9 @@
 #ifndef COMBO_BUFFER_LENGTH
 #    define COMBO_BUFFER_LENGTH 4
 #endif
+#ifndef COMBO_INDEX_SIZE
+#    define COMBO_INDEX_SIZE 0
+#endif
 
 typedef struct combo_t {
     const uint16_t *keys;
@@ -77,6 +80,8 @@ bool process_combo(uint16_t keycode, keyrecord_t *record);
 void combo_task(void);
 void process_combo_event(uint16_t combo_index, bool pressed);
 
+void combo_reset_index(void);
+
 void combo_enable(void);
 void combo_disable(void);
 void combo_toggle(void);
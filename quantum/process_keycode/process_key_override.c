@@ -24,11 +24,19 @@
 #include "quantum.h"
 #include "quantum_keycodes.h"
 #include "keymap_introspection.h"
+#include "compiler_support.h"
 
 #ifndef KEY_OVERRIDE_REPEAT_DELAY
 #    define KEY_OVERRIDE_REPEAT_DELAY 500
 #endif
 
+#ifndef KEY_OVERRIDE_INDEX_SIZE
+#    define KEY_OVERRIDE_INDEX_SIZE 0
+#endif
+
+// The index stores and iterates override indices as uint8_t.
+STATIC_ASSERT(KEY_OVERRIDE_INDEX_SIZE <= 255, "KEY_OVERRIDE_INDEX_SIZE must not be larger than 255");
+
 // For benchmarking the time it takes to call process_key_override on every key press (needs keyboard debugging enabled as well)
 // #define BENCH_KEY_OVERRIDE
 
@@ -243,13 +251,99 @@ static bool check_activation_event(const key_override_t *override, const bool ke
     }
 }
 
-/** Iterates through the list of key overrides and tries activating each, until it finds one that activates or reaches the end of overrides. Returns true if the key action for `keycode` should be sent */
-static bool try_activating_override(const uint16_t keycode, const uint8_t layer, const bool key_down, const bool is_mod, const uint8_t active_mods, bool *activated) {
-    if (key_override_count() == 0) {
-        return true;
+/** Checks whether `override` can be activated by the key event. Returns true if the override should be activated. */
+static bool override_can_activate(const key_override_t *const override, const uint16_t keycode, const uint8_t layer, const bool key_down, const bool is_mod, const uint8_t active_mods) {
+    // Fast, but not full mods check. Most key presses will not have any mods down, and most overrides will require mods. Hence here we filter overrides that require mods to be down while no mods are down
+    if (active_mods == 0 && override->trigger_mods != 0) {
+        key_override_printf("Not activating override: Modifiers don't match\n");
+        return false;
     }
 
-    for (uint8_t i = 0; i < key_override_count(); i++) {
+    // Check layer
+    if ((override->layers & (1 << layer)) == 0) {
+        key_override_printf("Not activating override: Not set to activate on pressed layer\n");
+        return false;
+    }
+
+    // Check allowed activation events
+    if (!check_activation_event(override, key_down, is_mod)) {
+        key_override_printf("Not activating override: Activation event not allowed\n");
+        return false;
+    }
+
+    const bool is_trigger = override->trigger == keycode;
+
+    // Check if trigger lifted. This is a small optimization in order to skip the remaining checks
+    if (is_trigger && !key_down) {
+        key_override_printf("Not activating override: Trigger lifted\n");
+        return false;
+    }
+
+    // If the trigger is KC_NO it means 'no key', so only the required modifiers need to be down.
+    const bool no_trigger = override->trigger == KC_NO;
+
+    // Check if aleady active
+    if (override == active_override) {
+        key_override_printf("Not activating override: Alerady actived\n");
+        return false;
+    }
+
+    // Check if enabled
+    if (override->enabled != NULL && !((*(override->enabled) & 1))) {
+        key_override_printf("Not activating override: Not enabled\n");
+        return false;
+    }
+
+    // Check mods precisely
+    if (!key_override_matches_active_modifiers(override, active_mods)) {
+        key_override_printf("Not activating override: Modifiers don't match\n");
+        return false;
+    }
+
+    // Check if trigger key is down.
+    const bool trigger_down = is_trigger && key_down;
+
+    // At this point, all requirements for activation are checked, except whether the trigger key is pressed. Now we check if the required trigger is down
+    // If no trigger key is required, yes.
+    // If the trigger was just pressed, yes.
+    // If the last non-mod key that was pressed down is the trigger key, yes.
+    bool should_activate = no_trigger || trigger_down || last_key_down == override->trigger;
+
+    if (!should_activate) {
+        key_override_printf("Not activating override. Trigger not down\n");
+        return false;
+    }
+
+    return true;
+}
+
+#if KEY_OVERRIDE_INDEX_SIZE > 0
+/* Index of key overrides sorted by trigger keycode and then override index.
+ * An override can only activate if its trigger is KC_NO, the pressed key or
+ * the last non-mod key pressed down, so only those buckets are checked. */
+typedef struct {
+    uint16_t trigger;
+    uint8_t  trigger_mods;
+    uint8_t  override_index;
+} key_override_index_entry_t;
+static key_override_index_entry_t key_override_index[KEY_OVERRIDE_INDEX_SIZE];
+static uint8_t                    key_override_index_size  = 0;
+static uint16_t                   key_override_index_count = 0;
+static bool                       key_override_index_valid = false;
+static bool                       key_override_index_fits  = false;
+
+static void build_key_override_index(void) {
+    key_override_index_size  = 0;
+    key_override_index_count = key_override_count();
+    key_override_index_valid = true;
+    key_override_index_fits  = key_override_index_count <= KEY_OVERRIDE_INDEX_SIZE;
+
+    if (!key_override_index_fits) {
+        // Too many key overrides, fall back to checking all of them.
+        return;
+    }
+
+    for (uint8_t i = 0; i < key_override_index_count; i++) {
         const key_override_t *const override = key_override_get(i);
 
         // End of array
@@ -257,138 +351,195 @@ static bool try_activating_override(const uint16_t keycode, const uint8_t layer,
             break;
         }
 
-        // Fast, but not full mods check. Most key presses will not have any mods down, and most overrides will require mods. Hence here we filter overrides that require mods to be down while no mods are down
-        if (active_mods == 0 && override->trigger_mods != 0) {
-            key_override_printf("Not activating override: Modifiers don't match\n");
-            continue;
+        // Insert after any entries with the same trigger, overrides are visited in index order.
+        uint8_t pos = key_override_index_size;
+        while (pos > 0 && key_override_index[pos - 1].trigger > override->trigger) {
+            key_override_index[pos] = key_override_index[pos - 1];
+            --pos;
         }
+        key_override_index[pos] = (key_override_index_entry_t){
+            .trigger        = override->trigger,
+            .trigger_mods   = override->trigger_mods,
+            .override_index = i,
+        };
+        ++key_override_index_size;
+    }
+}
 
-        // Check layer
-        if ((override->layers & (1 << layer)) == 0) {
-            key_override_printf("Not activating override: Not set to activate on pressed layer\n");
-            continue;
+static uint8_t key_override_index_lower_bound(const uint16_t trigger) {
+    uint8_t lo = 0, hi = key_override_index_size;
+    while (lo < hi) {
+        uint8_t mid = lo + (hi - lo) / 2;
+        if (key_override_index[mid].trigger < trigger) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
         }
+    }
+    return lo;
+}
 
-        // Check allowed activation events
-        if (!check_activation_event(override, key_down, is_mod)) {
-            key_override_printf("Not activating override: Activation event not allowed\n");
-            continue;
+static const key_override_t *find_indexed_override(const uint16_t keycode, const uint8_t layer, const bool key_down, const bool is_mod, const uint8_t active_mods) {
+    // Triggers of overrides that may activate, each one a sorted run of the index.
+    uint16_t triggers[3] = {KC_NO, last_key_down, key_down ? keycode : KC_NO};
+    uint8_t  cursor[3];
+    for (uint8_t t = 0; t < 3; t++) {
+        bool duplicate = false;
+        for (uint8_t u = 0; u < t; u++) {
+            duplicate |= triggers[u] == triggers[t];
         }
+        // A duplicate run starts at the end, so it is never visited twice.
+        cursor[t] = duplicate ? key_override_index_size : key_override_index_lower_bound(triggers[t]);
+    }
 
-        const bool is_trigger = override->trigger == keycode;
-
-        // Check if trigger lifted. This is a small optimization in order to skip the remaining checks
-        if (is_trigger && !key_down) {
-            key_override_printf("Not activating override: Trigger lifted\n");
-            continue;
+    // Merge the runs, so overrides are still tried in index order.
+    while (true) {
+        int8_t next = -1;
+        for (uint8_t t = 0; t < 3; t++) {
+            if (cursor[t] < key_override_index_size && key_override_index[cursor[t]].trigger == triggers[t]) {
+                if (next < 0 || key_override_index[cursor[t]].override_index < key_override_index[cursor[next]].override_index) {
+                    next = t;
+                }
+            }
+        }
+        if (next < 0) {
+            return NULL;
         }
 
-        // If the trigger is KC_NO it means 'no key', so only the required modifiers need to be down.
-        const bool no_trigger = override->trigger == KC_NO;
+        const key_override_index_entry_t *entry = &key_override_index[cursor[next]++];
 
-        // Check if aleady active
-        if (override == active_override) {
-            key_override_printf("Not activating override: Alerady actived\n");
+        // At least one of the required mods must be down, whether all or one of them are needed.
+        if (entry->trigger_mods != 0 && (entry->trigger_mods & active_mods) == 0) {
             continue;
         }
 
-        // Check if enabled
-        if (override->enabled != NULL && !((*(override->enabled) & 1))) {
-            key_override_printf("Not activating override: Not enabled\n");
-            continue;
+        const key_override_t *const override = key_override_get(entry->override_index);
+        if (override_can_activate(override, keycode, layer, key_down, is_mod, active_mods)) {
+            return override;
         }
+    }
+}
+#endif
 
-        // Check mods precisely
-        if (!key_override_matches_active_modifiers(override, active_mods)) {
-            key_override_printf("Not activating override: Modifiers don't match\n");
-            continue;
-        }
+void key_override_reset_index(void) {
+#if KEY_OVERRIDE_INDEX_SIZE > 0
+    key_override_index_valid = false;
+#endif
+}
 
-        // Check if trigger key is down.
-        const bool trigger_down = is_trigger && key_down;
+/** Finds the first key override in the list that can be activated by the key event, or NULL if there is none. */
+static const key_override_t *find_override(const uint16_t keycode, const uint8_t layer, const bool key_down, const bool is_mod, const uint8_t active_mods) {
+#if KEY_OVERRIDE_INDEX_SIZE > 0
+    if (!key_override_index_valid || key_override_index_count != key_override_count()) {
+        build_key_override_index();
+    }
 
-        // At this point, all requirements for activation are checked, except whether the trigger key is pressed. Now we check if the required trigger is down
-        // If no trigger key is required, yes.
-        // If the trigger was just pressed, yes.
-        // If the last non-mod key that was pressed down is the trigger key, yes.
-        bool should_activate = no_trigger || trigger_down || last_key_down == override->trigger;
+    if (key_override_index_fits) {
+        return find_indexed_override(keycode, layer, key_down, is_mod, active_mods);
+    }
+#endif
 
-        if (!should_activate) {
-            key_override_printf("Not activating override. Trigger not down\n");
-            continue;
+    for (uint8_t i = 0; i < key_override_count(); i++) {
+        const key_override_t *const override = key_override_get(i);
+
+        // End of array
+        if (override == NULL) {
+            break;
         }
 
-        key_override_printf("Activating override\n");
+        if (override_can_activate(override, keycode, layer, key_down, is_mod, active_mods)) {
+            return override;
+        }
+    }
 
-        clear_active_override(false);
+    return NULL;
+}
+
+/** Finds the first key override that can be activated by the key event and activates it. Returns true if the key action for `keycode` should be sent */
+static bool try_activating_override(const uint16_t keycode, const uint8_t layer, const bool key_down, const bool is_mod, const uint8_t active_mods, bool *activated) {
+    if (key_override_count() == 0) {
+        return true;
+    }
+
+    const key_override_t *const override = find_override(keycode, layer, key_down, is_mod, active_mods);
+
+    if (override == NULL) {
+        *activated = false;
+        return true;
+    }
+
+    // Check if trigger key is down.
+    const bool trigger_down = override->trigger == keycode && key_down;
+
+    // If the trigger is KC_NO it means 'no key', so only the required modifiers need to be down.
+    const bool no_trigger = override->trigger == KC_NO;
+
+    key_override_printf("Activating override\n");
+
+    clear_active_override(false);
 
 #ifdef DUMMY_MOD_NEUTRALIZER_KEYCODE
-        // Send a dummy keycode before unregistering the modifier(s)
-        // so that suppressing the modifier(s) doesn't falsely get interpreted
-        // by the host OS as a tap of a modifier key.
-        // For example, unintended activations of the start menu on Windows when
-        // using a GUI+<kc> key override with suppressed mods.
-        neutralize_flashing_modifiers(active_mods);
+    // Send a dummy keycode before unregistering the modifier(s)
+    // so that suppressing the modifier(s) doesn't falsely get interpreted
+    // by the host OS as a tap of a modifier key.
+    // For example, unintended activations of the start menu on Windows when
+    // using a GUI+<kc> key override with suppressed mods.
+    neutralize_flashing_modifiers(active_mods);
 #endif
 
-        active_override                 = override;
-        active_override_trigger_is_down = true;
+    active_override                 = override;
+    active_override_trigger_is_down = true;
 
-        set_suppressed_override_mods(override->suppressed_mods);
+    set_suppressed_override_mods(override->suppressed_mods);
 
-        if (!trigger_down && !no_trigger) {
-            // When activating a key override the trigger is is always unregistered. In the case where the key that newly pressed is not the trigger key, we have to explicitly remove the trigger key from the keyboard report. If the trigger was just pressed down we simply suppress the event which also has the effect of the trigger key not being registered in the keyboard report.
-            if (IS_BASIC_KEYCODE(override->trigger)) {
-                del_key(override->trigger);
-            } else {
-                unregister_code(override->trigger);
-            }
+    if (!trigger_down && !no_trigger) {
+        // When activating a key override the trigger is is always unregistered. In the case where the key that newly pressed is not the trigger key, we have to explicitly remove the trigger key from the keyboard report. If the trigger was just pressed down we simply suppress the event which also has the effect of the trigger key not being registered in the keyboard report.
+        if (IS_BASIC_KEYCODE(override->trigger)) {
+            del_key(override->trigger);
+        } else {
+            unregister_code(override->trigger);
         }
+    }
 
-        const uint16_t mod_free_replacement = clear_mods_from(override->replacement);
+    const uint16_t mod_free_replacement = clear_mods_from(override->replacement);
 
-        bool register_replacement = mod_free_replacement != KC_NO &&   // KC_NO is never registered
-                                    mod_free_replacement < SAFE_RANGE; // Custom keycodes are never registered
+    bool register_replacement = mod_free_replacement != KC_NO &&   // KC_NO is never registered
+                                mod_free_replacement < SAFE_RANGE; // Custom keycodes are never registered
 
-        // Try firing the custom handler
-        if (override->custom_action != NULL) {
-            register_replacement &= override->custom_action(true, override->context);
-        }
+    // Try firing the custom handler
+    if (override->custom_action != NULL) {
+        register_replacement &= override->custom_action(true, override->context);
+    }
 
-        if (register_replacement) {
-            const uint8_t override_mods = extract_mod_bits(override->replacement);
-            set_weak_override_mods(override_mods);
+    if (register_replacement) {
+        const uint8_t override_mods = extract_mod_bits(override->replacement);
+        set_weak_override_mods(override_mods);
 
-            // If this is a modifier event that activates the key override we _always_ defer the actual full activation of the override
-            if (is_mod) {
-                key_override_printf("Deferring register replacement key\n");
-                schedule_deferred_register(mod_free_replacement);
-                send_keyboard_report();
+        // If this is a modifier event that activates the key override we _always_ defer the actual full activation of the override
+        if (is_mod) {
+            key_override_printf("Deferring register replacement key\n");
+            schedule_deferred_register(mod_free_replacement);
+            send_keyboard_report();
+        } else {
+            if (IS_BASIC_KEYCODE(mod_free_replacement)) {
+                add_key(mod_free_replacement);
             } else {
-                if (IS_BASIC_KEYCODE(mod_free_replacement)) {
-                    add_key(mod_free_replacement);
-                } else {
-                    key_override_printf("NOT KEY 2\n");
-                    send_keyboard_report();
-                    // On macOS there seems to be a race condition when it comes to the keyboard report and consumer keycodes. It seems the OS may recognize a consumer keycode before an updated keyboard report, even if the keyboard report is actually sent before the consumer key. I assume it is some sort of race condition because it happens infrequently and very irregularly. Waiting for about at least 10ms between sending the keyboard report and sending the consumer code has shown to fix this.
-                    wait_ms(10);
-                    register_code(mod_free_replacement);
-                }
+                key_override_printf("NOT KEY 2\n");
+                send_keyboard_report();
+                // On macOS there seems to be a race condition when it comes to the keyboard report and consumer keycodes. It seems the OS may recognize a consumer keycode before an updated keyboard report, even if the keyboard report is actually sent before the consumer key. I assume it is some sort of race condition because it happens infrequently and very irregularly. Waiting for about at least 10ms between sending the keyboard report and sending the consumer code has shown to fix this.
+                wait_ms(10);
+                register_code(mod_free_replacement);
             }
-        } else {
-            // If not registering the replacement key send keyboard report to update the unregistered keys.
-            send_keyboard_report();
         }
-
-        *activated = true;
-
-        // If the trigger is down, suppress the event so that it does not get added to the keyboard report.
-        return !trigger_down;
+    } else {
+        // If not registering the replacement key send keyboard report to update the unregistered keys.
+        send_keyboard_report();
     }
 
-    *activated = false;
+    *activated = true;
 
-    return true;
+    // If the trigger is down, suppress the event so that it does not get added to the keyboard report.
+    return !trigger_down;
 }
 
 void key_override_task(void) {
@@ -405,7 +556,7 @@ void key_override_task(void) {
     }
 }
 
-bool process_key_override(const uint16_t keycode, const keyrecord_t *const record) {
+bool process_key_override(uint16_t keycode, keyrecord_t *record) {
 #ifdef BENCH_KEY_OVERRIDE
     uint16_t start = timer_read();
 #endif
@@ -20,11 +20,78 @@
 #include "action_tapping.h"
 #include "action_util.h"
 #include "timer.h"
+#include "timeouts.h"
 #include "wait.h"
 #include "keymap_introspection.h"
 
-static uint16_t active_td;
-static uint16_t last_tap_time;
+#ifndef TAP_DANCE_MAX_CONCURRENT
+#    define TAP_DANCE_MAX_CONCURRENT 1
+#endif
+
+typedef struct {
+    tap_dance_action_t *action;
+    uint16_t            keycode;
+    uint32_t            deadline;
+} active_dance_t;
+
+// Dances that have not finished yet, in the order they started.
+static active_dance_t active_dances[TAP_DANCE_MAX_CONCURRENT];
+static uint8_t        active_dance_count;
+
+static inline bool deadline_before(uint32_t a, uint32_t b) {
+    return ((int32_t)TIMER_DIFF_32(a, b)) < 0;
+}
+
+static int8_t active_dance_find(tap_dance_action_t *action) {
+    for (uint8_t i = 0; i < active_dance_count; i++) {
+        if (active_dances[i].action == action) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static void active_dance_schedule(void) {
+    if (!active_dance_count) {
+        timeout_cancel(TIMEOUT_TAP_DANCE);
+        return;
+    }
+
+    uint32_t deadline = active_dances[0].deadline;
+    for (uint8_t i = 1; i < active_dance_count; i++) {
+        if (deadline_before(active_dances[i].deadline, deadline)) {
+            deadline = active_dances[i].deadline;
+        }
+    }
+    timeout_schedule(TIMEOUT_TAP_DANCE, deadline);
+}
+
+static void active_dance_remove(tap_dance_action_t *action) {
+    int8_t i = active_dance_find(action);
+    if (i < 0) {
+        return;
+    }
+    active_dance_count--;
+    for (; i < active_dance_count; i++) {
+        active_dances[i] = active_dances[i + 1];
+    }
+    active_dance_schedule();
+}
+
+static void active_dance_tap(tap_dance_action_t *action, uint16_t keycode) {
+    int8_t i = active_dance_find(action);
+    if (i < 0) {
+        // preprocess_tap_dance() has already made room for a new dance
+        i = active_dance_count < TAP_DANCE_MAX_CONCURRENT ? active_dance_count++ : TAP_DANCE_MAX_CONCURRENT - 1;
+    }
+    // The dance finishes once more than its tapping term has elapsed since this tap
+    active_dances[i] = (active_dance_t){
+        .action   = action,
+        .keycode  = keycode,
+        .deadline = timer_read32() + GET_TAPPING_TERM(keycode, &(keyrecord_t){}) + 1,
+    };
+    active_dance_schedule();
+}
 
 void tap_dance_pair_on_each_tap(tap_dance_state_t *state, void *user_data) {
     tap_dance_pair_t *pair = (tap_dance_pair_t *)user_data;
@@ -120,24 +187,37 @@ static inline void process_tap_dance_action_on_dance_finished(tap_dance_action_t
         send_keyboard_report();
         _process_tap_dance_action_fn(&action->state, action->user_data, action->fn.on_dance_finished);
     }
-    active_td = 0;
+    active_dance_remove(action);
     if (!action->state.pressed) {
         // There will not be a key release event, so reset now.
         process_tap_dance_action_on_reset(action);
     }
 }
 
-bool preprocess_tap_dance(uint16_t keycode, keyrecord_t *record) {
-    tap_dance_action_t *action;
+static void interrupt_tap_dance(tap_dance_action_t *action, uint16_t keycode) {
+    action->state.interrupted          = true;
+    action->state.interrupting_keycode = keycode;
+    process_tap_dance_action_on_dance_finished(action);
+}
 
+bool preprocess_tap_dance(uint16_t keycode, keyrecord_t *record) {
     if (!record->event.pressed) return false;
 
-    if (!active_td || keycode == active_td) return false;
+    if (!active_dance_count) return false;
 
-    action                             = tap_dance_get(QK_TAP_DANCE_GET_INDEX(active_td));
-    action->state.interrupted          = true;
-    action->state.interrupting_keycode = keycode;
-    process_tap_dance_action_on_dance_finished(action);
+    if (IS_QK_TAP_DANCE(keycode) && QK_TAP_DANCE_GET_INDEX(keycode) < tap_dance_count()) {
+        tap_dance_action_t *action = tap_dance_get(QK_TAP_DANCE_GET_INDEX(keycode));
+
+        // Another tap of an active dance, or a new dance that can run alongside the active ones.
+        if (active_dance_find(action) >= 0 || active_dance_count < TAP_DANCE_MAX_CONCURRENT) return false;
+
+        // Otherwise the oldest dance makes room for it.
+        interrupt_tap_dance(active_dances[0].action, keycode);
+    } else {
+        while (active_dance_count) {
+            interrupt_tap_dance(active_dances[0].action, keycode);
+        }
+    }
 
     // Tap dance actions can leave some weak mods active (e.g., if the tap dance is mapped to a keycode with
     // modifiers), but these weak mods should not affect the keypress which interrupted the tap dance.
@@ -164,16 +244,17 @@ bool process_tap_dance(uint16_t keycode, keyrecord_t *record) {
 
             action->state.pressed = record->event.pressed;
             if (record->event.pressed) {
-                last_tap_time = timer_read();
                 process_tap_dance_action_on_each_tap(action);
-                active_td = action->state.finished ? 0 : keycode;
+                if (action->state.finished) {
+                    active_dance_remove(action);
+                } else {
+                    active_dance_tap(action, keycode);
+                }
             } else {
                 process_tap_dance_action_on_each_release(action);
                 if (action->state.finished) {
                     process_tap_dance_action_on_reset(action);
-                    if (active_td == keycode) {
-                        active_td = 0;
-                    }
+                    active_dance_remove(action);
                 }
             }
 
@@ -184,17 +265,29 @@ bool process_tap_dance(uint16_t keycode, keyrecord_t *record) {
 }
 
 void tap_dance_task(void) {
-    tap_dance_action_t *action;
-
-    if (!active_td || timer_elapsed(last_tap_time) <= GET_TAPPING_TERM(active_td, &(keyrecord_t){})) return;
+    // Dances finish in the order they started, so a dance whose tapping term
+    // ran out also finishes the ones started before it.
+    uint32_t now     = timer_read32();
+    uint8_t  expired = 0;
+    for (uint8_t i = 0; i < active_dance_count; i++) {
+        if (!deadline_before(now, active_dances[i].deadline)) {
+            expired = i + 1;
+        }
+    }
 
-    action = tap_dance_get(QK_TAP_DANCE_GET_INDEX(active_td));
-    if (!action->state.interrupted) {
-        process_tap_dance_action_on_dance_finished(action);
+    while (expired-- && active_dance_count) {
+        tap_dance_action_t *action = active_dances[0].action;
+        if (!action->state.interrupted) {
+            process_tap_dance_action_on_dance_finished(action);
+        } else {
+            active_dance_remove(action);
+        }
     }
+
+    active_dance_schedule();
 }
 
 void reset_tap_dance(tap_dance_state_t *state) {
-    active_td = 0;
+    active_dance_remove((tap_dance_action_t *)state);
     process_tap_dance_action_on_reset((tap_dance_action_t *)state);
 }
@@ -84,6 +84,14 @@
 #    include "process_layer_lock.h"
 #endif
 
+#ifdef NVM_CACHE_ENABLE
+#    include "nvm_cache.h"
+#endif
+
+#ifdef EEPROM_DRIVER
+#    include "eeprom_driver.h"
+#endif
+
 #ifdef AUDIO_ENABLE
 #    ifndef GOODBYE_SONG
 #        define GOODBYE_SONG SONG(GOODBYE_SOUND)
@@ -208,6 +216,13 @@ __attribute__((weak)) void suspend_wakeup_init_modules(void) {}
 
 void shutdown_quantum(bool jump_to_bootloader) {
     clear_keyboard();
+#ifdef NVM_CACHE_ENABLE
+    // Settings changed just before a reset would otherwise be lost
+    nvm_cache_flush();
+#endif
+#ifdef EEPROM_DRIVER
+    eeprom_driver_flush();
+#endif
 #if defined(MIDI_ENABLE) && defined(MIDI_BASIC)
     process_midi_all_notes_off();
 #endif
@@ -292,154 +307,199 @@ void post_process_record_quantum(keyrecord_t *record) {
     post_process_record_kb(keycode, record);
 }
 
-/* Core keycode function, hands off handling to other functions,
-    then processes internal quantum keycodes, and then processes
-    ACTIONs.                                                      */
-bool process_record_quantum(keyrecord_t *record) {
-    uint16_t keycode = get_record_keycode(record, true);
-
-    // This is how you use actions here
-    // if (keycode == QK_LEADER) {
-    //   action_t action;
-    //   action.code = ACTION_DEFAULT_LAYER_SET(0);
-    //   process_action(record, action);
-    //   return false;
-    // }
-
-#if defined(SECURE_ENABLE)
-    if (!preprocess_secure(keycode, record)) {
-        return false;
-    }
-#endif
-
-#ifdef TAP_DANCE_ENABLE
-    if (preprocess_tap_dance(keycode, record)) {
-        // The tap dance might have updated the layer state, therefore the
-        // result of the keycode lookup might change.
-        keycode = get_record_keycode(record, true);
-    }
-#endif
+/* The process_record handlers of all enabled features, in the order they get to see each record. Handlers that only
+ * act on their own keycodes are given that range, so a record outside of it skips them without a call; handlers that
+ * react to any key (recording, cancelling or mode-dependent features) cover the whole keycode space. Ranges may be
+ * wider than what a handler actually handles, but must never exclude anything it acts on. */
+typedef bool (*process_record_handler_func_t)(uint16_t keycode, keyrecord_t *record);
 
-#ifdef RGBLIGHT_ENABLE
-    if (record->event.pressed) {
-        preprocess_rgblight();
-    }
-#endif
+typedef struct {
+    process_record_handler_func_t handler;
+    uint16_t                      first;
+    uint16_t                      last;
+} process_record_handler_t;
 
-#ifdef WPM_ENABLE
-    if (record->event.pressed) {
-        update_wpm(keycode);
-    }
-#endif
+#define PROCESS_ALL(handler) {handler, 0x0000, 0xFFFF}
+#define PROCESS_RANGE(handler, first, last) {handler, first, last}
 
-    if (!(
-#if defined(KEY_LOCK_ENABLE)
-            // Must run first to be able to mask key_up events.
-            process_key_lock(&keycode, record) &&
-#endif
+// clang-format off
+static const process_record_handler_t process_record_handler_table[] PROGMEM = {
 #if defined(DYNAMIC_MACRO_ENABLE) && !defined(DYNAMIC_MACRO_USER_CALL)
-            // Must run asap to ensure all keypresses are recorded.
-            process_dynamic_macro(keycode, record) &&
+    // Must run asap to ensure all keypresses are recorded.
+    PROCESS_ALL(process_dynamic_macro),
 #endif
 #ifdef REPEAT_KEY_ENABLE
-            process_last_key(keycode, record) && process_repeat_key(keycode, record) &&
+    PROCESS_ALL(process_last_key),
+    PROCESS_ALL(process_repeat_key),
 #endif
 #if defined(AUDIO_ENABLE) && defined(AUDIO_CLICKY)
-            process_clicky(keycode, record) &&
+    PROCESS_ALL(process_clicky),
 #endif
 #ifdef HAPTIC_ENABLE
-            process_haptic(keycode, record) &&
+    PROCESS_ALL(process_haptic),
 #endif
 #if defined(POINTING_DEVICE_ENABLE) && defined(POINTING_DEVICE_AUTO_MOUSE_ENABLE)
-            process_auto_mouse(keycode, record) &&
+    PROCESS_ALL(process_auto_mouse),
 #endif
-            process_record_modules(keycode, record) && // modules must run before kb
-            process_record_kb(keycode, record) &&
+    PROCESS_ALL(process_record_modules), // modules must run before kb
+    PROCESS_ALL(process_record_kb),
 #if defined(VIA_ENABLE)
-            process_record_via(keycode, record) &&
+    PROCESS_RANGE(process_record_via, QK_MACRO, QK_MACRO_MAX),
 #endif
 #if defined(SECURE_ENABLE)
-            process_secure(keycode, record) &&
+    PROCESS_ALL(process_secure),
 #endif
 #if defined(SEQUENCER_ENABLE)
-            process_sequencer(keycode, record) &&
+    PROCESS_RANGE(process_sequencer, QK_SEQUENCER, QK_SEQUENCER_MAX),
 #endif
 #if defined(MIDI_ENABLE) && defined(MIDI_ADVANCED)
-            process_midi(keycode, record) &&
+    PROCESS_RANGE(process_midi, QK_MIDI, QK_MIDI_MAX),
 #endif
 #ifdef AUDIO_ENABLE
-            process_audio(keycode, record) &&
+    PROCESS_RANGE(process_audio, QK_AUDIO, QK_AUDIO_MAX),
 #endif
 #if defined(BACKLIGHT_ENABLE)
-            process_backlight(keycode, record) &&
+    PROCESS_RANGE(process_backlight, QK_LIGHTING, QK_LIGHTING_MAX),
 #endif
 #if defined(LED_MATRIX_ENABLE)
-            process_led_matrix(keycode, record) &&
+    PROCESS_RANGE(process_led_matrix, QK_LIGHTING, QK_LIGHTING_MAX),
 #endif
 #ifdef STENO_ENABLE
-            process_steno(keycode, record) &&
+    PROCESS_RANGE(process_steno, QK_STENO, QK_STENO_MAX),
 #endif
 #if (defined(AUDIO_ENABLE) || (defined(MIDI_ENABLE) && defined(MIDI_BASIC))) && !defined(NO_MUSIC_MODE)
-            process_music(keycode, record) &&
+    PROCESS_ALL(process_music),
 #endif
 #ifdef CAPS_WORD_ENABLE
-            process_caps_word(keycode, record) &&
+    PROCESS_ALL(process_caps_word),
 #endif
 #ifdef KEY_OVERRIDE_ENABLE
-            process_key_override(keycode, record) &&
+    PROCESS_ALL(process_key_override),
 #endif
 #ifdef TAP_DANCE_ENABLE
-            process_tap_dance(keycode, record) &&
+    PROCESS_ALL(process_tap_dance),
 #endif
 #if defined(UNICODE_COMMON_ENABLE)
-            process_unicode_common(keycode, record) &&
+#    ifdef UCIS_ENABLE
+    PROCESS_ALL(process_unicode_common),
+#    else
+    // Input mode keycodes, followed by QK_UNICODE/QK_UNICODEMAP
+    PROCESS_RANGE(process_unicode_common, QK_QUANTUM, QK_UNICODE_MAX),
+#    endif
 #endif
 #ifdef LEADER_ENABLE
-            process_leader(keycode, record) &&
+    PROCESS_ALL(process_leader),
 #endif
 #ifdef AUTO_SHIFT_ENABLE
-            process_auto_shift(keycode, record) &&
+    PROCESS_ALL(process_auto_shift),
 #endif
 #ifdef DYNAMIC_TAPPING_TERM_ENABLE
-            process_dynamic_tapping_term(keycode, record) &&
+    PROCESS_RANGE(process_dynamic_tapping_term, QK_QUANTUM, QK_QUANTUM_MAX),
 #endif
 #ifdef SPACE_CADET_ENABLE
-            process_space_cadet(keycode, record) &&
+    PROCESS_ALL(process_space_cadet),
 #endif
 #ifdef MAGIC_ENABLE
-            process_magic(keycode, record) &&
+    PROCESS_RANGE(process_magic, QK_MAGIC, QK_MAGIC_MAX),
 #endif
 #ifdef GRAVE_ESC_ENABLE
-            process_grave_esc(keycode, record) &&
+    PROCESS_RANGE(process_grave_esc, QK_GRAVE_ESCAPE, QK_GRAVE_ESCAPE),
 #endif
 #if defined(RGBLIGHT_ENABLE) || defined(RGB_MATRIX_ENABLE)
-            process_underglow(keycode, record) &&
+    PROCESS_RANGE(process_underglow, QK_LIGHTING, QK_LIGHTING_MAX),
 #endif
 #if defined(RGB_MATRIX_ENABLE)
-            process_rgb_matrix(keycode, record) &&
+    PROCESS_RANGE(process_rgb_matrix, QK_LIGHTING, QK_LIGHTING_MAX),
 #endif
 #ifdef JOYSTICK_ENABLE
-            process_joystick(keycode, record) &&
+    PROCESS_RANGE(process_joystick, QK_JOYSTICK, QK_JOYSTICK_MAX),
 #endif
 #ifdef PROGRAMMABLE_BUTTON_ENABLE
-            process_programmable_button(keycode, record) &&
+    PROCESS_RANGE(process_programmable_button, QK_PROGRAMMABLE_BUTTON, QK_PROGRAMMABLE_BUTTON_MAX),
 #endif
 #ifdef AUTOCORRECT_ENABLE
-            process_autocorrect(keycode, record) &&
+    PROCESS_ALL(process_autocorrect),
 #endif
 #ifdef TRI_LAYER_ENABLE
-            process_tri_layer(keycode, record) &&
+    PROCESS_RANGE(process_tri_layer, QK_TRI_LAYER_LOWER, QK_TRI_LAYER_UPPER),
 #endif
 #if !defined(NO_ACTION_LAYER)
-            process_default_layer(keycode, record) &&
+    PROCESS_RANGE(process_default_layer, QK_PERSISTENT_DEF_LAYER, QK_PERSISTENT_DEF_LAYER_MAX),
 #endif
 #ifdef LAYER_LOCK_ENABLE
-            process_layer_lock(keycode, record) &&
+    PROCESS_ALL(process_layer_lock),
 #endif
 #ifdef CONNECTION_ENABLE
-            process_connection(keycode, record) &&
+    PROCESS_RANGE(process_connection, QK_CONNECTION, QK_CONNECTION_MAX),
 #endif
-            true)) {
+};
+// clang-format on
+
+static bool process_record_handlers(uint16_t keycode, keyrecord_t *record) {
+    for (uint8_t i = 0; i < ARRAY_SIZE(process_record_handler_table); i++) {
+        const process_record_handler_t *entry = &process_record_handler_table[i];
+
+        uint16_t first = pgm_read_word(&entry->first);
+        if ((uint16_t)(keycode - first) > (uint16_t)(pgm_read_word(&entry->last) - first)) {
+            continue;
+        }
+
+        process_record_handler_func_t handler = (process_record_handler_func_t)pgm_read_ptr(&entry->handler);
+        if (!handler(keycode, record)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/* Core keycode function, hands off handling to other functions,
+    then processes internal quantum keycodes, and then processes
+    ACTIONs.                                                      */
+bool process_record_quantum(keyrecord_t *record) {
+    uint16_t keycode = get_record_keycode(record, true);
+
+    // This is how you use actions here
+    // if (keycode == QK_LEADER) {
+    //   action_t action;
+    //   action.code = ACTION_DEFAULT_LAYER_SET(0);
+    //   process_action(record, action);
+    //   return false;
+    // }
+
+#if defined(SECURE_ENABLE)
+    if (!preprocess_secure(keycode, record)) {
+        return false;
+    }
+#endif
+
+#ifdef TAP_DANCE_ENABLE
+    if (preprocess_tap_dance(keycode, record)) {
+        // The tap dance might have updated the layer state, therefore the
+        // result of the keycode lookup might change.
+        keycode = get_record_keycode(record, true);
+    }
+#endif
+
+#ifdef RGBLIGHT_ENABLE
+    if (record->event.pressed) {
+        preprocess_rgblight();
+    }
+#endif
+
+#ifdef WPM_ENABLE
+    if (record->event.pressed) {
+        update_wpm(keycode);
+    }
+#endif
+
+#if defined(KEY_LOCK_ENABLE)
+    // Must run first to be able to mask key_up events.
+    if (!process_key_lock(&keycode, record)) {
+        return false;
+    }
+#endif
+
+    if (!process_record_handlers(keycode, record)) {
         return false;
     }
 
@@ -550,6 +610,12 @@ __attribute__((weak)) bool shutdown_kb(bool jump_to_bootloader) {
 void suspend_power_down_quantum(void) {
     suspend_power_down_modules();
     suspend_power_down_kb();
+#ifdef NVM_CACHE_ENABLE
+    nvm_cache_flush();
+#endif
+#ifdef EEPROM_DRIVER
+    eeprom_driver_flush();
+#endif
 #ifndef NO_SUSPEND_POWER_DOWN
 // Turn off backlight
 #    ifdef BACKLIGHT_ENABLE
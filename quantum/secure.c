@@ -3,6 +3,7 @@
 
 #include "secure.h"
 #include "timer.h"
+#include "timeouts.h"
 #include "util.h"
 
 #ifndef SECURE_UNLOCK_TIMEOUT
@@ -35,12 +36,18 @@ secure_status_t secure_get_status(void) {
 
 void secure_lock(void) {
     secure_status = SECURE_LOCKED;
+    timeout_cancel(TIMEOUT_SECURE);
     secure_hook(secure_status);
 }
 
 void secure_unlock(void) {
     secure_status = SECURE_UNLOCKED;
     idle_time     = timer_read32();
+#if SECURE_IDLE_TIMEOUT != 0
+    timeout_schedule(TIMEOUT_SECURE, idle_time + SECURE_IDLE_TIMEOUT);
+#else
+    timeout_cancel(TIMEOUT_SECURE);
+#endif
     secure_hook(secure_status);
 }
 
@@ -48,6 +55,9 @@ void secure_request_unlock(void) {
     if (secure_status == SECURE_LOCKED) {
         secure_status = SECURE_PENDING;
         unlock_time   = timer_read32();
+#if SECURE_UNLOCK_TIMEOUT != 0
+        timeout_schedule(TIMEOUT_SECURE, unlock_time + SECURE_UNLOCK_TIMEOUT);
+#endif
     }
     secure_hook(secure_status);
 }
@@ -55,6 +65,9 @@ void secure_request_unlock(void) {
 void secure_activity_event(void) {
     if (secure_status == SECURE_UNLOCKED) {
         idle_time = timer_read32();
+#if SECURE_IDLE_TIMEOUT != 0
+        timeout_schedule(TIMEOUT_SECURE, idle_time + SECURE_IDLE_TIMEOUT);
+#endif
     }
 }
 
@@ -22,7 +22,13 @@
 #include "quantum_keycodes.h"
 #include "keycode.h"
 #include "action.h"
+#include "action_util.h"
+#include "host.h"
+#include "keycode_config.h"
+#include "report.h"
+#include "util.h"
 #include "wait.h"
+#include "timer.h"
 
 #if defined(AUDIO_ENABLE) && defined(SENDSTRING_BELL)
 #    include "audio.h"
@@ -32,6 +38,10 @@
 float bell_song[][2] = SONG(BELL_SOUND);
 #endif
 
+#ifndef SEND_STRING_BULK_MAX_KEYS
+#    define SEND_STRING_BULK_MAX_KEYS 16
+#endif
+
 // clang-format off
 
 /* Bit-Packed look-up table to convert an ASCII character to whether
@@ -150,43 +160,49 @@ void send_string(const char *string) {
     send_string_with_delay(string, TAP_CODE_DELAY);
 }
 
-void send_string_with_delay_impl(char (*getter)(void *), void *arg, uint8_t interval) {
-    while (1) {
-        char ascii_code = getter(arg);
-        if (!ascii_code) break;
-        if (ascii_code == SS_QMK_PREFIX) {
+/* Handles the send_string sequence (SS_TAP, SS_DOWN, SS_UP or SS_DELAY) that follows an SS_QMK_PREFIX. Returns false
+ * if the string ended within the sequence. */
+static bool send_string_sequence(char (*getter)(void *), void *arg, uint8_t interval) {
+    char ascii_code = getter(arg);
+
+    if (ascii_code == SS_TAP_CODE) {
+        // tap
+        uint8_t keycode = getter(arg);
+        tap_code(keycode);
+    } else if (ascii_code == SS_DOWN_CODE) {
+        // down
+        uint8_t keycode = getter(arg);
+        register_code(keycode);
+    } else if (ascii_code == SS_UP_CODE) {
+        // up
+        uint8_t keycode = getter(arg);
+        unregister_code(keycode);
+    } else if (ascii_code == SS_DELAY_CODE) {
+        // delay
+        int ms     = 0;
+        ascii_code = getter(arg);
+
+        while (isdigit(ascii_code)) {
+            ms *= 10;
+            ms += ascii_code - '0';
             ascii_code = getter(arg);
+        }
 
-            if (ascii_code == SS_TAP_CODE) {
-                // tap
-                uint8_t keycode = getter(arg);
-                tap_code(keycode);
-            } else if (ascii_code == SS_DOWN_CODE) {
-                // down
-                uint8_t keycode = getter(arg);
-                register_code(keycode);
-            } else if (ascii_code == SS_UP_CODE) {
-                // up
-                uint8_t keycode = getter(arg);
-                unregister_code(keycode);
-            } else if (ascii_code == SS_DELAY_CODE) {
-                // delay
-                int ms     = 0;
-                ascii_code = getter(arg);
-
-                while (isdigit(ascii_code)) {
-                    ms *= 10;
-                    ms += ascii_code - '0';
-                    ascii_code = getter(arg);
-                }
+        wait_ms(ms);
+    }
 
-                wait_ms(ms);
-            }
+    wait_ms(interval);
 
-            wait_ms(interval);
+    // if we had a delay that terminated with a null, we're done
+    return ascii_code != 0;
+}
 
-            // if we had a delay that terminated with a null, we're done
-            if (ascii_code == 0) break;
+void send_string_with_delay_impl(char (*getter)(void *), void *arg, uint8_t interval) {
+    while (1) {
+        char ascii_code = getter(arg);
+        if (!ascii_code) break;
+        if (ascii_code == SS_QMK_PREFIX) {
+            if (!send_string_sequence(getter, arg, interval)) break;
         } else {
             send_char_with_delay(ascii_code, interval);
         }
@@ -209,6 +225,118 @@ void send_string_with_delay(const char *string, uint8_t interval) {
     send_string_with_delay_impl(send_string_get_next_ram, &state, interval);
 }
 
+void send_string_bulk(const char *string) {
+    send_string_bulk_with_delay(string, TAP_CODE_DELAY);
+}
+
+void send_string_bulk_with_delay(const char *string, uint8_t interval) {
+    send_string_memory_state_t state = {string};
+    send_string_bulk_with_delay_impl(send_string_get_next_ram, &state, interval);
+}
+
+/* Moves the held send_string modifiers from `from` to `to`, in the same order send_char_with_delay() uses. */
+static void bulk_set_mods(uint8_t from, uint8_t to, uint8_t interval) {
+    if ((from & ~to) & MOD_BIT(KC_RIGHT_ALT)) {
+        unregister_code(KC_RIGHT_ALT);
+        wait_ms(interval);
+    }
+    if ((from & ~to) & MOD_BIT(KC_LEFT_SHIFT)) {
+        unregister_code(KC_LEFT_SHIFT);
+        wait_ms(interval);
+    }
+    if ((to & ~from) & MOD_BIT(KC_LEFT_SHIFT)) {
+        register_code(KC_LEFT_SHIFT);
+        wait_ms(interval);
+    }
+    if ((to & ~from) & MOD_BIT(KC_RIGHT_ALT)) {
+        register_code(KC_RIGHT_ALT);
+        wait_ms(interval);
+    }
+}
+
+/* Presses all keys of a batch in a single report, then releases them in a single report. */
+static void bulk_send_keys(const uint8_t *keys, uint8_t count, uint8_t interval) {
+    if (!count) return;
+
+    for (uint8_t i = 0; i < count; i++) {
+        add_key(keys[i]);
+    }
+    send_keyboard_report();
+    wait_ms(interval);
+
+    for (uint8_t i = 0; i < count; i++) {
+        del_key(keys[i]);
+    }
+    send_keyboard_report();
+    wait_ms(interval);
+}
+
+/* How many keys a batch may press at once, given the keys already held in the report. */
+static uint8_t bulk_key_limit(void) {
+#ifdef NKRO_ENABLE
+    if (host_can_send_nkro() && keymap_config.nkro) {
+        return SEND_STRING_BULK_MAX_KEYS;
+    }
+#endif
+    uint8_t held  = has_anykey();
+    uint8_t limit = held < KEYBOARD_REPORT_KEYS ? KEYBOARD_REPORT_KEYS - held : 1;
+    return MIN(limit, SEND_STRING_BULK_MAX_KEYS);
+}
+
+void send_string_bulk_with_delay_impl(char (*getter)(void *), void *arg, uint8_t interval) {
+    uint8_t batch[SEND_STRING_BULK_MAX_KEYS];
+    uint8_t batch_count = 0;
+    uint8_t batch_mods  = 0;
+    uint8_t held_mods   = 0;
+    uint8_t limit       = bulk_key_limit();
+
+    while (1) {
+        char    ascii_code = getter(arg);
+        uint8_t keycode    = KC_NO;
+        uint8_t mods       = 0;
+
+        if (ascii_code && ascii_code != SS_QMK_PREFIX && !PGM_LOADBIT(ascii_to_dead_lut, (uint8_t)ascii_code)) {
+            keycode = pgm_read_byte(&ascii_to_keycode_lut[(uint8_t)ascii_code]);
+            if (PGM_LOADBIT(ascii_to_shift_lut, (uint8_t)ascii_code)) mods |= MOD_BIT(KC_LEFT_SHIFT);
+            if (PGM_LOADBIT(ascii_to_altgr_lut, (uint8_t)ascii_code)) mods |= MOD_BIT(KC_RIGHT_ALT);
+#if defined(AUDIO_ENABLE) && defined(SENDSTRING_BELL)
+            if (ascii_code == '\a') keycode = KC_NO;
+#endif
+            if (!IS_BASIC_KEYCODE(keycode)) keycode = KC_NO;
+        }
+
+        /* Keys can only share a report if they are distinct and need the same modifiers. They also have to be in
+         * ascending order, as hosts process the keys of a report in usage order rather than the order they were
+         * added in. */
+        if (keycode != KC_NO && batch_count > 0 && batch_count < limit && mods == batch_mods && keycode > batch[batch_count - 1]) {
+            batch[batch_count++] = keycode;
+            continue;
+        }
+
+        bulk_send_keys(batch, batch_count, interval);
+        batch_count = 0;
+
+        if (keycode != KC_NO) {
+            bulk_set_mods(held_mods, mods, interval);
+            held_mods            = mods;
+            batch_mods           = mods;
+            batch[batch_count++] = keycode;
+            continue;
+        }
+
+        // Anything that cannot be batched is sent the regular way, without any of our modifiers held
+        bulk_set_mods(held_mods, 0, interval);
+        held_mods = 0;
+
+        if (!ascii_code) break;
+        if (ascii_code == SS_QMK_PREFIX) {
+            if (!send_string_sequence(getter, arg, interval)) break;
+        } else {
+            send_char_with_delay(ascii_code, interval);
+        }
+    }
+}
+
 void send_char(char ascii_code) {
     send_char_with_delay(ascii_code, TAP_CODE_DELAY);
 }
@@ -325,4 +453,233 @@ void send_string_with_delay_P(const char *string, uint8_t interval) {
     send_string_memory_state_t state = {string};
     send_string_with_delay_impl(send_string_get_next_progmem, &state, interval);
 }
+
+void send_string_bulk_with_delay_P(const char *string, uint8_t interval) {
+    send_string_memory_state_t state = {string};
+    send_string_bulk_with_delay_impl(send_string_get_next_progmem, &state, interval);
+}
+#endif
+
+#ifdef SEND_STRING_ASYNC_BUFFER_SIZE
+/* Queued strings are stored back to back in a ring buffer, each one as its
+ * interval followed by the string including its terminating null. Only whole
+ * strings are ever queued, so the task never sees a partial one. */
+static char     async_buffer[SEND_STRING_ASYNC_BUFFER_SIZE];
+static uint16_t async_read  = 0;
+static uint16_t async_write = 0;
+static uint16_t async_used  = 0;
+
+/* Key events needed to type the current character, each one followed by a
+ * wait of `wait` ms. A KC_NO step is a plain wait. */
+typedef struct {
+    uint8_t  keycode;
+    bool     pressed;
+    uint16_t wait;
+} send_string_async_step_t;
+
+static send_string_async_step_t async_steps[8];
+static uint8_t                  async_step_count = 0;
+static uint8_t                  async_step_index = 0;
+static uint16_t                 async_step_timer = 0;
+static uint16_t                 async_step_wait  = 0;
+static bool                     async_in_string  = false;
+static uint8_t                  async_interval   = 0;
+
+static char async_pop(void) {
+    char c     = async_buffer[async_read];
+    async_read = (async_read + 1) % SEND_STRING_ASYNC_BUFFER_SIZE;
+    async_used--;
+    return c;
+}
+
+static void async_add_step(uint8_t keycode, bool pressed, uint16_t wait) {
+    async_steps[async_step_count++] = (send_string_async_step_t){
+        .keycode = keycode,
+        .pressed = pressed,
+        .wait    = wait,
+    };
+}
+
+static void async_add_tap(uint8_t keycode, uint8_t interval) {
+    // Same as tap_code() followed by wait_ms(interval)
+    async_add_step(keycode, true, keycode == KC_CAPS_LOCK ? TAP_HOLD_CAPS_DELAY : TAP_CODE_DELAY);
+    async_add_step(keycode, false, interval);
+}
+
+static void async_add_char(char ascii_code, uint8_t interval) {
+    // Same sequence as send_char_with_delay()
+    uint8_t keycode    = pgm_read_byte(&ascii_to_keycode_lut[(uint8_t)ascii_code]);
+    bool    is_shifted = PGM_LOADBIT(ascii_to_shift_lut, (uint8_t)ascii_code);
+    bool    is_altgred = PGM_LOADBIT(ascii_to_altgr_lut, (uint8_t)ascii_code);
+    bool    is_dead    = PGM_LOADBIT(ascii_to_dead_lut, (uint8_t)ascii_code);
+
+    if (is_shifted) {
+        async_add_step(KC_LEFT_SHIFT, true, interval);
+    }
+    if (is_altgred) {
+        async_add_step(KC_RIGHT_ALT, true, interval);
+    }
+    async_add_step(keycode, true, interval);
+    async_add_step(keycode, false, interval);
+    if (is_altgred) {
+        async_add_step(KC_RIGHT_ALT, false, interval);
+    }
+    if (is_shifted) {
+        async_add_step(KC_LEFT_SHIFT, false, interval);
+    }
+    if (is_dead) {
+        async_add_tap(KC_SPACE, interval);
+    }
+}
+
+/* Decodes the next character or send_string sequence from the queue into steps. Returns false if the queue is empty. */
+static bool async_next_steps(void) {
+    async_step_count = 0;
+    async_step_index = 0;
+
+    while (async_step_count == 0) {
+        if (!async_in_string) {
+            if (async_used == 0) {
+                return false;
+            }
+            async_interval  = async_pop();
+            async_in_string = true;
+        }
+
+        char ascii_code = async_pop();
+        if (!ascii_code) {
+            async_in_string = false;
+        } else if (ascii_code == SS_QMK_PREFIX) {
+            ascii_code = async_pop();
+
+            if (ascii_code == SS_TAP_CODE || ascii_code == SS_DOWN_CODE || ascii_code == SS_UP_CODE) {
+                uint8_t keycode = async_pop();
+                if (!keycode) {
+                    // truncated sequence, the string ends here
+                    async_in_string = false;
+                } else if (ascii_code == SS_TAP_CODE) {
+                    async_add_tap(keycode, async_interval);
+                } else {
+                    async_add_step(keycode, ascii_code == SS_DOWN_CODE, async_interval);
+                }
+            } else if (ascii_code == SS_DELAY_CODE) {
+                uint16_t ms = 0;
+                ascii_code  = async_pop();
+
+                while (isdigit(ascii_code)) {
+                    ms *= 10;
+                    ms += ascii_code - '0';
+                    ascii_code = async_pop();
+                }
+
+                async_add_step(KC_NO, false, ms + async_interval);
+            } else {
+                async_add_step(KC_NO, false, async_interval);
+            }
+
+            // if the sequence terminated with a null, the string is done
+            if (ascii_code == 0) {
+                async_in_string = false;
+            }
+#    if defined(AUDIO_ENABLE) && defined(SENDSTRING_BELL)
+        } else if (ascii_code == '\a') { // BEL
+            PLAY_SONG(bell_song);
+#    endif
+        } else {
+            async_add_char(ascii_code, async_interval);
+        }
+    }
+
+    return true;
+}
+
+static bool async_push(uint16_t *write, uint16_t *used, char c) {
+    if (*used == SEND_STRING_ASYNC_BUFFER_SIZE) {
+        return false;
+    }
+    async_buffer[*write] = c;
+    *write               = (*write + 1) % SEND_STRING_ASYNC_BUFFER_SIZE;
+    (*used)++;
+    return true;
+}
+
+bool send_string_async_with_delay_impl(char (*getter)(void *), void *arg, uint8_t interval) {
+    uint16_t write = async_write;
+    uint16_t used  = async_used;
+
+    // Nothing is committed until the whole string fits, so a failed attempt leaves the queue untouched.
+    if (!async_push(&write, &used, (char)interval)) {
+        return false;
+    }
+    char c;
+    do {
+        c = getter(arg);
+        if (!async_push(&write, &used, c)) {
+            return false;
+        }
+    } while (c);
+
+    async_write = write;
+    async_used  = used;
+    return true;
+}
+
+bool send_string_async_with_delay(const char *string, uint8_t interval) {
+    send_string_memory_state_t state = {string};
+    return send_string_async_with_delay_impl(send_string_get_next_ram, &state, interval);
+}
+
+bool send_string_async(const char *string) {
+    return send_string_async_with_delay(string, TAP_CODE_DELAY);
+}
+
+#    if defined(__AVR__)
+bool send_string_async_with_delay_P(const char *string, uint8_t interval) {
+    send_string_memory_state_t state = {string};
+    return send_string_async_with_delay_impl(send_string_get_next_progmem, &state, interval);
+}
+#    endif
+
+bool is_send_string_async_active(void) {
+    return async_used > 0 || async_in_string || async_step_index < async_step_count || async_step_wait > 0;
+}
+
+static void async_run_step(void) {
+    send_string_async_step_t *step = &async_steps[async_step_index++];
+    if (step->keycode != KC_NO) {
+        if (step->pressed) {
+            register_code(step->keycode);
+        } else {
+            unregister_code(step->keycode);
+        }
+    }
+    async_step_timer = timer_read();
+    async_step_wait  = step->wait;
+}
+
+void send_string_async_task(void) {
+    if (async_step_wait > 0) {
+        if (timer_elapsed(async_step_timer) < async_step_wait) {
+            return;
+        }
+        async_step_wait = 0;
+    }
+
+    // One key event per call, so the rest of the keyboard keeps running between them.
+    if (async_step_index < async_step_count || async_next_steps()) {
+        async_run_step();
+    }
+}
+
+void send_string_async_flush(void) {
+    while (is_send_string_async_active()) {
+        if (async_step_wait > 0) {
+            wait_ms(async_step_wait);
+            async_step_wait = 0;
+        }
+        if (async_step_index < async_step_count || async_next_steps()) {
+            async_run_step();
+        }
+    }
+}
 #endif
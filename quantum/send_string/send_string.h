@@ -24,6 +24,7 @@
  */
 
 #include <stdint.h>
+#include <stdbool.h>
 
 #include "progmem.h"
 #include "send_string_keycodes.h"
@@ -169,4 +170,114 @@ void send_string_with_delay_P(const char *string, uint8_t interval);
  */
 void send_string_with_delay_impl(char (*getter)(void *), void *arg, uint8_t interval);
 
+/**
+ * \brief Type out a string of ASCII characters, pressing several characters in the same report where possible.
+ *
+ * Runs of characters that need the same modifiers and whose keycodes are distinct and ascending are pressed together
+ * in one report and released together in the next, as long as the keyboard report has room for them. Everything else
+ * is typed out exactly like send_string() would.
+ *
+ * \param string The string to type out.
+ */
+void send_string_bulk(const char *string);
+
+/**
+ * \brief Type out a string of ASCII characters in batches, see send_string_bulk(), with a delay between each report.
+ *
+ * \param string The string to type out.
+ * \param interval The amount of time, in milliseconds, to wait after each report.
+ */
+void send_string_bulk_with_delay(const char *string, uint8_t interval);
+
+#if defined(__AVR__) || defined(__DOXYGEN__)
+/**
+ * \brief Type out a PROGMEM string of ASCII characters in batches, with a delay between each report.
+ *
+ * On ARM devices, this function is simply an alias for send_string_bulk_with_delay(string, interval).
+ *
+ * \param string The string to type out.
+ * \param interval The amount of time, in milliseconds, to wait after each report.
+ */
+void send_string_bulk_with_delay_P(const char *string, uint8_t interval);
+#else
+#    define send_string_bulk_with_delay_P(string, interval) send_string_bulk_with_delay(string, interval)
+#endif
+
+/**
+ * \brief Shortcut macro for send_string_bulk_with_delay_P(PSTR(string), 0).
+ */
+#define SEND_STRING_BULK(string) send_string_bulk_with_delay_P(PSTR(string), 0)
+
+/**
+ * \brief Batched counterpart of send_string_with_delay_impl().
+ */
+void send_string_bulk_with_delay_impl(char (*getter)(void *), void *arg, uint8_t interval);
+
+#if defined(SEND_STRING_ASYNC_BUFFER_SIZE) || defined(__DOXYGEN__)
+/**
+ * \brief Queue a string of ASCII characters to be typed out from the main loop.
+ *
+ * Unlike send_string(), this returns immediately. The string is copied into a buffer of `SEND_STRING_ASYNC_BUFFER_SIZE`
+ * bytes and typed out one key event at a time by send_string_async_task(), so the rest of the keyboard keeps running.
+ *
+ * \param string The string to type out.
+ *
+ * \return `false` if the string did not fit in the buffer, in which case nothing is queued.
+ */
+bool send_string_async(const char *string);
+
+/**
+ * \brief Queue a string of ASCII characters to be typed out from the main loop, with a delay between each character.
+ *
+ * \param string The string to type out.
+ * \param interval The amount of time, in milliseconds, to wait before typing the next character.
+ *
+ * \return `false` if the string did not fit in the buffer, in which case nothing is queued.
+ */
+bool send_string_async_with_delay(const char *string, uint8_t interval);
+
+#    if defined(__AVR__) || defined(__DOXYGEN__)
+/**
+ * \brief Queue a PROGMEM string of ASCII characters to be typed out from the main loop, with a delay between each character.
+ *
+ * On ARM devices, this function is simply an alias for send_string_async_with_delay(string, interval).
+ *
+ * \param string The string to type out.
+ * \param interval The amount of time, in milliseconds, to wait before typing the next character.
+ *
+ * \return `false` if the string did not fit in the buffer, in which case nothing is queued.
+ */
+bool send_string_async_with_delay_P(const char *string, uint8_t interval);
+#    else
+#        define send_string_async_with_delay_P(string, interval) send_string_async_with_delay(string, interval)
+#    endif
+
+/**
+ * \brief Shortcut macro for send_string_async_with_delay_P(PSTR(string), 0).
+ */
+#    define SEND_STRING_ASYNC(string) send_string_async_with_delay_P(PSTR(string), 0)
+
+/**
+ * \brief Queue the string returned by the getter function, see send_string_with_delay_impl().
+ *
+ * \return `false` if the string did not fit in the buffer, in which case nothing is queued.
+ */
+bool send_string_async_with_delay_impl(char (*getter)(void *), void *arg, uint8_t interval);
+
+/**
+ * \brief Whether queued strings are still being typed out.
+ */
+bool is_send_string_async_active(void);
+
+/**
+ * \brief Type out everything still queued, blocking until done.
+ */
+void send_string_async_flush(void);
+
+/**
+ * \brief Types out the next key event of the queued strings once its delay has passed. Called from the main loop.
+ */
+void send_string_async_task(void);
+#endif
+
 /** \} */
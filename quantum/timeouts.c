@@ -0,0 +1,73 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "timeouts.h"
+#include "compiler_support.h"
+#include "timer.h"
+
+STATIC_ASSERT(TIMEOUT_COUNT <= sizeof(timeout_mask_t) * 8, "timeout_mask_t is too small for all timeouts");
+
+static uint32_t       deadlines[TIMEOUT_COUNT];
+static timeout_mask_t armed         = 0;
+static uint32_t       next_deadline = 0;
+
+static inline bool deadline_before(uint32_t a, uint32_t b) {
+    return ((int32_t)TIMER_DIFF_32(a, b)) < 0;
+}
+
+static void update_next_deadline(void) {
+    bool found = false;
+    for (uint8_t i = 0; i < TIMEOUT_COUNT; i++) {
+        if ((armed & TIMEOUT_BIT(i)) && (!found || deadline_before(deadlines[i], next_deadline))) {
+            next_deadline = deadlines[i];
+            found         = true;
+        }
+    }
+}
+
+void timeout_schedule(timeout_id_t id, uint32_t deadline) {
+    deadlines[id] = deadline;
+    armed |= TIMEOUT_BIT(id);
+    update_next_deadline();
+}
+
+void timeout_schedule_in(timeout_id_t id, uint32_t delay_ms) {
+    timeout_schedule(id, timer_read32() + delay_ms);
+}
+
+void timeout_cancel(timeout_id_t id) {
+    if (armed & TIMEOUT_BIT(id)) {
+        armed &= ~TIMEOUT_BIT(id);
+        update_next_deadline();
+    }
+}
+
+bool timeout_next_deadline(uint32_t *deadline) {
+    if (!armed) {
+        return false;
+    }
+    *deadline = next_deadline;
+    return true;
+}
+
+timeout_mask_t timeout_expired(void) {
+    if (!armed) {
+        return 0;
+    }
+
+    // The common case: nothing is due yet, which only costs a single comparison
+    uint32_t now = timer_read32();
+    if (deadline_before(now, next_deadline)) {
+        return 0;
+    }
+
+    timeout_mask_t expired = 0;
+    for (uint8_t i = 0; i < TIMEOUT_COUNT; i++) {
+        if ((armed & TIMEOUT_BIT(i)) && !deadline_before(now, deadlines[i])) {
+            expired |= TIMEOUT_BIT(i);
+        }
+    }
+    armed &= ~expired;
+    update_next_deadline();
+    return expired;
+}
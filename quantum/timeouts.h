@@ -0,0 +1,71 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * \file
+ *
+ * \defgroup timeouts Timeouts
+ *
+ * Features whose background task only has to act once a timer runs out register that deadline here, so that
+ * quantum_task() can skip their tasks entirely until it has passed.
+ * \{
+ */
+
+/** \brief Features whose tasks are dispatched through the timeout service. */
+typedef enum {
+    TIMEOUT_COMBO,
+    TIMEOUT_LEADER,
+    TIMEOUT_CAPS_WORD,
+    TIMEOUT_SECURE,
+    TIMEOUT_LAYER_LOCK,
+    TIMEOUT_TAP_DANCE,
+    TIMEOUT_COUNT,
+} timeout_id_t;
+
+typedef uint8_t timeout_mask_t;
+
+#define TIMEOUT_BIT(id) ((timeout_mask_t)1 << (id))
+
+/**
+ * \brief Arm (or move) a feature's timeout.
+ *
+ * \param id The feature to dispatch.
+ * \param deadline The time, as per timer_read32(), from which the feature's task should run.
+ */
+void timeout_schedule(timeout_id_t id, uint32_t deadline);
+
+/**
+ * \brief Arm (or move) a feature's timeout, relative to now.
+ *
+ * \param id The feature to dispatch.
+ * \param delay_ms The number of milliseconds from now after which the feature's task should run.
+ */
+void timeout_schedule_in(timeout_id_t id, uint32_t delay_ms);
+
+/**
+ * \brief Disarm a feature's timeout.
+ */
+void timeout_cancel(timeout_id_t id);
+
+/**
+ * \brief Retrieve the earliest armed deadline.
+ *
+ * \param deadline The earliest deadline, as per timer_read32().
+ *
+ * \return `false` if no timeouts are armed.
+ */
+bool timeout_next_deadline(uint32_t *deadline);
+
+/**
+ * \brief Collect and disarm the timeouts whose deadline has passed.
+ *
+ * \return A mask of TIMEOUT_BIT()s for the features whose tasks should run now.
+ */
+timeout_mask_t timeout_expired(void);
+
+/** \} */
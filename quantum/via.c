@@ -25,6 +25,8 @@
 #include "via.h"
 
 #include "raw_hid.h"
+#include "util.h"
+#include "compiler_support.h"
 #include "dynamic_keymap.h"
 #include "eeconfig.h"
 #include "matrix.h"
@@ -33,6 +35,13 @@
 #include "version.h" // for QMK_BUILDDATE used in EEPROM magic
 #include "nvm_via.h"
 
+#ifdef VIA_STREAM_ENABLE
+#    include "usb_device_state.h"
+#    if defined(CONNECTION_ENABLE) && defined(BLUETOOTH_ENABLE)
+#        include "connection.h"
+#    endif
+#endif
+
 #if defined(AUDIO_ENABLE)
 #    include "audio.h"
 #endif
@@ -224,6 +233,7 @@ __attribute__((weak)) void via_custom_value_command_kb(uint8_t *data, uint8_t le
 //      id_qmk_rgb_matrix_channel   ->  via_qmk_rgb_matrix_command()
 //      id_qmk_led_matrix_channel   ->  via_qmk_led_matrix_command()
 //      id_qmk_audio_channel        ->  via_qmk_audio_command()
+//      id_qmk_stream_channel       ->  via_qmk_stream_command()
 //
 __attribute__((weak)) void via_custom_value_command(uint8_t *data, uint8_t length) {
     // data = [ command_id, channel_id, value_id, value_data ]
@@ -264,6 +274,13 @@ __attribute__((weak)) void via_custom_value_command(uint8_t *data, uint8_t lengt
     }
 #endif // AUDIO_ENABLE
 
+#if defined(VIA_STREAM_ENABLE)
+    if (*channel_id == id_qmk_stream_channel) {
+        via_qmk_stream_command(data, length);
+        return;
+    }
+#endif // VIA_STREAM_ENABLE
+
     (void)channel_id; // force use of variable
 
     // If we haven't returned before here, then let the keyboard level code
@@ -279,10 +296,159 @@ __attribute__((weak)) bool via_command_kb(uint8_t *data, uint8_t length) {
     return false;
 }
 
+#ifdef VIA_STREAM_ENABLE
+STATIC_ASSERT(VIA_STREAM_DATA_SIZE >= 2 && VIA_STREAM_DATA_SIZE <= UINT8_MAX, "Raw HID reports are the wrong size for VIA streams");
+
+// State of the buffer stream in progress, if any
+static struct {
+    uint8_t  command_id; // id_custom_get_value/set_value of the request, or zero if idle
+    uint8_t  buffer_id;
+    uint8_t  sequence;
+    uint16_t offset;
+    uint16_t remaining;
+    uint16_t crc;
+} via_stream;
+
+static uint16_t via_stream_buffer_size(uint8_t buffer_id) {
+    switch (buffer_id) {
+        case id_stream_dynamic_keymap:
+            return dynamic_keymap_get_layer_count() * MATRIX_ROWS * MATRIX_COLS * 2;
+        case id_stream_dynamic_keymap_macro:
+            return dynamic_keymap_macro_get_buffer_size();
+        default:
+            return 0;
+    }
+}
+
+// Reads the next part of the stream's range, and adds it to the CRC
+static void via_stream_read(uint8_t *data, uint8_t size) {
+    if (via_stream.buffer_id == id_stream_dynamic_keymap) {
+        dynamic_keymap_get_buffer(via_stream.offset, size, data);
+    } else {
+        dynamic_keymap_macro_get_buffer(via_stream.offset, size, data);
+    }
+
+    // CRC-16/CCITT-FALSE
+    for (uint8_t i = 0; i < size; i++) {
+        via_stream.crc ^= (uint16_t)data[i] << 8;
+        for (uint8_t bit = 0; bit < 8; bit++) {
+            via_stream.crc = (via_stream.crc & 0x8000) ? (via_stream.crc << 1) ^ 0x1021 : via_stream.crc << 1;
+        }
+    }
+
+    via_stream.offset += size;
+    via_stream.remaining -= size;
+    via_stream.sequence++;
+}
+
+static void via_stream_end(uint8_t status) {
+    uint8_t data[RAW_EPSIZE] = {via_stream.command_id, id_qmk_stream_channel, id_qmk_stream_end, status, via_stream.crc >> 8, via_stream.crc & 0xFF};
+    raw_hid_send(data, sizeof(data));
+    via_stream.command_id = 0;
+}
+
+// raw_hid_send() can't tell whether a report went out, but none will once
+// USB is no longer configured, e.g. when the host suspends or is unplugged.
+static bool via_stream_host_ready(void) {
+#    if defined(CONNECTION_ENABLE) && defined(BLUETOOTH_ENABLE)
+    if (connection_get_host() == CONNECTION_HOST_BLUETOOTH) {
+        return true;
+    }
+#    endif
+    return usb_device_state_get_configure_state() == USB_DEVICE_STATE_CONFIGURED;
+}
+
+// Starts a stream from a [ command_id, channel_id, value_id, buffer_id, offset (2), size (2) ] request
+static bool via_stream_start(uint8_t *data) {
+    uint8_t  buffer_id = data[3];
+    uint16_t offset    = (data[4] << 8) | data[5];
+    uint16_t size      = (data[6] << 8) | data[7];
+    if (size == 0 || (uint32_t)offset + size > via_stream_buffer_size(buffer_id)) {
+        return false;
+    }
+
+    via_stream.command_id = data[0];
+    via_stream.buffer_id  = buffer_id;
+    via_stream.sequence   = 0;
+    via_stream.offset     = offset;
+    via_stream.remaining  = size;
+    via_stream.crc        = 0xFFFF;
+    return true;
+}
+
+// Checks if a report from the host is the next data report of a write stream
+static bool via_stream_is_write_data(uint8_t *data) {
+    return via_stream.command_id == id_custom_set_value && data[0] == id_custom_set_value && data[1] == id_qmk_stream_channel && data[2] == id_qmk_stream_data;
+}
+
+// Handles a [ id_custom_set_value, id_qmk_stream_channel, id_qmk_stream_data, sequence, data ] report from the host.
+// Nothing is sent back until the whole range has been written.
+static void via_stream_write(uint8_t *data) {
+    if (data[3] != via_stream.sequence) {
+        via_stream_end(id_stream_out_of_sequence);
+        return;
+    }
+
+    uint8_t size = MIN(via_stream.remaining, VIA_STREAM_DATA_SIZE);
+    if (via_stream.buffer_id == id_stream_dynamic_keymap) {
+        dynamic_keymap_set_buffer(via_stream.offset, size, &data[4]);
+    } else {
+        dynamic_keymap_macro_set_buffer(via_stream.offset, size, &data[4]);
+    }
+
+    // The CRC covers what was actually stored, rather than what was received
+    via_stream_read(&data[4], size);
+    if (via_stream.remaining == 0) {
+        via_stream_end(id_stream_ok);
+    }
+}
+
+void via_qmk_stream_command(uint8_t *data, uint8_t length) {
+    // data = [ command_id, channel_id, value_id, value_data ]
+    uint8_t *command_id = &(data[0]);
+    uint8_t *value_id   = &(data[2]);
+
+    // Acknowledge the request, the data follows in separate reports
+    if (!((*command_id == id_custom_get_value && *value_id == id_qmk_stream_get) || (*command_id == id_custom_set_value && *value_id == id_qmk_stream_set)) || !via_stream_start(data)) {
+        *command_id = id_unhandled;
+    }
+}
+
+void via_task(void) {
+    if (via_stream.command_id != id_custom_get_value) {
+        return;
+    }
+
+    for (uint8_t i = 0; i < VIA_STREAM_REPORTS_PER_TASK && via_stream.remaining > 0; i++) {
+        if (!via_stream_host_ready()) {
+            // The host would miss part of the range, so there's no point reading the rest
+            via_stream_end(id_stream_send_failed);
+            return;
+        }
+        uint8_t data[RAW_EPSIZE] = {id_custom_get_value, id_qmk_stream_channel, id_qmk_stream_data, via_stream.sequence};
+        via_stream_read(&data[4], MIN(via_stream.remaining, VIA_STREAM_DATA_SIZE));
+        raw_hid_send(data, sizeof(data));
+    }
+
+    if (via_stream.remaining == 0) {
+        via_stream_end(id_stream_ok);
+    }
+}
+#endif
+
 void raw_hid_receive(uint8_t *data, uint8_t length) {
     uint8_t *command_id   = &(data[0]);
     uint8_t *command_data = &(data[1]);
 
+#ifdef VIA_STREAM_ENABLE
+    if (via_stream_is_write_data(data)) {
+        via_stream_write(data);
+        return;
+    }
+    // Any other command cancels the stream
+    via_stream.command_id = 0;
+#endif
+
     // If via_command_kb() returns true, the command was fully
     // handled, including calling raw_hid_send()
     if (via_command_kb(data, length)) {
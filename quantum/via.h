@@ -51,6 +51,55 @@
 #    define VIA_FIRMWARE_VERSION 0x00000000
 #endif
 
+/*
+    Streaming of the dynamic keymap and macro buffers, enabled by defining
+    VIA_STREAM_ENABLE in config.h.
+
+    Streams are a QMK custom value channel, id_qmk_stream_channel, so that
+    they don't take any of VIA's command IDs. Rather than a request and
+    response for every 28 bytes, the host sends a single request for a
+    range of a buffer, as a get value to read it or a set value to write it:
+
+        [ id_custom_get_value/id_custom_set_value, id_qmk_stream_channel,
+          id_qmk_stream_get/id_qmk_stream_set, buffer_id, offset (2), size (2) ]
+
+    which is echoed back as an acknowledgement, or returned as id_unhandled if
+    the buffer or range isn't valid. The data then follows in consecutive
+    reports, each carrying up to VIA_STREAM_DATA_SIZE bytes of the range:
+
+        [ command_id, id_qmk_stream_channel, id_qmk_stream_data, sequence, data (RAW_EPSIZE - 4) ]
+
+    where command_id is the one of the request. When reading, the keyboard
+    sends these reports without waiting for any further requests. When
+    writing, the host sends them without waiting for any responses. Either
+    way, the stream is completed by the keyboard with:
+
+        [ command_id, id_qmk_stream_channel, id_qmk_stream_end, status, crc (2) ]
+
+    where the CRC is the CRC-16/CCITT-FALSE of the range, as read back from
+    the buffer, so that the host can verify the transfer. Sequence numbers
+    start from zero and wrap around, a write which skips one is ended early
+    with id_stream_out_of_sequence. A read is ended early with
+    id_stream_send_failed once USB is no longer configured (e.g. suspended),
+    as the host will have missed part of the range. Any other command
+    cancels the stream.
+
+    Multi-byte values are big-endian, as with the rest of the protocol.
+*/
+
+// Size of each raw HID report, as set by the USB descriptor
+#ifndef RAW_EPSIZE
+#    define RAW_EPSIZE 32
+#endif
+
+// Number of buffer bytes in each stream data report, after the command, channel and value IDs and the sequence number
+#define VIA_STREAM_DATA_SIZE ((RAW_EPSIZE) - 4)
+
+// Number of stream data reports sent in each main loop iteration
+#ifndef VIA_STREAM_REPORTS_PER_TASK
+#    define VIA_STREAM_REPORTS_PER_TASK 1
+#endif
+
 enum via_command_id {
     id_get_protocol_version                 = 0x01, // always 0x01
     id_get_keyboard_value                   = 0x02,
@@ -84,6 +133,17 @@ enum via_keyboard_value_id {
     id_device_indication   = 0x05,
 };
 
+enum via_stream_buffer_id {
+    id_stream_dynamic_keymap       = 0x00,
+    id_stream_dynamic_keymap_macro = 0x01,
+};
+
+enum via_stream_status {
+    id_stream_ok              = 0x00,
+    id_stream_out_of_sequence = 0x01,
+    id_stream_send_failed     = 0x02,
+};
+
 enum via_channel_id {
     id_custom_channel         = 0,
     id_qmk_backlight_channel  = 1,
@@ -91,6 +151,7 @@ enum via_channel_id {
     id_qmk_rgb_matrix_channel = 3,
     id_qmk_audio_channel      = 4,
     id_qmk_led_matrix_channel = 5,
+    id_qmk_stream_channel     = 6,
 };
 
 enum via_qmk_backlight_value {
@@ -123,6 +184,13 @@ enum via_qmk_audio_value {
     id_qmk_audio_clicky_enable = 2,
 };
 
+enum via_qmk_stream_value {
+    id_qmk_stream_get  = 1,
+    id_qmk_stream_set  = 2,
+    id_qmk_stream_data = 3,
+    id_qmk_stream_end  = 4,
+};
+
 // Can be called in an overriding via_init_kb() to test if keyboard level code usage of
 // EEPROM is invalid and use/save defaults.
 bool via_eeprom_is_valid(void);
@@ -135,6 +203,11 @@ void via_eeprom_set_valid(bool valid);
 void eeconfig_init_via(void);
 void via_init(void);
 
+#ifdef VIA_STREAM_ENABLE
+// Called by QMK core to send the next reports of any buffer stream.
+void via_task(void);
+#endif
+
 // Used by VIA to store and retrieve the layout options.
 uint32_t via_get_layout_options(void);
 void     via_set_layout_options(uint32_t value);
@@ -188,3 +261,7 @@ void via_qmk_audio_set_value(uint8_t *data);
 void via_qmk_audio_get_value(uint8_t *data);
 void via_qmk_audio_save(void);
 #endif
+
+#if defined(VIA_STREAM_ENABLE)
+void via_qmk_stream_command(uint8_t *data, uint8_t length);
+#endif
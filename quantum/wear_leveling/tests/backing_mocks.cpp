@@ -17,18 +17,25 @@ void MockBackingStore::reset_instance() {
     backing_erasure_count     = 0;
     backing_max_write_count   = 0;
     backing_total_write_count = 0;
+    backing_read_unit_count   = 0;
+    backing_mutation_count    = 0;
+    backing_power_loss_after  = UINT64_MAX;
 
     backing_init_invoke_count   = 0;
     backing_unlock_invoke_count = 0;
-    backing_erase_invoke_count  = 0;
-    backing_write_invoke_count  = 0;
-    backing_lock_invoke_count   = 0;
+    backing_erase_invoke_count       = 0;
+    backing_erase_range_invoke_count = 0;
+    backing_write_invoke_count       = 0;
+    backing_lock_invoke_count        = 0;
+    backing_read_invoke_count        = 0;
+    backing_read_bulk_invoke_count   = 0;
 
     init_success_callback   = [](std::uint64_t) { return true; };
     erase_success_callback  = [](std::uint64_t) { return true; };
     unlock_success_callback = [](std::uint64_t) { return true; };
     write_success_callback  = [](std::uint64_t, std::uint32_t) { return true; };
     lock_success_callback   = [](std::uint64_t) { return true; };
+    read_success_callback   = [](std::uint32_t) { return true; };
 
     write_log.clear();
 }
@@ -65,7 +72,9 @@ bool MockBackingStore::erase(void) {
             return false;
         }
 
-        backing_storage[i].erase();
+        if (is_powered()) {
+            backing_storage[i].erase();
+        }
     }
 
     // Keep track of the erase in the write log so that we can verify during tests
@@ -75,6 +84,37 @@ bool MockBackingStore::erase(void) {
     return true;
 }
 
+bool MockBackingStore::erase_range(uint32_t address, uint32_t length) {
+    ++backing_erase_range_invoke_count;
+
+    EXPECT_TRUE(address % BACKING_STORE_WRITE_SIZE == 0) << "Supplied address was not aligned with the backing store integral size";
+    EXPECT_TRUE(length % BACKING_STORE_WRITE_SIZE == 0) << "Supplied length was not aligned with the backing store integral size";
+    EXPECT_TRUE(address + length <= WEAR_LEVELING_BACKING_SIZE) << "Erase would result of out-of-bounds access";
+    EXPECT_FALSE(is_locked()) << "Erase was attempted without being unlocked first";
+
+#ifdef BACKING_STORE_ERASE_RANGE
+    // Flash can only erase whole sectors
+    if (address % WEAR_LEVELING_ERASE_SECTOR_SIZE != 0 || length % WEAR_LEVELING_ERASE_SECTOR_SIZE != 0) {
+        ADD_FAILURE() << "Erase range was not aligned with the erase sector size";
+        return false;
+    }
+#endif // BACKING_STORE_ERASE_RANGE
+
+    // Erase each slot in the range
+    for (std::size_t i = address / BACKING_STORE_WRITE_SIZE; i < (address + length) / BACKING_STORE_WRITE_SIZE; ++i) {
+        // Drop out of erase early with failure if we need to
+        if (erase_success_callback && !erase_success_callback(backing_erase_range_invoke_count)) {
+            return false;
+        }
+
+        if (is_powered()) {
+            backing_storage[i].erase();
+        }
+    }
+
+    return true;
+}
+
 bool MockBackingStore::write(uint32_t address, backing_store_int_t value) {
     ++backing_write_invoke_count;
 
@@ -88,6 +128,11 @@ bool MockBackingStore::write(uint32_t address, backing_store_int_t value) {
         return false;
     }
 
+    // Emulate a loss of power by dropping the write
+    if (!is_powered()) {
+        return true;
+    }
+
     // Write the complement as we're simulating flash memory -- 0xFF means 0x00
     std::size_t index = address / BACKING_STORE_WRITE_SIZE;
     backing_storage[index].set(~value);
@@ -113,11 +158,34 @@ bool MockBackingStore::lock(void) {
     return true;
 }
 
-bool MockBackingStore::read(uint32_t address, backing_store_int_t& value) const {
+bool MockBackingStore::read(uint32_t address, backing_store_int_t& value) {
+    ++backing_read_invoke_count;
+    ++backing_read_unit_count;
+    return read_element(address, value);
+}
+
+bool MockBackingStore::read_bulk(uint32_t address, backing_store_int_t* values, std::size_t item_count) {
+    ++backing_read_bulk_invoke_count;
+    for (std::size_t i = 0; i < item_count; ++i) {
+        ++backing_read_unit_count;
+        if (!read_element(address + (i * BACKING_STORE_WRITE_SIZE), values[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool MockBackingStore::read_element(uint32_t address, backing_store_int_t& value) const {
     // precondition: value's buffer size already matches BACKING_STORE_WRITE_SIZE
     EXPECT_TRUE(address % BACKING_STORE_WRITE_SIZE == 0) << "Supplied address was not aligned with the backing store integral size";
     EXPECT_TRUE(address + BACKING_STORE_WRITE_SIZE <= WEAR_LEVELING_BACKING_SIZE) << "Address would result of out-of-bounds access";
 
+    // Emulate an unreadable location, such as one with an ECC error
+    if (!read_success_callback(address)) {
+        value = 0;
+        return false;
+    }
+
     // Read and take the complement as we're simulating flash memory -- 0xFF means 0x00
     std::size_t index = address / BACKING_STORE_WRITE_SIZE;
     value             = ~backing_storage[index].get();
@@ -141,6 +209,10 @@ extern "C" bool backing_store_erase(void) {
     return MockBackingStore::Instance().erase();
 }
 
+extern "C" bool backing_store_erase_range(uint32_t address, uint32_t length) {
+    return MockBackingStore::Instance().erase_range(address, length);
+}
+
 extern "C" bool backing_store_write(uint32_t address, backing_store_int_t value) {
     return MockBackingStore::Instance().write(address, value);
 }
@@ -152,3 +224,7 @@ extern "C" bool backing_store_lock(void) {
 extern "C" bool backing_store_read(uint32_t address, backing_store_int_t* value) {
     return MockBackingStore::Instance().read(address, *value);
 }
+
+extern "C" bool backing_store_read_bulk(uint32_t address, backing_store_int_t* values, size_t item_count) {
+    return MockBackingStore::Instance().read_bulk(address, values, item_count);
+}
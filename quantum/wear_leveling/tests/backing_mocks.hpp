@@ -89,13 +89,22 @@ class MockBackingStore {
     std::uint64_t backing_total_write_count;
     // The write log for the backing store
     std::vector<MockBackingStoreLogEntry> write_log;
+    // The total number of elements read from the backing store
+    std::uint64_t backing_read_unit_count;
+    // The number of elements written or erased so far
+    std::uint64_t backing_mutation_count;
+    // Elements written or erased beyond this count are silently dropped, emulating a loss of power
+    std::uint64_t backing_power_loss_after;
 
     // The number of times each API was invoked
     std::uint64_t backing_init_invoke_count;
     std::uint64_t backing_unlock_invoke_count;
     std::uint64_t backing_erase_invoke_count;
+    std::uint64_t backing_erase_range_invoke_count;
     std::uint64_t backing_write_invoke_count;
     std::uint64_t backing_lock_invoke_count;
+    std::uint64_t backing_read_invoke_count;
+    std::uint64_t backing_read_bulk_invoke_count;
 
     // Whether init should succeed
     std::function<bool(std::uint64_t)> init_success_callback;
@@ -107,6 +116,16 @@ class MockBackingStore {
     std::function<bool(std::uint64_t, std::uint32_t)> write_success_callback;
     // Whether locks should succeed
     std::function<bool(std::uint64_t)> lock_success_callback;
+    // Whether reads should succeed
+    std::function<bool(std::uint32_t)> read_success_callback;
+
+    // Reads a single element, shared by the single and bulk read APIs
+    bool read_element(std::uint32_t address, backing_store_int_t& value) const;
+
+    // Whether the next element write or erase should take effect
+    bool is_powered() {
+        return ++backing_mutation_count <= backing_power_loss_after;
+    }
 
     template <typename... Args>
     void append_log(Args&&... args) {
@@ -130,6 +149,9 @@ class MockBackingStore {
     std::uint64_t total_write_count() const {
         return backing_total_write_count;
     }
+    std::uint64_t read_unit_count() const {
+        return backing_read_unit_count;
+    }
 
     // The number of times each API was invoked
     std::uint64_t init_invoke_count() const {
@@ -141,12 +163,21 @@ class MockBackingStore {
     std::uint64_t erase_invoke_count() const {
         return backing_erase_invoke_count;
     }
+    std::uint64_t erase_range_invoke_count() const {
+        return backing_erase_range_invoke_count;
+    }
     std::uint64_t write_invoke_count() const {
         return backing_write_invoke_count;
     }
     std::uint64_t lock_invoke_count() const {
         return backing_lock_invoke_count;
     }
+    std::uint64_t read_invoke_count() const {
+        return backing_read_invoke_count;
+    }
+    std::uint64_t read_bulk_invoke_count() const {
+        return backing_read_bulk_invoke_count;
+    }
 
     // Clear out the internal data for the next run
     void reset_instance();
@@ -159,9 +190,11 @@ class MockBackingStore {
     bool init();
     bool unlock();
     bool erase();
+    bool erase_range(std::uint32_t address, std::uint32_t length);
     bool write(std::uint32_t address, backing_store_int_t value);
     bool lock();
-    bool read(std::uint32_t address, backing_store_int_t& value) const;
+    bool read(std::uint32_t address, backing_store_int_t& value);
+    bool read_bulk(std::uint32_t address, backing_store_int_t* values, std::size_t item_count);
 
     // Control over when init/writes/erases should succeed
     void set_init_callback(std::function<bool(std::uint64_t)> callback) {
@@ -179,6 +212,20 @@ class MockBackingStore {
     void set_lock_callback(std::function<bool(std::uint64_t)> callback) {
         lock_success_callback = callback;
     }
+    void set_read_callback(std::function<bool(std::uint32_t)> callback) {
+        read_success_callback = callback;
+    }
+
+    // Emulation of a loss of power, after which writes and erases still report success but no longer change anything
+    std::uint64_t mutation_count() const {
+        return backing_mutation_count;
+    }
+    void set_power_loss_after(std::uint64_t mutations) {
+        backing_power_loss_after = mutations;
+    }
+    void restore_power() {
+        backing_power_loss_after = UINT64_MAX;
+    }
 
     auto storage_begin() const -> decltype(backing_storage.begin()) {
         return backing_storage.begin();
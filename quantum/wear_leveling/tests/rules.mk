@@ -64,3 +64,29 @@ wear_leveling_8byte_SRC := \
 	$(QUANTUM_PATH)/wear_leveling/tests/wear_leveling_8byte.cpp
 wear_leveling_8byte_INC := \
 	$(wear_leveling_common_INC)
+
+wear_leveling_double_bank_DEFS := \
+	$(wear_leveling_common_DEFS) \
+	-DBACKING_STORE_WRITE_SIZE=2 \
+	-DWEAR_LEVELING_BACKING_SIZE=128 \
+	-DWEAR_LEVELING_LOGICAL_SIZE=32 \
+	-DWEAR_LEVELING_DOUBLE_BANK \
+	-DWEAR_LEVELING_CONSOLIDATION_HEADROOM=8 \
+	-DWEAR_LEVELING_CONSOLIDATION_CHUNK_SIZE=8 \
+	-DWEAR_LEVELING_ERASE_SECTOR_SIZE=16
+wear_leveling_double_bank_SRC := \
+	$(wear_leveling_common_SRC) \
+	$(QUANTUM_PATH)/wear_leveling/tests/wear_leveling_double_bank.cpp
+wear_leveling_double_bank_INC := \
+	$(wear_leveling_common_INC)
+
+wear_leveling_benchmark_DEFS := \
+	$(wear_leveling_common_DEFS) \
+	-DBACKING_STORE_WRITE_SIZE=2 \
+	-DWEAR_LEVELING_BACKING_SIZE=65536 \
+	-DWEAR_LEVELING_LOGICAL_SIZE=4096
+wear_leveling_benchmark_SRC := \
+	$(wear_leveling_common_SRC) \
+	$(QUANTUM_PATH)/wear_leveling/tests/wear_leveling_benchmark.cpp
+wear_leveling_benchmark_INC := \
+	$(wear_leveling_common_INC)
@@ -3,4 +3,8 @@ TEST_LIST += \
 	wear_leveling_2byte_optimized_writes \
 	wear_leveling_2byte \
 	wear_leveling_4byte \
-	wear_leveling_8byte
+	wear_leveling_8byte \
+	wear_leveling_double_bank
+
+BENCHMARK_LIST += \
+	wear_leveling_benchmark
@@ -114,6 +114,47 @@ TEST_F(WearLeveling2Byte, ConsolidationOverflow) {
     EXPECT_TRUE(memcmp(readback.data(), verify_data.data(), WEAR_LEVELING_LOGICAL_SIZE) == 0) << "Readback did not match";
 }
 
+/**
+ * This test verifies that a write whose changes don't fit in the remaining write log is consolidated in full, rather
+ * than logging the remaining changes again after consolidation.
+ */
+TEST_F(WearLeveling2Byte, ConsolidationPartWayThroughChanges) {
+    auto& inst = MockBackingStore::Instance();
+
+    // Write the data, consolidating immediately
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> testvalue;
+    std::iota(testvalue.begin(), testvalue.end(), 0x20);
+    EXPECT_EQ(test_write(0, testvalue.data(), testvalue.size()), WEAR_LEVELING_CONSOLIDATED) << "Write returned incorrect status";
+
+    // Fill all but two entries of the write log with single byte changes
+    const std::size_t log_entries = (WEAR_LEVELING_BACKING_SIZE - WEAR_LEVELING_LOGICAL_SIZE - 8) / BACKING_STORE_WRITE_SIZE;
+    for (std::size_t i = 0; i < log_entries - 2; ++i) {
+        uint8_t value = 0x80 + i;
+        EXPECT_EQ(test_write(i % WEAR_LEVELING_LOGICAL_SIZE, &value, sizeof(value)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    }
+    auto erases = inst.erase_invoke_count();
+
+    // Four scattered changes need four entries
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> changed = verify_data;
+    changed[1] ^= 0xFF;
+    changed[5] ^= 0xFF;
+    changed[9] ^= 0xFF;
+    changed[13] ^= 0xFF;
+    EXPECT_EQ(test_write(0, changed.data(), changed.size()), WEAR_LEVELING_CONSOLIDATED) << "Write returned incorrect status";
+    EXPECT_EQ(inst.erase_invoke_count(), erases + 1) << "Write should have consolidated once";
+
+    // Nothing should have been logged after consolidation
+    uint8_t dummy = 0x40;
+    EXPECT_EQ(test_write(0x04, &dummy, sizeof(dummy)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    EXPECT_EQ((inst.log_end() - 1)->address, WEAR_LEVELING_LOGICAL_SIZE + 8) << "Invalid write log address";
+
+    // Re-init and re-read, verifying that none of the changes were lost
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> readback;
+    EXPECT_NE(wear_leveling_init(), WEAR_LEVELING_FAILED) << "Re-initialisation failed";
+    EXPECT_EQ(wear_leveling_read(0, readback.data(), WEAR_LEVELING_LOGICAL_SIZE), WEAR_LEVELING_SUCCESS) << "Failed to read back the saved data";
+    EXPECT_TRUE(memcmp(readback.data(), verify_data.data(), WEAR_LEVELING_LOGICAL_SIZE) == 0) << "Readback did not match";
+}
+
 /**
  * This test verifies multibyte readback gets canceled with an out-of-bounds address.
  */
@@ -226,3 +267,53 @@ TEST_F(WearLeveling2Byte, PlaybackReadbackWord01_OOB) {
     wear_leveling_read(0x02, &tmp, sizeof(tmp));
     EXPECT_EQ(tmp, 1) << "Readback should have maintained the previous pre-failure value from the write log";
 }
+
+/**
+ * This test verifies that write log playback fetches the log from the backing store in bulk, rather than one write unit at a time.
+ */
+TEST_F(WearLeveling2Byte, PlaybackReadsLogInBulk) {
+    auto& inst = MockBackingStore::Instance();
+
+    // Each of these ends up as a separate single-unit log entry
+    for (std::uint8_t i = 0; i < 5; ++i) {
+        std::uint8_t value = 0x11 * (i + 1);
+        EXPECT_EQ(test_write(i, &value, sizeof(value)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    }
+
+    auto reads      = inst.read_invoke_count();
+    auto bulk_reads = inst.read_bulk_invoke_count();
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    EXPECT_EQ(inst.read_invoke_count() - reads, 0) << "Playback should not have read individual write units";
+    EXPECT_EQ(inst.read_bulk_invoke_count() - bulk_reads, 3) << "Init should have read the consolidated data, hash, and write log once each";
+
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> readback;
+    wear_leveling_read(0, readback.data(), readback.size());
+    EXPECT_TRUE(memcmp(readback.data(), verify_data.data(), 5) == 0) << "Readback did not match";
+}
+
+/**
+ * This test verifies that an unreadable location in the write log only discards the log entries from that location
+ * onwards, even though it lies within the same bulk read as the entries before it.
+ */
+TEST_F(WearLeveling2Byte, PlaybackReadFailure_KeepsPrecedingEntries) {
+    auto& inst = MockBackingStore::Instance();
+
+    // Three single-unit log entries
+    for (std::uint8_t i = 0; i < 3; ++i) {
+        std::uint8_t value = 0x11 * (i + 1);
+        EXPECT_EQ(test_write(i, &value, sizeof(value)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    }
+
+    // Make the third log entry unreadable
+    inst.set_read_callback([](std::uint32_t address) { return address != WEAR_LEVELING_LOGICAL_SIZE + 8 + 2 * BACKING_STORE_WRITE_SIZE; });
+
+    EXPECT_EQ(inst.erasure_count(), 0) << "Invalid initial erase count";
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_CONSOLIDATED) << "Readback should have failed and triggered consolidation";
+    EXPECT_EQ(inst.erasure_count(), 1) << "Invalid final erase count";
+
+    uint8_t buf[3];
+    wear_leveling_read(0, buf, sizeof(buf));
+    EXPECT_EQ(buf[0], 0x11) << "Readback should have maintained the pre-failure values from the write log";
+    EXPECT_EQ(buf[1], 0x22) << "Readback should have maintained the pre-failure values from the write log";
+    EXPECT_EQ(buf[2], 0x00) << "Readback should have discarded the unreadable write log entry";
+}
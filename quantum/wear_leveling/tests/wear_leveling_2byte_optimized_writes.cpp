@@ -53,10 +53,46 @@ TEST_F(WearLeveling2ByteOptimizedWrites, MultibyteBackingStoreWriteCounts) {
     }
 }
 
+/**
+ * This test ensures that rewriting a block only logs the bytes which changed, grouping nearby changes into a single multibyte write.
+ */
+TEST_F(WearLeveling2ByteOptimizedWrites, MultibyteWriteOnlyLogsChanges) {
+    auto& inst = MockBackingStore::Instance();
+    std::fill(verify_data.begin(), verify_data.end(), 0);
+
+    // Generate a test block of data
+    std::array<std::uint8_t, 20> testvalue;
+    std::iota(testvalue.begin(), testvalue.end(), 0x20);
+    EXPECT_EQ(test_write(2000, testvalue.data(), testvalue.size()), WEAR_LEVELING_SUCCESS) << "Write failed with incorrect status";
+    auto start = std::distance(inst.log_begin(), inst.log_end());
+
+    // A single changed byte is a single-byte multibyte write of 2 backing writes
+    testvalue[7] = 0x99;
+    EXPECT_EQ(test_write(2000, testvalue.data(), testvalue.size()), WEAR_LEVELING_SUCCESS) << "Write failed with incorrect status";
+    EXPECT_EQ(std::distance(inst.log_begin(), inst.log_end()), start + 2) << "Only the changed byte should have been logged";
+
+    // Two changed bytes with an unchanged one in between are a 3-byte multibyte write of 3 backing writes, rather than 2 separate writes of 2
+    testvalue[10] = 0x99;
+    testvalue[12] = 0x99;
+    EXPECT_EQ(test_write(2000, testvalue.data(), testvalue.size()), WEAR_LEVELING_SUCCESS) << "Write failed with incorrect status";
+    EXPECT_EQ(std::distance(inst.log_begin(), inst.log_end()), start + 2 + 3) << "Nearby changes should have been logged together";
+
+    write_log_entry_t e;
+    e.raw16[0] = (inst.log_begin() + start + 2)->value;
+    EXPECT_EQ(LOG_ENTRY_GET_TYPE(e), LOG_ENTRY_TYPE_MULTIBYTE) << "Invalid write log entry type";
+    EXPECT_EQ(LOG_ENTRY_MULTIBYTE_GET_LENGTH(e), 3) << "Invalid write log entry length";
+
+    // Verify the data is what we expected, after reloading from the backing store
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> readback;
+    EXPECT_NE(wear_leveling_init(), WEAR_LEVELING_FAILED) << "Re-initialisation failed";
+    EXPECT_EQ(wear_leveling_read(0, readback.data(), WEAR_LEVELING_LOGICAL_SIZE), WEAR_LEVELING_SUCCESS) << "Failed to read back the saved data";
+    EXPECT_TRUE(memcmp(readback.data(), verify_data.data(), WEAR_LEVELING_LOGICAL_SIZE) == 0) << "Readback did not match";
+}
+
 /**
  * This test runs through writing U16 values of `0` or `1` over the entire logical address range, to even addresses only.
  *  - Addresses <16384 will result in a single optimised backing write
- *  - Higher addresses will result in a multibyte write of 3 backing writes
+ *  - Higher addresses only change the low byte, which results in a single-byte multibyte write of 2 backing writes
  */
 TEST_F(WearLeveling2ByteOptimizedWrites, WriteOneThenZeroToEvenAddresses) {
     auto& inst = MockBackingStore::Instance();
@@ -89,8 +125,8 @@ TEST_F(WearLeveling2ByteOptimizedWrites, WriteOneThenZeroToEvenAddresses) {
                 // A U16 value of 0/1 at an even address <16384 will result in 1 backing write each, so we need 2 backing writes for 2 logical writes
                 backing_store_writes_expected = 2;
             } else {
-                // All other addresses result in a multibyte write (3 backing store writes) to write two local bytes of data
-                backing_store_writes_expected = 6;
+                // All other addresses only change the low byte, resulting in a single-byte multibyte write (2 backing store writes) each
+                backing_store_writes_expected = 4;
             }
 
             // Keep track of the total number of expected writes to the backing store
@@ -111,10 +147,10 @@ TEST_F(WearLeveling2ByteOptimizedWrites, WriteOneThenZeroToEvenAddresses) {
                     ++write_iter;
                 }
             } else {
-                // Multibyte write
+                // Multibyte write of the changed byte
                 e.raw16[0] = write_iter->value;
                 EXPECT_EQ(LOG_ENTRY_GET_TYPE(e), LOG_ENTRY_TYPE_MULTIBYTE) << "Invalid write log entry type at " << (address + offset);
-                EXPECT_EQ(LOG_ENTRY_MULTIBYTE_GET_LENGTH(e), 2) << "Invalid write log entry length at " << (address + offset);
+                EXPECT_EQ(LOG_ENTRY_MULTIBYTE_GET_LENGTH(e), 1) << "Invalid write log entry length at " << (address + offset);
                 ++write_iter;
             }
 
@@ -143,9 +179,9 @@ TEST_F(WearLeveling2ByteOptimizedWrites, WriteOneThenZeroToEvenAddresses) {
 
 /**
  * This test runs through writing U16 values of `0` or `1` over the entire logical address range, to odd addresses only.
- *  - Addresses <63 will result in 2 optimised backing writes
- *  - Address 63 results in a single optimised backing write for the first logical byte, and a multibyte write of 2 backing writes for the second logical byte
- *  - Higher addresses will result in a multibyte write of 3 backing writes
+ *  - Only the low byte changes, so only the first logical byte is written
+ *  - Addresses <64 will result in a single optimised backing write
+ *  - Higher addresses will result in a single-byte multibyte write of 2 backing writes
  */
 TEST_F(WearLeveling2ByteOptimizedWrites, WriteOneThenZeroToOddAddresses) {
     auto& inst = MockBackingStore::Instance();
@@ -174,17 +210,12 @@ TEST_F(WearLeveling2ByteOptimizedWrites, WriteOneThenZeroToOddAddresses) {
             EXPECT_EQ(test_write(address + offset, &val, sizeof(val)), WEAR_LEVELING_SUCCESS) << "Write failed with incorrect status";
 
             std::size_t backing_store_writes_expected = 0;
-            if (address + offset < 63) {
-                // A U16 value of 0/1 at an odd address <64 will result in 2 backing writes each, so we need 4 backing writes for 2 logical writes
-                backing_store_writes_expected = 4;
-            } else if (address + offset == 63) {
-                // If we're straddling the boundary for optimised bytes (addr==64), then the first logical byte is written using the optimised write (1 backing
-                // store write), and the second logical byte uses a multibyte write (2 backing store writes)
-                backing_store_writes_expected = 2    // First logical bytes written using optimised log entries
-                                                + 4; // Second logical bytes written using multibyte log entries
+            if (address + offset < 64) {
+                // The changed byte of a U16 value of 0/1 at an odd address <64 will result in 1 backing write each, so we need 2 backing writes for 2 logical writes
+                backing_store_writes_expected = 2;
             } else {
-                // All other addresses result in a multibyte write (3 backing store writes) to write two local bytes of data
-                backing_store_writes_expected = 6;
+                // All other addresses only change the low byte, resulting in a single-byte multibyte write (2 backing store writes) each
+                backing_store_writes_expected = 4;
             }
 
             // Keep track of the total number of expected writes to the backing store
@@ -197,29 +228,18 @@ TEST_F(WearLeveling2ByteOptimizedWrites, WriteOneThenZeroToOddAddresses) {
             std::size_t       write_index = expected - backing_store_writes_expected;
             auto              write_iter  = inst.log_begin() + write_index;
             write_log_entry_t e;
-            if (address + offset < 63) {
-                // A U16 value of 0/1 at an odd address <64 will result in 2 backing writes each, so we need 4 backing writes for 2 logical writes
-                for (std::size_t i = 0; i < 4; ++i) {
+            if (address + offset < 64) {
+                // The changed byte of a U16 value of 0/1 at an odd address <64 will result in 1 backing write each, so we need 2 backing writes for 2 logical writes
+                for (std::size_t i = 0; i < 2; ++i) {
                     e.raw16[0] = write_iter->value;
                     EXPECT_EQ(LOG_ENTRY_GET_TYPE(e), LOG_ENTRY_TYPE_OPTIMIZED_64) << "Invalid write log entry type";
                     ++write_iter;
                 }
-            } else if (address + offset == 63) {
-                // First log entry is the 64-addr optimised one
-                e.raw16[0] = write_iter->value;
-                EXPECT_EQ(LOG_ENTRY_GET_TYPE(e), LOG_ENTRY_TYPE_OPTIMIZED_64) << "Invalid write log entry type";
-                ++write_iter;
-
-                // Second log entry is the multibyte entry for the second logical byte
-                e.raw16[0] = write_iter->value;
-                EXPECT_EQ(LOG_ENTRY_GET_TYPE(e), LOG_ENTRY_TYPE_MULTIBYTE) << "Invalid write log entry type";
-                EXPECT_EQ(LOG_ENTRY_MULTIBYTE_GET_LENGTH(e), 1) << "Invalid write log entry length";
-                ++write_iter;
             } else {
-                // Multibyte write
+                // Multibyte write of the changed byte
                 e.raw16[0] = write_iter->value;
                 EXPECT_EQ(LOG_ENTRY_GET_TYPE(e), LOG_ENTRY_TYPE_MULTIBYTE) << "Invalid write log entry type";
-                EXPECT_EQ(LOG_ENTRY_MULTIBYTE_GET_LENGTH(e), 2) << "Invalid write log entry length";
+                EXPECT_EQ(LOG_ENTRY_MULTIBYTE_GET_LENGTH(e), 1) << "Invalid write log entry length";
                 ++write_iter;
             }
 
@@ -293,3 +313,45 @@ TEST_F(WearLeveling2ByteOptimizedWrites, PlaybackReadbackWord01_Success) {
     wear_leveling_read(0x02, &tmp, sizeof(tmp));
     EXPECT_EQ(tmp, 1) << "Failed to read back the seeded data";
 }
+
+/**
+ * This test verifies that playback only reads the part of a large write log which holds entries, including when the
+ * last entry ends in zeroed write units.
+ */
+TEST_F(WearLeveling2ByteOptimizedWrites, PlaybackStopsAtLogEnd) {
+    auto&                                                inst = MockBackingStore::Instance();
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> data{};
+
+    // 100 single-unit entries
+    for (std::size_t i = 0; i < 100; ++i) {
+        data[i % 64] = (std::uint8_t)(i + 1);
+        EXPECT_EQ(wear_leveling_write(i % 64, &data[i % 64], 1), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    }
+
+    // Two 4-unit multibyte entries, the last of which ends in two zeroed units
+    const std::uint8_t first[5] = {1, 2, 3, 4, 5}, second[5] = {6, 0, 0, 0, 0};
+    EXPECT_EQ(wear_leveling_write(200, first, sizeof(first)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    EXPECT_EQ(wear_leveling_write(200, second, sizeof(second)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    memcpy(&data[200], second, sizeof(second));
+
+    // Consolidated data, its hash, the entries, the binary search probes and at most one read-ahead block past the end
+    constexpr std::size_t log_units = (WEAR_LEVELING_BACKING_SIZE - WEAR_LEVELING_LOGICAL_SIZE - 8) / BACKING_STORE_WRITE_SIZE;
+    constexpr std::size_t probes    = 16;
+    static_assert((1 << (probes - 1)) >= log_units, "Not enough binary search probes for the write log");
+    constexpr std::size_t max_reads = (WEAR_LEVELING_LOGICAL_SIZE / BACKING_STORE_WRITE_SIZE) + 4 + 108 + (probes * 8 / BACKING_STORE_WRITE_SIZE) + (WEAR_LEVELING_PLAYBACK_READ_AHEAD_SIZE / BACKING_STORE_WRITE_SIZE);
+
+    auto reads = inst.read_unit_count();
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    EXPECT_LE(inst.read_unit_count() - reads, max_reads) << "Playback read past the end of the write log";
+
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> readback;
+    wear_leveling_read(0, readback.data(), readback.size());
+    EXPECT_EQ(readback, data) << "Readback did not match";
+
+    // The next entry has to be appended after the last one, not within it
+    data[300] = 0x77;
+    EXPECT_EQ(wear_leveling_write(300, &data[300], 1), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    wear_leveling_read(0, readback.data(), readback.size());
+    EXPECT_EQ(readback, data) << "Readback after appending did not match";
+}
@@ -0,0 +1,79 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "backing_mocks.hpp"
+
+class WearLevelingBenchmark : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        MockBackingStore::Instance().reset_instance();
+        wear_leveling_init();
+    }
+};
+
+using logical_data_t = std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE>;
+
+// Number of write units available to the write log
+static constexpr std::size_t log_units = (WEAR_LEVELING_BACKING_SIZE - WEAR_LEVELING_LOGICAL_SIZE - 8) / BACKING_STORE_WRITE_SIZE;
+// Number of binary search probes needed to find the end of the write log
+static constexpr std::size_t probes_for(std::size_t n) {
+    return n > 1 ? 1 + probes_for(n / 2) : 1;
+}
+static constexpr std::size_t log_end_probes = probes_for(log_units);
+// Upper bound on units read by init which aren't part of the consolidated data or write log entries
+static constexpr std::size_t read_overhead = 4 + (log_end_probes * (8 / BACKING_STORE_WRITE_SIZE)) + (WEAR_LEVELING_PLAYBACK_READ_AHEAD_SIZE / BACKING_STORE_WRITE_SIZE);
+
+/**
+ * Fills the write log with the supplied number of single-unit entries, without triggering a consolidation.
+ */
+static void fill_log(logical_data_t& data, std::size_t entries) {
+    for (std::size_t i = 0; i < entries; ++i) {
+        // Addresses below 64 are written as a single write unit, and each round changes the value at every address
+        std::uint32_t address = i % 64;
+        std::uint8_t  value   = (std::uint8_t)(((i / 64) % 255) + 1);
+        data[address]         = value;
+        ASSERT_EQ(wear_leveling_write(address, &value, sizeof(value)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    }
+}
+
+/**
+ * This benchmark reports the time taken by wear_leveling_init() against the fill level of the write log, and verifies
+ * that the amount of data read from the backing store only scales with the number of entries actually present.
+ */
+TEST_F(WearLevelingBenchmark, PlaybackTimeAgainstFillLevel) {
+    auto& inst = MockBackingStore::Instance();
+
+    for (std::size_t percent = 0; percent <= 100; percent += 25) {
+        inst.reset_instance();
+        EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+
+        // Leave one slot free, a full write log gets consolidated during init
+        logical_data_t data{};
+        std::size_t    entries = ((log_units - 1) * percent) / 100;
+        fill_log(data, entries);
+
+        // Take the best of several runs, to reduce noise
+        constexpr int            runs = 10;
+        std::chrono::nanoseconds best{std::chrono::nanoseconds::max()};
+        for (int run = 0; run < runs; ++run) {
+            auto reads = inst.read_unit_count();
+            auto start = std::chrono::steady_clock::now();
+            EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+            auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+            best         = std::min(best, elapsed);
+
+            EXPECT_LE(inst.read_unit_count() - reads, (WEAR_LEVELING_LOGICAL_SIZE / BACKING_STORE_WRITE_SIZE) + entries + read_overhead) << "Init read more of the backing store than expected at " << percent << "% fill";
+        }
+
+        logical_data_t readback;
+        wear_leveling_read(0, readback.data(), readback.size());
+        EXPECT_EQ(readback, data) << "Readback did not match at " << percent << "% fill";
+
+        std::cout << "[ BENCHMARK] write log " << std::setw(3) << percent << "% full (" << std::setw(5) << entries << " entries): init took " << std::setw(8) << best.count() / 1000 << "us" << std::endl;
+        RecordProperty("init_us_at_" + std::to_string(percent) + "_percent", (int)(best.count() / 1000));
+    }
+}
@@ -0,0 +1,235 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "backing_mocks.hpp"
+
+class WearLevelingDoubleBank : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        MockBackingStore::Instance().reset_instance();
+        wear_leveling_init();
+    }
+};
+
+using logical_data_t = std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE>;
+
+// Number of single-byte writes (each a single OPTIMIZED_64 log entry) before a background consolidation is scheduled
+static constexpr std::size_t writes_until_scheduled = (WEAR_LEVELING_BANK_LOG_SIZE - WEAR_LEVELING_CONSOLIDATION_HEADROOM) / BACKING_STORE_WRITE_SIZE;
+// Number of single-byte writes which fill up the write log of a bank
+static constexpr std::size_t writes_until_full = WEAR_LEVELING_BANK_LOG_SIZE / BACKING_STORE_WRITE_SIZE;
+// Number of sectors erased in the standby bank, one per wear_leveling_task() invocation
+static constexpr std::size_t erase_steps = WEAR_LEVELING_BANK_SIZE / WEAR_LEVELING_ERASE_SECTOR_SIZE;
+// Number of wear_leveling_task() invocations needed to consolidate -- erase in sectors, copy in chunks, commit
+static constexpr std::size_t consolidation_steps = erase_steps + (WEAR_LEVELING_LOGICAL_SIZE / WEAR_LEVELING_CONSOLIDATION_CHUNK_SIZE) + 1;
+
+static logical_data_t read_all(void) {
+    logical_data_t data;
+    wear_leveling_read(0, data.data(), data.size());
+    return data;
+}
+
+static wear_leveling_status_t write_byte(logical_data_t& data, uint32_t address, uint8_t value) {
+    data[address] = value;
+    return wear_leveling_write(address, &value, sizeof(value));
+}
+
+static std::uint32_t last_write_address(void) {
+    auto& inst = MockBackingStore::Instance();
+    auto  it   = inst.log_end();
+    while (it != inst.log_begin()) {
+        --it;
+        if (!it->erased) {
+            return it->address;
+        }
+    }
+    return UINT32_MAX;
+}
+
+/**
+ * This test verifies that consolidation is only scheduled when the write log runs low, and is performed one step at a
+ * time by wear_leveling_task() without erasing the active bank.
+ */
+TEST_F(WearLevelingDoubleBank, ConsolidationIsDeferredToTask) {
+    auto&          inst = MockBackingStore::Instance();
+    logical_data_t data{};
+
+    for (std::size_t i = 0; i < writes_until_scheduled; ++i) {
+        EXPECT_EQ(write_byte(data, i, 0x20 + i), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    }
+    EXPECT_EQ(inst.erase_invoke_count(), 0) << "Backing store should not have been erased";
+    EXPECT_EQ(inst.erase_range_invoke_count(), 0) << "Standby bank should not have been erased during writes";
+
+    std::size_t            steps = 0;
+    wear_leveling_status_t status;
+    do {
+        status = wear_leveling_task();
+        ++steps;
+    } while (status == WEAR_LEVELING_SUCCESS && steps < 100);
+    EXPECT_EQ(status, WEAR_LEVELING_CONSOLIDATED) << "Consolidation should have completed";
+    EXPECT_EQ(steps, consolidation_steps) << "Unexpected number of consolidation steps";
+    EXPECT_EQ(inst.erase_invoke_count(), 0) << "Backing store should not have been erased";
+    EXPECT_EQ(inst.erase_range_invoke_count(), erase_steps) << "Standby bank should have been erased once, a sector per step";
+    EXPECT_EQ(wear_leveling_task(), WEAR_LEVELING_SUCCESS) << "No further consolidation should be pending";
+
+    // The next write goes to the write log of the second bank
+    EXPECT_EQ(write_byte(data, 0x10, 0x55), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    EXPECT_EQ(last_write_address(), WEAR_LEVELING_BANK_SIZE + WEAR_LEVELING_BANK_LOG_OFFSET) << "Invalid write log address";
+
+    wear_leveling_init();
+    EXPECT_EQ(read_all(), data) << "Readback after consolidation did not match";
+}
+
+/**
+ * This test verifies that writes made whilst consolidation is copying data survive, whether they land in the part of
+ * the logical data which was already copied or not.
+ */
+TEST_F(WearLevelingDoubleBank, WritesDuringConsolidationAreKept) {
+    logical_data_t data{};
+
+    for (std::size_t i = 0; i < writes_until_scheduled; ++i) {
+        write_byte(data, i, 0x20 + i);
+    }
+
+    for (std::size_t i = 0; i < erase_steps; ++i) {
+        EXPECT_EQ(wear_leveling_task(), WEAR_LEVELING_SUCCESS) << "Erase step should have succeeded";
+    }
+    EXPECT_EQ(wear_leveling_task(), WEAR_LEVELING_SUCCESS) << "First copy step should have succeeded";
+
+    // One write behind the copy, one ahead of it
+    EXPECT_EQ(write_byte(data, 0x01, 0xAA), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    EXPECT_EQ(write_byte(data, WEAR_LEVELING_LOGICAL_SIZE - 1, 0xBB), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+
+    wear_leveling_status_t status;
+    do {
+        status = wear_leveling_task();
+    } while (status == WEAR_LEVELING_SUCCESS);
+    EXPECT_EQ(status, WEAR_LEVELING_CONSOLIDATED) << "Consolidation should have completed";
+    EXPECT_EQ(read_all(), data) << "Cached data did not match";
+
+    wear_leveling_init();
+    EXPECT_EQ(read_all(), data) << "Readback after consolidation did not match";
+}
+
+/**
+ * This test verifies that a write which doesn't fit in the write log completes the consolidation inline, and is then
+ * written to the new active bank.
+ */
+TEST_F(WearLevelingDoubleBank, FullLogConsolidatesInline) {
+    auto&          inst = MockBackingStore::Instance();
+    logical_data_t data{};
+
+    for (std::size_t i = 0; i < writes_until_full; ++i) {
+        EXPECT_EQ(write_byte(data, i, 0x20 + i), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    }
+    EXPECT_EQ(inst.erase_range_invoke_count(), 0) << "Standby bank should not have been erased during writes";
+
+    EXPECT_EQ(write_byte(data, 0x1F, 0x40), WEAR_LEVELING_CONSOLIDATED) << "Write returned incorrect status";
+    EXPECT_EQ(inst.erase_invoke_count(), 0) << "Backing store should not have been erased";
+    EXPECT_EQ(inst.erase_range_invoke_count(), erase_steps) << "Standby bank should have been erased once, a sector per step";
+    EXPECT_EQ(last_write_address(), WEAR_LEVELING_BANK_SIZE + WEAR_LEVELING_BANK_LOG_OFFSET) << "Write should have landed in the new active bank";
+    EXPECT_EQ(wear_leveling_task(), WEAR_LEVELING_SUCCESS) << "No further consolidation should be pending";
+
+    wear_leveling_init();
+    EXPECT_EQ(read_all(), data) << "Readback after consolidation did not match";
+}
+
+/**
+ * This test verifies that initialization picks the most recently committed bank when both banks have been committed.
+ */
+TEST_F(WearLevelingDoubleBank, InitUsesMostRecentBank) {
+    logical_data_t data{};
+
+    // Consolidate twice, ending up back in the first bank
+    for (std::size_t round = 0; round < 2; ++round) {
+        for (std::size_t i = 0; i < writes_until_scheduled; ++i) {
+            write_byte(data, i, 0x20 + i + round);
+        }
+        while (wear_leveling_task() == WEAR_LEVELING_SUCCESS) {
+        }
+    }
+
+    wear_leveling_init();
+    EXPECT_EQ(read_all(), data) << "Readback after consolidation did not match";
+    EXPECT_EQ(write_byte(data, 0x10, 0x55), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    EXPECT_EQ(last_write_address(), WEAR_LEVELING_BANK_LOG_OFFSET) << "Write should have landed in the first bank";
+}
+
+struct WriteCheckpoint {
+    std::uint64_t  start;    // mutation count before the write
+    std::uint64_t  end;      // mutation count after the write
+    logical_data_t expected; // logical data after the write
+};
+
+/**
+ * Performs a deterministic mix of writes and background consolidation steps, recording the logical data after each write.
+ * The number of steps between writes varies, so that some consolidations complete in the background and some inline.
+ */
+static void run_power_loss_scenario(std::vector<WriteCheckpoint>& checkpoints, std::size_t& background, std::size_t& inline_count) {
+    auto&          inst = MockBackingStore::Instance();
+    logical_data_t data{};
+    for (std::size_t i = 0; i < 64; ++i) {
+        std::uint64_t start  = inst.mutation_count();
+        auto          status = write_byte(data, (i * 7) % WEAR_LEVELING_LOGICAL_SIZE, (uint8_t)(i * 37 + 1));
+        checkpoints.push_back({start, inst.mutation_count(), data});
+        if (status == WEAR_LEVELING_CONSOLIDATED) {
+            ++inline_count;
+        }
+        for (std::size_t j = 0; j < ((i % 16) < 10 ? i % 2 : 3); ++j) {
+            if (wear_leveling_task() == WEAR_LEVELING_CONSOLIDATED) {
+                ++background;
+            }
+        }
+    }
+}
+
+/**
+ * This test cuts power after every single element written or erased in the backing store, and verifies that after
+ * restarting, the logical data is either that from before or after the write that was in flight. It then verifies that
+ * the recovered state is consistent enough for further writes and consolidations.
+ */
+TEST_F(WearLevelingDoubleBank, PowerLossAtEveryStep) {
+    auto& inst = MockBackingStore::Instance();
+
+    // Uninterrupted run, to find out how many mutations there are
+    std::vector<WriteCheckpoint> reference;
+    std::size_t                  background   = 0;
+    std::size_t                  inline_count = 0;
+    run_power_loss_scenario(reference, background, inline_count);
+    EXPECT_GT(background, 0) << "Scenario should include consolidations performed by the task";
+    EXPECT_GT(inline_count, 0) << "Scenario should include consolidations performed inline";
+    const std::uint64_t total = inst.mutation_count();
+
+    for (std::uint64_t cutoff = 0; cutoff <= total; ++cutoff) {
+        inst.reset_instance();
+        wear_leveling_init();
+        inst.set_power_loss_after(cutoff);
+
+        std::vector<WriteCheckpoint> checkpoints;
+        run_power_loss_scenario(checkpoints, background, inline_count);
+        inst.restore_power();
+
+        // Find the last write which was completely persisted, and the one which was in flight
+        logical_data_t before{};
+        logical_data_t after{};
+        std::size_t    index = 0;
+        while (index < checkpoints.size() && checkpoints[index].end <= cutoff) {
+            before = checkpoints[index++].expected;
+        }
+        after = (index < checkpoints.size() && checkpoints[index].start < cutoff) ? checkpoints[index].expected : before;
+
+        EXPECT_NE(wear_leveling_init(), WEAR_LEVELING_FAILED) << "Init failed after power loss at mutation " << cutoff;
+        logical_data_t recovered = read_all();
+        EXPECT_TRUE(recovered == before || recovered == after) << "Unexpected data after power loss at mutation " << cutoff;
+
+        // Keep going from the recovered state, through at least one more consolidation
+        for (std::size_t i = 0; i < writes_until_full; ++i) {
+            write_byte(recovered, i, (uint8_t)(0xA0 + i));
+        }
+        for (std::size_t i = 0; i < consolidation_steps; ++i) {
+            EXPECT_NE(wear_leveling_task(), WEAR_LEVELING_FAILED) << "Consolidation failed after power loss at mutation " << cutoff;
+        }
+        wear_leveling_init();
+        EXPECT_EQ(read_all(), recovered) << "Readback after recovery from power loss at mutation " << cutoff << " did not match";
+    }
+}
@@ -73,8 +73,12 @@
             * Logical data is served from the cache.
 
         During writes:
-            * The cache is updated with the new data.
-            * A new write log entry is appended to the log.
+            * The new data is compared against the cache, and only the bytes
+                which changed are considered further.
+            * The cache is updated with the changed data.
+            * New write log entries are appended to the log for the changed
+                data, grouping nearby changes into the same entry where that
+                doesn't use any more of the log.
             * If the log's full, data is consolidated and the write log cleared.
 
     Write log structure:
@@ -154,7 +158,49 @@
         ║  │Address >> 1 ║
         ║  └── Value: 1  ║
         ╚════════════════╝
-        0 <= Address <= 0x3FFE (16382) */
+        0 <= Address <= 0x3FFE (16382)
+
+    Double-bank operation (WEAR_LEVELING_DOUBLE_BANK):
+
+        Consolidating in place requires erasing the backing store, during
+        which a loss of power loses everything not yet written back. With
+        double-bank operation enabled, the backing store is split into two
+        equally-sized banks, each with the same structure as above, with an
+        additional 8-byte bank header after the FNV1a_64 hash:
+
+        ╔ Bank Header ══════════════════════╗
+        ║ Magic "WBNK" (32b)│Sequence (32b) ║
+        ╚═══════════════════╧═══════════════╝
+
+        Only one bank is active at a time, and all write log entries are
+        appended to it. Once no more than WEAR_LEVELING_CONSOLIDATION_HEADROOM
+        bytes remain in the write log, consolidation into the standby bank is
+        scheduled, and each call to wear_leveling_task() performs one step:
+
+            * The standby bank is erased, WEAR_LEVELING_ERASE_SECTOR_SIZE
+                bytes per step.
+            * WEAR_LEVELING_CONSOLIDATION_CHUNK_SIZE bytes of the cache are
+                copied into the standby bank's consolidated data area, per
+                step, until all logical data has been copied.
+            * The FNV1a_64 hash of the copied data is written, followed by
+                the bank header with the next sequence number. The standby bank
+                becomes the active bank.
+
+        Write log entries appended after the erase are mirrored into the
+        standby bank's write log, so that data copied before a later write is
+        still superseded by that write once the standby bank is played back.
+        As a result, both banks describe the same logical data up until the
+        moment the standby bank's header is written, and a loss of power at
+        any point leaves the latest data recoverable from one of the banks.
+        During initialization, the bank with the most recent sequence number,
+        a valid header and matching hash is used. If neither bank has been
+        committed yet, the first bank's write log is played back on top of
+        zeroed data.
+
+        If the active write log fills up before the background consolidation
+        completes, the remaining steps are performed inline, before the entry
+        is appended to the new active bank. Log entries are never split across
+        banks. */
 
 /**
  * Storage area for the wear-leveling cache.
@@ -163,8 +209,38 @@ static struct __attribute__((__aligned__(BACKING_STORE_WRITE_SIZE))) {
     __attribute__((__aligned__(BACKING_STORE_WRITE_SIZE))) uint8_t cache[(WEAR_LEVELING_LOGICAL_SIZE)];
     uint32_t                                                       write_address;
     bool                                                           unlocked;
+#ifdef WEAR_LEVELING_DOUBLE_BANK
+    uint32_t sequence;              // sequence number of the active bank
+    uint32_t standby_write_address; // write log position of the standby bank, used for mirroring during consolidation
+    uint32_t erase_offset;          // amount of the standby bank erased so far
+    uint32_t copy_offset;           // amount of logical data copied into the standby bank so far
+    uint64_t copy_hash;             // FNV1a_64 of the logical data copied into the standby bank so far
+    uint8_t  active_bank;           // bank currently receiving write log entries
+    uint8_t  consolidation;         // consolidation_state_t
+#endif // WEAR_LEVELING_DOUBLE_BANK
 } wear_leveling;
 
+#ifdef WEAR_LEVELING_DOUBLE_BANK
+/**
+ * Progress of the background consolidation into the standby bank.
+ */
+typedef enum consolidation_state_t {
+    CONSOLIDATION_IDLE = 0,   //< Nothing to do
+    CONSOLIDATION_PENDING,    //< Standby bank needs erasing from the start
+    CONSOLIDATION_ERASING,    //< Standby bank is being erased, one sector at a time
+    CONSOLIDATION_COPYING,    //< Logical data is being copied into the standby bank, log entries are mirrored
+    CONSOLIDATION_COMMITTING, //< Hash and bank header need writing
+} consolidation_state_t;
+
+#    define WEAR_LEVELING_BANK_BASE(bank) ((uint32_t)(bank) * (WEAR_LEVELING_BANK_SIZE))
+#    define WEAR_LEVELING_STANDBY_BASE WEAR_LEVELING_BANK_BASE(wear_leveling.active_bank ^ 1)
+#    define WEAR_LEVELING_LOG_START (WEAR_LEVELING_BANK_BASE(wear_leveling.active_bank) + (WEAR_LEVELING_BANK_LOG_OFFSET))
+#    define WEAR_LEVELING_LOG_END (WEAR_LEVELING_BANK_BASE(wear_leveling.active_bank) + (WEAR_LEVELING_BANK_SIZE))
+#else
+#    define WEAR_LEVELING_LOG_START ((WEAR_LEVELING_LOGICAL_SIZE) + 8) // +8 is due to the FNV1a_64 of the consolidated buffer
+#    define WEAR_LEVELING_LOG_END (WEAR_LEVELING_BACKING_SIZE)
+#endif // WEAR_LEVELING_DOUBLE_BANK
+
 /**
  * Locking helper: status
  */
@@ -203,9 +279,37 @@ static inline backing_store_lock_status_t wear_leveling_lock(void) {
  */
 static void wear_leveling_clear_cache(void) {
     memset(wear_leveling.cache, 0, (WEAR_LEVELING_LOGICAL_SIZE));
-    wear_leveling.write_address = (WEAR_LEVELING_LOGICAL_SIZE) + 8; // +8 is due to the FNV1a_64 of the consolidated buffer
+    wear_leveling.write_address = WEAR_LEVELING_LOG_START;
+}
+
+/**
+ * Reads an 8-byte entry, such as the FNV1a_64 of the consolidated data, from the backing store.
+ */
+static bool wear_leveling_read_entry(uint32_t address, write_log_entry_t *entry) {
+#if BACKING_STORE_WRITE_SIZE == 2
+    return backing_store_read_bulk(address, entry->raw16, 4);
+#elif BACKING_STORE_WRITE_SIZE == 4
+    return backing_store_read_bulk(address, entry->raw32, 2);
+#elif BACKING_STORE_WRITE_SIZE == 8
+    return backing_store_read(address, &entry->raw64);
+#endif
 }
 
+/**
+ * Writes an 8-byte entry, such as the FNV1a_64 of the consolidated data, to the backing store.
+ */
+static bool wear_leveling_write_entry(uint32_t address, write_log_entry_t *entry) {
+#if BACKING_STORE_WRITE_SIZE == 2
+    return backing_store_write_bulk(address, entry->raw16, 4);
+#elif BACKING_STORE_WRITE_SIZE == 4
+    return backing_store_write_bulk(address, entry->raw32, 2);
+#elif BACKING_STORE_WRITE_SIZE == 8
+    return backing_store_write(address, entry->raw64);
+#endif
+}
+
+#ifndef WEAR_LEVELING_DOUBLE_BANK
+
 /**
  * Reads the consolidated data from the backing store into the cache.
  * Does not consider the write log.
@@ -224,13 +328,7 @@ static wear_leveling_status_t wear_leveling_read_consolidated(void) {
         uint64_t          expected = fnv_64a_buf(wear_leveling.cache, (WEAR_LEVELING_LOGICAL_SIZE), FNV1A_64_INIT);
         write_log_entry_t entry;
         wl_dprintf("Reading checksum\n");
-#if BACKING_STORE_WRITE_SIZE == 2
-        backing_store_read_bulk((WEAR_LEVELING_LOGICAL_SIZE), entry.raw16, 4);
-#elif BACKING_STORE_WRITE_SIZE == 4
-        backing_store_read_bulk((WEAR_LEVELING_LOGICAL_SIZE), entry.raw32, 2);
-#elif BACKING_STORE_WRITE_SIZE == 8
-        backing_store_read((WEAR_LEVELING_LOGICAL_SIZE) + 0, &entry.raw64);
-#endif
+        wear_leveling_read_entry((WEAR_LEVELING_LOGICAL_SIZE), &entry);
         // If we have a mismatch, clear the cache but do not flag a failure,
         // which will cater for the completely clean MCU case.
         if (entry.raw64 == expected) {
@@ -269,24 +367,9 @@ static wear_leveling_status_t wear_leveling_write_consolidated(void) {
         write_log_entry_t entry;
         entry.raw64 = fnv_64a_buf(wear_leveling.cache, (WEAR_LEVELING_LOGICAL_SIZE), FNV1A_64_INIT);
         wl_dprintf("Writing checksum\n");
-        do {
-#if BACKING_STORE_WRITE_SIZE == 2
-            if (!backing_store_write_bulk((WEAR_LEVELING_LOGICAL_SIZE), entry.raw16, 4)) {
-                status = WEAR_LEVELING_FAILED;
-                break;
-            }
-#elif BACKING_STORE_WRITE_SIZE == 4
-            if (!backing_store_write_bulk((WEAR_LEVELING_LOGICAL_SIZE), entry.raw32, 2)) {
-                status = WEAR_LEVELING_FAILED;
-                break;
-            }
-#elif BACKING_STORE_WRITE_SIZE == 8
-            if (!backing_store_write((WEAR_LEVELING_LOGICAL_SIZE), entry.raw64)) {
-                status = WEAR_LEVELING_FAILED;
-                break;
-            }
-#endif
-        } while (0);
+        if (!wear_leveling_write_entry((WEAR_LEVELING_LOGICAL_SIZE), &entry)) {
+            status = WEAR_LEVELING_FAILED;
+        }
     }
 
     if (lock_status == STATUS_SUCCESS) {
@@ -317,7 +400,7 @@ static wear_leveling_status_t wear_leveling_consolidate_force(void) {
     }
 
     // Next write of the log occurs after the consolidated values at the start of the backing store.
-    wear_leveling.write_address = (WEAR_LEVELING_LOGICAL_SIZE) + 8; // +8 due to the FNV1a_64 of the consolidated area
+    wear_leveling.write_address = WEAR_LEVELING_LOG_START;
 
     return status;
 }
@@ -330,7 +413,7 @@ static wear_leveling_status_t wear_leveling_consolidate_force(void) {
  * @return true if consolidation occurred
  */
 static wear_leveling_status_t wear_leveling_consolidate_if_needed(void) {
-    if (wear_leveling.write_address >= (WEAR_LEVELING_BACKING_SIZE)) {
+    if (wear_leveling.write_address >= WEAR_LEVELING_LOG_END) {
         return wear_leveling_consolidate_force();
     }
 
@@ -353,62 +436,308 @@ static wear_leveling_status_t wear_leveling_append_raw(backing_store_int_t value
 }
 
 /**
- * Handles writing multi_byte-encoded data to the backing store.
+ * Appends the supplied log entry to the write log, optionally consolidating if the log is full.
  *
  * @return true if consolidation occurred
  */
-static wear_leveling_status_t wear_leveling_write_raw_multibyte(uint32_t address, const void *value, size_t length) {
-    const uint8_t *   p   = value;
-    write_log_entry_t log = LOG_ENTRY_MAKE_MULTIBYTE(address, length);
-    for (size_t i = 0; i < length; ++i) {
-        log.raw8[3 + i] = p[i];
+static wear_leveling_status_t wear_leveling_append_entry(backing_store_int_t *values, size_t count) {
+    wear_leveling_status_t status = WEAR_LEVELING_SUCCESS;
+    for (size_t i = 0; i < count; ++i) {
+        status = wear_leveling_append_raw(values[i]);
+        if (status != WEAR_LEVELING_SUCCESS) {
+            return status;
+        }
     }
+    return status;
+}
 
-    // Write to the backing store. See the multi-byte log format in the documentation header at the top of the file.
-    wear_leveling_status_t status;
-#if BACKING_STORE_WRITE_SIZE == 2
-    status = wear_leveling_append_raw(log.raw16[0]);
-    if (status != WEAR_LEVELING_SUCCESS) {
-        return status;
+#else // WEAR_LEVELING_DOUBLE_BANK
+
+/**
+ * Reads the header of the supplied bank.
+ *
+ * @return true if the bank has been committed
+ */
+static bool wear_leveling_read_bank_header(uint8_t bank, uint32_t *sequence) {
+    write_log_entry_t header;
+    if (!wear_leveling_read_entry(WEAR_LEVELING_BANK_BASE(bank) + (WEAR_LEVELING_LOGICAL_SIZE) + 8, &header)) {
+        return false;
+    }
+    if (header.raw32[0] != (WEAR_LEVELING_BANK_MAGIC)) {
+        return false;
     }
+    *sequence = header.raw32[1];
+    return true;
+}
 
-    status = wear_leveling_append_raw(log.raw16[1]);
-    if (status != WEAR_LEVELING_SUCCESS) {
-        return status;
+/**
+ * Reads the consolidated data of the supplied bank into the cache.
+ *
+ * @return true if the consolidated data matches its FNV1a_64 hash
+ */
+static bool wear_leveling_load_bank(uint8_t bank) {
+    const uint32_t base = WEAR_LEVELING_BANK_BASE(bank);
+    if (!backing_store_read_bulk(base, (backing_store_int_t *)wear_leveling.cache, sizeof(wear_leveling.cache) / sizeof(backing_store_int_t))) {
+        wl_dprintf("Failed to read from backing store\n");
+        return false;
     }
 
-    if (length > 1) {
-        status = wear_leveling_append_raw(log.raw16[2]);
-        if (status != WEAR_LEVELING_SUCCESS) {
-            return status;
+    write_log_entry_t entry;
+    wl_dprintf("Reading checksum\n");
+    if (!wear_leveling_read_entry(base + (WEAR_LEVELING_LOGICAL_SIZE), &entry)) {
+        wl_dprintf("Failed to read from backing store\n");
+        return false;
+    }
+    return entry.raw64 == fnv_64a_buf(wear_leveling.cache, (WEAR_LEVELING_LOGICAL_SIZE), FNV1A_64_INIT);
+}
+
+/**
+ * Selects the most recently committed bank, and reads its consolidated data into the cache.
+ * Does not consider the write log.
+ */
+static wear_leveling_status_t wear_leveling_read_consolidated(void) {
+    wl_dprintf("Reading consolidated data\n");
+
+    uint32_t sequence[2] = {0, 0};
+    bool     valid[2];
+    valid[0] = wear_leveling_read_bank_header(0, &sequence[0]);
+    valid[1] = wear_leveling_read_bank_header(1, &sequence[1]);
+
+    // Prefer the most recently committed bank, falling back to the other one if its data doesn't match its hash
+    const uint8_t first = (valid[1] && (!valid[0] || (int32_t)(sequence[1] - sequence[0]) > 0)) ? 1 : 0;
+    for (uint8_t i = 0; i < 2; ++i) {
+        const uint8_t bank = first ^ i;
+        if (valid[bank] && wear_leveling_load_bank(bank)) {
+            wl_dprintf("Checksum matches, using bank %d\n", (int)bank);
+            wear_leveling.active_bank   = bank;
+            wear_leveling.sequence      = sequence[bank];
+            wear_leveling.write_address = WEAR_LEVELING_LOG_START;
+            return WEAR_LEVELING_SUCCESS;
         }
     }
 
-    if (length > 3) {
-        status = wear_leveling_append_raw(log.raw16[3]);
-        if (status != WEAR_LEVELING_SUCCESS) {
-            return status;
+    // If neither bank has been committed, clear the cache but do not flag a failure, which will cater for the completely
+    // clean MCU case.
+    wl_dprintf("No committed bank, clearing cache\n");
+    wear_leveling.active_bank = 0;
+    wear_leveling.sequence    = 0;
+    wear_leveling_clear_cache();
+    return WEAR_LEVELING_SUCCESS;
+}
+
+/**
+ * Performs the next step of the consolidation into the standby bank.
+ * A loss of power during any step leaves the active bank untouched.
+ *
+ * @return WEAR_LEVELING_CONSOLIDATED once the standby bank has been committed and made active
+ */
+static wear_leveling_status_t wear_leveling_consolidate_step(void) {
+    backing_store_lock_status_t lock_status = wear_leveling_unlock();
+    if (lock_status == STATUS_FAILURE) {
+        wear_leveling_lock();
+        return WEAR_LEVELING_FAILED;
+    }
+
+    const uint32_t         standby = WEAR_LEVELING_STANDBY_BASE;
+    wear_leveling_status_t status  = WEAR_LEVELING_SUCCESS;
+    switch (wear_leveling.consolidation) {
+        case CONSOLIDATION_PENDING:
+            wear_leveling.erase_offset  = 0;
+            wear_leveling.consolidation = CONSOLIDATION_ERASING;
+            // fall through
+
+        case CONSOLIDATION_ERASING: {
+            wl_dprintf("Erasing standby bank sector\n");
+            if (!backing_store_erase_range(standby + wear_leveling.erase_offset, (WEAR_LEVELING_ERASE_SECTOR_SIZE))) {
+                wl_dprintf("Failed to erase standby bank\n");
+                status = WEAR_LEVELING_FAILED;
+                break;
+            }
+
+            wear_leveling.erase_offset += (WEAR_LEVELING_ERASE_SECTOR_SIZE);
+            if (wear_leveling.erase_offset < (WEAR_LEVELING_BANK_SIZE)) {
+                break;
+            }
+
+            // From here on, log entries are mirrored into the standby bank's write log
+            wear_leveling.copy_offset           = 0;
+            wear_leveling.copy_hash             = FNV1A_64_INIT;
+            wear_leveling.standby_write_address = standby + (WEAR_LEVELING_BANK_LOG_OFFSET);
+            wear_leveling.consolidation         = CONSOLIDATION_COPYING;
+        } break;
+
+        case CONSOLIDATION_COPYING: {
+            uint8_t *p      = &wear_leveling.cache[wear_leveling.copy_offset];
+            uint32_t length = (WEAR_LEVELING_LOGICAL_SIZE) - wear_leveling.copy_offset;
+            if (length > (WEAR_LEVELING_CONSOLIDATION_CHUNK_SIZE)) {
+                length = (WEAR_LEVELING_CONSOLIDATION_CHUNK_SIZE);
+            }
+
+            wl_dprintf("Writing consolidated data\n");
+            if (!backing_store_write_bulk(standby + wear_leveling.copy_offset, (backing_store_int_t *)p, length / sizeof(backing_store_int_t))) {
+                wl_dprintf("Failed to write to backing store\n");
+                status = WEAR_LEVELING_FAILED;
+                break;
+            }
+
+            // Hash what was actually written, as the cache can change before the copy completes
+            wear_leveling.copy_hash = fnv_64a_buf(p, length, wear_leveling.copy_hash);
+            wear_leveling.copy_offset += length;
+            if (wear_leveling.copy_offset >= (WEAR_LEVELING_LOGICAL_SIZE)) {
+                wear_leveling.consolidation = CONSOLIDATION_COMMITTING;
+            }
+        } break;
+
+        case CONSOLIDATION_COMMITTING: {
+            write_log_entry_t entry;
+            entry.raw64 = wear_leveling.copy_hash;
+            wl_dprintf("Writing checksum\n");
+            if (!wear_leveling_write_entry(standby + (WEAR_LEVELING_LOGICAL_SIZE), &entry)) {
+                status = WEAR_LEVELING_FAILED;
+                break;
+            }
+
+            // The bank header is written last -- until it is, the standby bank is ignored during initialization
+            entry.raw32[0] = (WEAR_LEVELING_BANK_MAGIC);
+            entry.raw32[1] = wear_leveling.sequence + 1;
+            wl_dprintf("Writing bank header\n");
+            if (!wear_leveling_write_entry(standby + (WEAR_LEVELING_LOGICAL_SIZE) + 8, &entry)) {
+                status = WEAR_LEVELING_FAILED;
+                break;
+            }
+
+            // The standby bank already contains every log entry appended since the copy started
+            wear_leveling.active_bank ^= 1;
+            wear_leveling.sequence += 1;
+            wear_leveling.write_address = wear_leveling.standby_write_address;
+            wear_leveling.consolidation = CONSOLIDATION_IDLE;
+            status                      = WEAR_LEVELING_CONSOLIDATED;
+        } break;
+
+        default:
+            break;
+    }
+
+    // The standby bank is in an unknown state after a failure, so start over from the erase
+    if (status == WEAR_LEVELING_FAILED) {
+        wear_leveling.consolidation = CONSOLIDATION_PENDING;
+    }
+
+    if (lock_status == STATUS_SUCCESS) {
+        if (wear_leveling_lock() == STATUS_FAILURE) {
+            status = WEAR_LEVELING_FAILED;
         }
     }
-#elif BACKING_STORE_WRITE_SIZE == 4
-    status = wear_leveling_append_raw(log.raw32[0]);
-    if (status != WEAR_LEVELING_SUCCESS) {
-        return status;
+
+    return status;
+}
+
+/**
+ * Forces a write of the current cache into the standby bank, completing any consolidation already in progress.
+ * The active bank is left intact until the standby bank has been committed.
+ */
+static wear_leveling_status_t wear_leveling_consolidate_force(void) {
+    if (wear_leveling.consolidation == CONSOLIDATION_IDLE) {
+        wear_leveling.consolidation = CONSOLIDATION_PENDING;
     }
 
-    if (length > 1) {
-        status = wear_leveling_append_raw(log.raw32[1]);
-        if (status != WEAR_LEVELING_SUCCESS) {
-            return status;
+    wear_leveling_status_t status;
+    do {
+        status = wear_leveling_consolidate_step();
+    } while (status == WEAR_LEVELING_SUCCESS);
+
+    return status;
+}
+
+/**
+ * Schedules a background consolidation once the write log of the active bank is running out of space.
+ * The consolidation itself is performed by wear_leveling_task().
+ */
+static wear_leveling_status_t wear_leveling_consolidate_if_needed(void) {
+    if (wear_leveling.consolidation == CONSOLIDATION_IDLE && wear_leveling.write_address + (WEAR_LEVELING_CONSOLIDATION_HEADROOM) >= WEAR_LEVELING_LOG_END) {
+        wl_dprintf("Scheduling consolidation\n");
+        wear_leveling.consolidation = CONSOLIDATION_PENDING;
+    }
+
+    return WEAR_LEVELING_SUCCESS;
+}
+
+/**
+ * Appends the supplied log entry to the active bank's write log, mirroring it into the standby bank whilst a
+ * consolidation is copying data. Entries are never split across banks -- if the entry doesn't fit, the consolidation is
+ * completed first and the entry is appended to the new active bank instead.
+ */
+static wear_leveling_status_t wear_leveling_append_entry(backing_store_int_t *values, size_t count) {
+    const uint32_t length = count * (BACKING_STORE_WRITE_SIZE);
+    if (wear_leveling.write_address + length > WEAR_LEVELING_LOG_END) {
+        wl_dprintf("Write log full, completing consolidation\n");
+        if (wear_leveling_consolidate_force() == WEAR_LEVELING_FAILED) {
+            wl_dprintf("Failed to consolidate\n");
+            return WEAR_LEVELING_FAILED;
         }
     }
-#elif BACKING_STORE_WRITE_SIZE == 8
-    status = wear_leveling_append_raw(log.raw64);
-    if (status != WEAR_LEVELING_SUCCESS) {
-        return status;
+
+    if (!backing_store_write_bulk(wear_leveling.write_address, values, count)) {
+        wl_dprintf("Failed to write to backing store\n");
+        return WEAR_LEVELING_FAILED;
+    }
+    wear_leveling.write_address += length;
+
+    if (wear_leveling.consolidation >= CONSOLIDATION_COPYING) {
+        if (backing_store_write_bulk(wear_leveling.standby_write_address, values, count)) {
+            wear_leveling.standby_write_address += length;
+        } else {
+            // The entry made it into the active bank, so only the consolidation needs to start over
+            wl_dprintf("Failed to mirror to standby bank\n");
+            wear_leveling.consolidation = CONSOLIDATION_PENDING;
+        }
+    }
+
+    return wear_leveling_consolidate_if_needed();
+}
+
+#endif // WEAR_LEVELING_DOUBLE_BANK
+
+/**
+ * Encodes the start of the supplied data as a single write log entry, using the smallest encoding available. See the
+ * log formats in the documentation header at the top of the file.
+ *
+ * @return the number of bytes of data encoded, with the number of backing store writes needed in `count`
+ */
+static size_t wear_leveling_encode_entry(uint32_t address, const uint8_t *p, size_t remaining, write_log_entry_t *log, size_t *count) {
+#if BACKING_STORE_WRITE_SIZE == 2
+    // Small-write optimizations - uint16_t, 0 or 1, address is even, address <16384:
+    if (remaining >= 2 && address % 2 == 0 && address < 16384) {
+        const uint16_t v = ((uint16_t)p[1]) << 8 | p[0]; // don't just dereference a uint16_t here -- if unaligned it generates faults on some MCUs
+        if (v == 0 || v == 1) {
+            *log   = LOG_ENTRY_MAKE_WORD_01(address, v);
+            *count = 1;
+            return 2;
+        }
+    }
+
+    // Small-write optimizations - address<64:
+    if (address < 64) {
+        *log   = LOG_ENTRY_MAKE_OPTIMIZED_64(address, *p);
+        *count = 1;
+        return 1;
+    }
+#endif // BACKING_STORE_WRITE_SIZE == 2
+
+    const size_t length = remaining >= LOG_ENTRY_MULTIBYTE_MAX_BYTES ? LOG_ENTRY_MULTIBYTE_MAX_BYTES : remaining;
+    *log                = LOG_ENTRY_MAKE_MULTIBYTE(address, length);
+    for (size_t i = 0; i < length; ++i) {
+        log->raw8[3 + i] = p[i];
     }
+
+#if BACKING_STORE_WRITE_SIZE == 2
+    *count = (length > 3) ? 4 : (length > 1) ? 3 : 2;
+#elif BACKING_STORE_WRITE_SIZE == 4
+    *count = (length > 1) ? 2 : 1;
+#elif BACKING_STORE_WRITE_SIZE == 8
+    *count = 1;
 #endif
-    return status;
+    return length;
 }
 
 /**
@@ -419,44 +748,16 @@ static wear_leveling_status_t wear_leveling_write_raw(uint32_t address, const vo
     size_t                 remaining = length;
     wear_leveling_status_t status    = WEAR_LEVELING_SUCCESS;
     while (remaining > 0) {
+        write_log_entry_t log;
+        size_t            count;
+        const size_t      this_length = wear_leveling_encode_entry(address, p, remaining, &log, &count);
 #if BACKING_STORE_WRITE_SIZE == 2
-        // Small-write optimizations - uint16_t, 0 or 1, address is even, address <16384:
-        if (remaining >= 2 && address % 2 == 0 && address < 16384) {
-            const uint16_t v = ((uint16_t)p[1]) << 8 | p[0]; // don't just dereference a uint16_t here -- if unaligned it generates faults on some MCUs
-            if (v == 0 || v == 1) {
-                const write_log_entry_t log = LOG_ENTRY_MAKE_WORD_01(address, v);
-                status                      = wear_leveling_append_raw(log.raw16[0]);
-                if (status != WEAR_LEVELING_SUCCESS) {
-                    // If consolidation occurred, then the cache has already been written to the consolidated area. No need to continue.
-                    // If a failure occurred, pass it on.
-                    return status;
-                }
-
-                remaining -= 2;
-                address += 2;
-                p += 2;
-                continue;
-            }
-        }
-
-        // Small-write optimizations - address<64:
-        if (address < 64) {
-            const write_log_entry_t log = LOG_ENTRY_MAKE_OPTIMIZED_64(address, *p);
-            status                      = wear_leveling_append_raw(log.raw16[0]);
-            if (status != WEAR_LEVELING_SUCCESS) {
-                // If consolidation occurred, then the cache has already been written to the consolidated area. No need to continue.
-                // If a failure occurred, pass it on.
-                return status;
-            }
-
-            remaining--;
-            address++;
-            p++;
-            continue;
-        }
-#endif // BACKING_STORE_WRITE_SIZE == 2
-        const size_t this_length = remaining >= LOG_ENTRY_MULTIBYTE_MAX_BYTES ? LOG_ENTRY_MULTIBYTE_MAX_BYTES : remaining;
-        status                   = wear_leveling_write_raw_multibyte(address, p, this_length);
+        status = wear_leveling_append_entry(log.raw16, count);
+#elif BACKING_STORE_WRITE_SIZE == 4
+        status = wear_leveling_append_entry(log.raw32, count);
+#elif BACKING_STORE_WRITE_SIZE == 8
+        status = wear_leveling_append_entry(&log.raw64, count);
+#endif
         if (status != WEAR_LEVELING_SUCCESS) {
             // If consolidation occurred, then the cache has already been written to the consolidated area. No need to continue.
             // If a failure occurred, pass it on.
@@ -470,18 +771,200 @@ static wear_leveling_status_t wear_leveling_write_raw(uint32_t address, const vo
     return status;
 }
 
+/**
+ * Determines how much of the supplied data, starting from a byte which differs from the cache, should go into the next
+ * log entry. Unchanged bytes are only carried along where they don't make the log any larger than logging the changed
+ * bytes around them separately.
+ */
+static size_t wear_leveling_changed_length(uint32_t address, const uint8_t *p, size_t remaining) {
+    const uint8_t *cached = &wear_leveling.cache[address];
+    const size_t   window = remaining >= LOG_ENTRY_MULTIBYTE_MAX_BYTES ? LOG_ENTRY_MULTIBYTE_MAX_BYTES : remaining;
+    size_t         length = 1;
+#if BACKING_STORE_WRITE_SIZE == 2
+    // A changed byte which is part of a uint16_t of 0 or 1 is never more expensive to log as the whole word
+    if (remaining >= 2 && address % 2 == 0 && address < 16384 && p[1] == 0 && p[0] <= 1) {
+        return 2;
+    }
+
+    if (address < 64) {
+        // Each byte is logged on its own here, so only take the run of changed bytes
+        while (length < window && p[length] != cached[length]) {
+            ++length;
+        }
+        return length;
+    }
+#endif // BACKING_STORE_WRITE_SIZE == 2
+    for (size_t i = 1; i < window; ++i) {
+        if (p[i] != cached[i]) {
+            length = i + 1;
+        }
+    }
+    return length;
+}
+
+/**
+ * Writes only the parts of the supplied data which differ from the cache into the write log, updating the cache as it
+ * goes.
+ *
+ * @return WEAR_LEVELING_CONSOLIDATED if consolidation occurred part way through
+ */
+static wear_leveling_status_t wear_leveling_write_changes(uint32_t address, const uint8_t *p, size_t length) {
+    wear_leveling_status_t status = WEAR_LEVELING_SUCCESS;
+    size_t                 offset = 0;
+    while (offset < length) {
+        if (p[offset] == wear_leveling.cache[address + offset]) {
+            ++offset;
+            continue;
+        }
+
+        // Update the cache before writing to the backing store -- if we hit the end of the backing store during writes to the log then we'll force a consolidation in-line
+        const size_t this_length = wear_leveling_changed_length(address + (uint32_t)offset, &p[offset], length - offset);
+        memcpy(&wear_leveling.cache[address + offset], &p[offset], this_length);
+
+        switch (wear_leveling_write_raw(address + (uint32_t)offset, &p[offset], this_length)) {
+            case WEAR_LEVELING_SUCCESS:
+                break;
+            case WEAR_LEVELING_CONSOLIDATED:
+                // Everything up to here made it into the consolidated data, the remaining changes are logged after it
+                status = WEAR_LEVELING_CONSOLIDATED;
+                break;
+            default:
+                // Keep the cache reflecting the attempted write, as it would be had the whole value been logged
+                memcpy(&wear_leveling.cache[address + offset], &p[offset], length - offset);
+                return WEAR_LEVELING_FAILED;
+        }
+        offset += this_length;
+    }
+
+    return status;
+}
+
+#ifndef WEAR_LEVELING_DOUBLE_BANK
+/**
+ * Calculates the number of bytes of the write log which wear_leveling_write_changes() would use for the supplied data.
+ */
+static uint32_t wear_leveling_changes_log_size(uint32_t address, const uint8_t *p, size_t length) {
+    uint32_t size   = 0;
+    size_t   offset = 0;
+    while (offset < length) {
+        if (p[offset] == wear_leveling.cache[address + offset]) {
+            ++offset;
+            continue;
+        }
+
+        const size_t this_length = wear_leveling_changed_length(address + (uint32_t)offset, &p[offset], length - offset);
+        for (size_t encoded = 0; encoded < this_length;) {
+            write_log_entry_t log;
+            size_t            count;
+            encoded += wear_leveling_encode_entry(address + (uint32_t)(offset + encoded), &p[offset + encoded], this_length - encoded, &log, &count);
+            size += count * (BACKING_STORE_WRITE_SIZE);
+        }
+        offset += this_length;
+    }
+
+    return size;
+}
+#endif // WEAR_LEVELING_DOUBLE_BANK
+
+/**
+ * Read-ahead buffer used during write log playback, so that the log is fetched from the backing store in bulk rather
+ * than one write unit at a time.
+ */
+typedef struct playback_buffer_t {
+    backing_store_int_t values[(WEAR_LEVELING_PLAYBACK_READ_AHEAD_SIZE) / (BACKING_STORE_WRITE_SIZE)];
+    uint32_t            address;  // backing store address of values[0]
+    size_t              count;    // number of valid entries in values
+    uint32_t            log_end;  // end of the write log, as found by wear_leveling_find_log_end()
+} playback_buffer_t;
+
+/**
+ * Checks whether a log entry's worth of the backing store, starting at the supplied address, is still erased.
+ */
+static bool wear_leveling_log_window_empty(uint32_t address) {
+    backing_store_int_t values[sizeof(write_log_entry_t) / (BACKING_STORE_WRITE_SIZE)];
+    size_t              count = ((WEAR_LEVELING_LOG_END) - address) / (BACKING_STORE_WRITE_SIZE);
+    if (count > sizeof(values) / sizeof(values[0])) {
+        count = sizeof(values) / sizeof(values[0]);
+    }
+    if (!backing_store_read_bulk(address, values, count)) {
+        // Unreadable, so definitely not erased
+        return false;
+    }
+    for (size_t i = 0; i < count; ++i) {
+        if (values[i] != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Finds the end of the write log using a binary search, rather than a linear scan from its start.
+ *
+ * The write log is only ever appended to, so everything after its end is still erased. Each log entry starts with a
+ * nonzero write unit, and whilst the rest of a multibyte entry may be zero, that never adds up to 8 bytes -- so a fully
+ * zeroed 8-byte window can only occur at the end of the log, or within the last entry. Playback decodes the entries
+ * starting before the returned address, and neither reads ahead nor looks for an empty slot past it.
+ */
+static uint32_t wear_leveling_find_log_end(void) {
+    // A write log which fits in a single read-ahead block is read in one go, probing for its end would only add reads
+    if ((WEAR_LEVELING_LOG_END) - (WEAR_LEVELING_LOG_START) <= (WEAR_LEVELING_PLAYBACK_READ_AHEAD_SIZE)) {
+        return WEAR_LEVELING_LOG_END;
+    }
+
+    uint32_t lo = WEAR_LEVELING_LOG_START;
+    uint32_t hi = WEAR_LEVELING_LOG_END;
+    while (lo < hi) {
+        uint32_t mid = lo + ((((hi - lo) / (BACKING_STORE_WRITE_SIZE)) / 2) * (BACKING_STORE_WRITE_SIZE));
+        if (wear_leveling_log_window_empty(mid)) {
+            hi = mid;
+        } else {
+            lo = mid + (BACKING_STORE_WRITE_SIZE);
+        }
+    }
+    return lo;
+}
+
+/**
+ * Reads a single write unit of the write log through the playback read-ahead buffer.
+ */
+static bool wear_leveling_playback_read(playback_buffer_t *buffer, uint32_t address, backing_store_int_t *value) {
+    if (address < buffer->address || address >= buffer->address + buffer->count * (BACKING_STORE_WRITE_SIZE)) {
+        // Read up to the estimated end of the log, or a single log entry's worth if already past it
+        uint32_t limit = (address < buffer->log_end) ? buffer->log_end : (address + sizeof(write_log_entry_t));
+        if (limit > WEAR_LEVELING_LOG_END) {
+            limit = WEAR_LEVELING_LOG_END;
+        }
+        size_t count = (limit - address) / (BACKING_STORE_WRITE_SIZE);
+        if (count > sizeof(buffer->values) / sizeof(buffer->values[0])) {
+            count = sizeof(buffer->values) / sizeof(buffer->values[0]);
+        }
+        if (!backing_store_read_bulk(address, buffer->values, count)) {
+            // Something within the read-ahead window failed; fall back to reading just this location, so that a bad
+            // location further along the log doesn't prevent playback of the entries before it
+            buffer->count = 0;
+            return backing_store_read(address, value);
+        }
+        buffer->address = address;
+        buffer->count   = count;
+    }
+    *value = buffer->values[(address - buffer->address) / (BACKING_STORE_WRITE_SIZE)];
+    return true;
+}
+
 /**
  * "Replays" the write log from the backing store, updating the local cache with updated values.
  */
 static wear_leveling_status_t wear_leveling_playback_log(void) {
     wl_dprintf("Playback write log\n");
 
+    playback_buffer_t      buffer          = {.address = 0, .count = 0, .log_end = wear_leveling_find_log_end()};
     wear_leveling_status_t status          = WEAR_LEVELING_SUCCESS;
     bool                   cancel_playback = false;
-    uint32_t               address         = (WEAR_LEVELING_LOGICAL_SIZE) + 8; // +8 due to the FNV1a_64 of the consolidated area
-    while (!cancel_playback && address < (WEAR_LEVELING_BACKING_SIZE)) {
+    uint32_t               address         = WEAR_LEVELING_LOG_START;
+    while (!cancel_playback && address < buffer.log_end) {
         backing_store_int_t value;
-        bool                ok = backing_store_read(address, &value);
+        bool                ok = wear_leveling_playback_read(&buffer, address, &value);
         if (!ok) {
             wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
             cancel_playback = true;
@@ -510,7 +993,7 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
         switch (LOG_ENTRY_GET_TYPE(log)) {
             case LOG_ENTRY_TYPE_MULTIBYTE: {
 #if BACKING_STORE_WRITE_SIZE == 2
-                ok = backing_store_read(address, &log.raw16[1]);
+                ok = wear_leveling_playback_read(&buffer, address, &log.raw16[1]);
                 if (!ok) {
                     wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
                     cancel_playback = true;
@@ -530,7 +1013,7 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
 
 #if BACKING_STORE_WRITE_SIZE == 2
                 if (l > 1) {
-                    ok = backing_store_read(address, &log.raw16[2]);
+                    ok = wear_leveling_playback_read(&buffer, address, &log.raw16[2]);
                     if (!ok) {
                         wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
                         cancel_playback = true;
@@ -540,7 +1023,7 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
                     address += (BACKING_STORE_WRITE_SIZE);
                 }
                 if (l > 3) {
-                    ok = backing_store_read(address, &log.raw16[3]);
+                    ok = wear_leveling_playback_read(&buffer, address, &log.raw16[3]);
                     if (!ok) {
                         wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
                         cancel_playback = true;
@@ -551,7 +1034,7 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
                 }
 #elif BACKING_STORE_WRITE_SIZE == 4
                 if (l > 1) {
-                    ok = backing_store_read(address, &log.raw32[1]);
+                    ok = wear_leveling_playback_read(&buffer, address, &log.raw32[1]);
                     if (!ok) {
                         wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
                         cancel_playback = true;
@@ -618,6 +1101,11 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
 wear_leveling_status_t wear_leveling_init(void) {
     wl_dprintf("Init\n");
 
+#ifdef WEAR_LEVELING_DOUBLE_BANK
+    // Any consolidation in progress is abandoned, the standby bank gets erased again before reuse
+    wear_leveling.consolidation = CONSOLIDATION_IDLE;
+#endif // WEAR_LEVELING_DOUBLE_BANK
+
     // Reset the cache
     wear_leveling_clear_cache();
 
@@ -662,6 +1150,11 @@ wear_leveling_status_t wear_leveling_erase(void) {
 
     // Perform the erase
     bool ret = backing_store_erase();
+#ifdef WEAR_LEVELING_DOUBLE_BANK
+    wear_leveling.active_bank   = 0;
+    wear_leveling.sequence      = 0;
+    wear_leveling.consolidation = CONSOLIDATION_IDLE;
+#endif // WEAR_LEVELING_DOUBLE_BANK
     wear_leveling_clear_cache();
 
     // Lock the backing store if we acquired the lock successfully
@@ -689,18 +1182,33 @@ wear_leveling_status_t wear_leveling_write(const uint32_t address, const void *v
         return true;
     }
 
-    // Update the cache before writing to the backing store -- if we hit the end of the backing store during writes to the log then we'll force a consolidation in-line
-    memcpy(&wear_leveling.cache[address], value, length);
-
     // Unlock the backing store
     backing_store_lock_status_t lock_status = wear_leveling_unlock();
     if (lock_status == STATUS_FAILURE) {
+        // Reads are still served from the cache
+        memcpy(&wear_leveling.cache[address], value, length);
         wear_leveling_lock();
         return WEAR_LEVELING_FAILED;
     }
 
-    // Perform the actual write
-    wear_leveling_status_t status = wear_leveling_write_raw(address, value, length);
+#ifdef WEAR_LEVELING_DOUBLE_BANK
+    // Consolidation may complete part-way through the write, without interrupting it
+    const uint32_t sequence = wear_leveling.sequence;
+
+    // Perform the actual write, logging only the bytes which changed
+    wear_leveling_status_t status = wear_leveling_write_changes(address, value, length);
+#else  // WEAR_LEVELING_DOUBLE_BANK
+    // Perform the actual write, logging only the bytes which changed. Consolidation writes back the cache and discards
+    // the rest of the write, so if the log is going to fill up part way through, the whole value has to be in the cache
+    // beforehand -- in that case, log it as-is.
+    wear_leveling_status_t status;
+    if (wear_leveling.write_address + wear_leveling_changes_log_size(address, value, length) > WEAR_LEVELING_LOG_END) {
+        memcpy(&wear_leveling.cache[address], value, length);
+        status = wear_leveling_write_raw(address, value, length);
+    } else {
+        status = wear_leveling_write_changes(address, value, length);
+    }
+#endif // WEAR_LEVELING_DOUBLE_BANK
     switch (status) {
         case WEAR_LEVELING_CONSOLIDATED:
         case WEAR_LEVELING_FAILED:
@@ -718,6 +1226,12 @@ wear_leveling_status_t wear_leveling_write(const uint32_t address, const void *v
             break;
     }
 
+#ifdef WEAR_LEVELING_DOUBLE_BANK
+    if (status == WEAR_LEVELING_SUCCESS && sequence != wear_leveling.sequence) {
+        status = WEAR_LEVELING_CONSOLIDATED;
+    }
+#endif // WEAR_LEVELING_DOUBLE_BANK
+
     if (lock_status == STATUS_SUCCESS) {
         if (wear_leveling_lock() == STATUS_FAILURE) {
             status = WEAR_LEVELING_FAILED;
@@ -744,6 +1258,18 @@ wear_leveling_status_t wear_leveling_read(const uint32_t address, void *value, s
     return WEAR_LEVELING_SUCCESS;
 }
 
+/**
+ * Performs a single step of any pending background consolidation.
+ */
+wear_leveling_status_t wear_leveling_task(void) {
+#ifdef WEAR_LEVELING_DOUBLE_BANK
+    if (wear_leveling.consolidation != CONSOLIDATION_IDLE) {
+        return wear_leveling_consolidate_step();
+    }
+#endif // WEAR_LEVELING_DOUBLE_BANK
+    return WEAR_LEVELING_SUCCESS;
+}
+
 /**
  * Weak implementation of bulk read, drivers can implement more optimised implementations.
  */
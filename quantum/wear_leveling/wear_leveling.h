@@ -52,3 +52,12 @@ wear_leveling_status_t wear_leveling_write(uint32_t address, const void* value,
  * @return Status of the request
  */
 wear_leveling_status_t wear_leveling_read(uint32_t address, void* value, size_t length);
+
+/**
+ * Performs a single step of any pending background consolidation.
+ *
+ * Only does work when built with WEAR_LEVELING_DOUBLE_BANK, otherwise consolidation always occurs inline during writes.
+ *
+ * @return Status of the request, WEAR_LEVELING_CONSOLIDATED once the standby bank has been committed
+ */
+wear_leveling_status_t wear_leveling_task(void);
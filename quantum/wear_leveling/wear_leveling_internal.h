@@ -64,10 +64,57 @@ STATIC_ASSERT(WEAR_LEVELING_BACKING_SIZE >= (WEAR_LEVELING_LOGICAL_SIZE * 2), "T
 STATIC_ASSERT(WEAR_LEVELING_LOGICAL_SIZE % BACKING_STORE_WRITE_SIZE == 0, "Logical size must be a multiple of write size");
 STATIC_ASSERT(WEAR_LEVELING_BACKING_SIZE % WEAR_LEVELING_LOGICAL_SIZE == 0, "Backing size must be a multiple of logical size");
 
+// Number of bytes of the write log fetched from the backing store at a time during playback
+#ifndef WEAR_LEVELING_PLAYBACK_READ_AHEAD_SIZE
+#    define WEAR_LEVELING_PLAYBACK_READ_AHEAD_SIZE 64
+#endif // WEAR_LEVELING_PLAYBACK_READ_AHEAD_SIZE
+
+STATIC_ASSERT(WEAR_LEVELING_PLAYBACK_READ_AHEAD_SIZE >= 8 && WEAR_LEVELING_PLAYBACK_READ_AHEAD_SIZE % BACKING_STORE_WRITE_SIZE == 0, "Playback read-ahead size must fit a complete write log entry, and be a multiple of write size");
+
+// Partial erases are needed by double-bank consolidation, and by the kv NVM provider -- both split the backing store into two equal banks
+#if defined(WEAR_LEVELING_DOUBLE_BANK) || defined(NVM_DRIVER_KV)
+#    define BACKING_STORE_ERASE_RANGE
+#    define WEAR_LEVELING_BANK_SIZE ((WEAR_LEVELING_BACKING_SIZE) / 2)
+
+// Smallest range that backing_store_erase_range() can erase -- defaults to a whole bank if the driver doesn't know its sector size
+#    ifndef WEAR_LEVELING_ERASE_SECTOR_SIZE
+#        define WEAR_LEVELING_ERASE_SECTOR_SIZE (WEAR_LEVELING_BANK_SIZE)
+#    endif // WEAR_LEVELING_ERASE_SECTOR_SIZE
+
+STATIC_ASSERT(WEAR_LEVELING_ERASE_SECTOR_SIZE > 0 && WEAR_LEVELING_BANK_SIZE % WEAR_LEVELING_ERASE_SECTOR_SIZE == 0, "Bank size must be a multiple of the erase sector size");
+#endif
+
+#ifdef WEAR_LEVELING_DOUBLE_BANK
+// Each bank holds its own consolidated data, followed by the FNV1a_64 of that data, the bank header, then the write log
+#    define WEAR_LEVELING_BANK_LOG_OFFSET ((WEAR_LEVELING_LOGICAL_SIZE) + 16)
+#    define WEAR_LEVELING_BANK_LOG_SIZE ((WEAR_LEVELING_BANK_SIZE) - (WEAR_LEVELING_BANK_LOG_OFFSET))
+#    define WEAR_LEVELING_BANK_MAGIC 0x4B4E4257 // "WBNK"
+
+// Number of bytes left in the write log when a background consolidation is scheduled
+#    ifndef WEAR_LEVELING_CONSOLIDATION_HEADROOM
+#        define WEAR_LEVELING_CONSOLIDATION_HEADROOM ((((WEAR_LEVELING_BANK_LOG_SIZE) / 4) / (BACKING_STORE_WRITE_SIZE)) * (BACKING_STORE_WRITE_SIZE))
+#    endif // WEAR_LEVELING_CONSOLIDATION_HEADROOM
+
+// Number of bytes of consolidated data copied into the standby bank per background step
+#    ifndef WEAR_LEVELING_CONSOLIDATION_CHUNK_SIZE
+#        define WEAR_LEVELING_CONSOLIDATION_CHUNK_SIZE 64
+#    endif // WEAR_LEVELING_CONSOLIDATION_CHUNK_SIZE
+
+STATIC_ASSERT(WEAR_LEVELING_BACKING_SIZE >= (WEAR_LEVELING_LOGICAL_SIZE * 4), "Double-bank backing size must be at least four times the size of the logical size");
+STATIC_ASSERT(WEAR_LEVELING_BANK_SIZE % BACKING_STORE_WRITE_SIZE == 0, "Bank size must be a multiple of write size");
+STATIC_ASSERT(WEAR_LEVELING_CONSOLIDATION_HEADROOM >= 8, "Consolidation headroom must fit at least one complete write log entry");
+STATIC_ASSERT(WEAR_LEVELING_CONSOLIDATION_HEADROOM < WEAR_LEVELING_BANK_LOG_SIZE, "Consolidation headroom must be smaller than the write log");
+STATIC_ASSERT(WEAR_LEVELING_CONSOLIDATION_HEADROOM % BACKING_STORE_WRITE_SIZE == 0, "Consolidation headroom must be a multiple of write size");
+STATIC_ASSERT(WEAR_LEVELING_CONSOLIDATION_CHUNK_SIZE > 0 && WEAR_LEVELING_CONSOLIDATION_CHUNK_SIZE % BACKING_STORE_WRITE_SIZE == 0, "Consolidation chunk size must be a nonzero multiple of write size");
+#endif // WEAR_LEVELING_DOUBLE_BANK
+
 // Backing Store API, to be implemented elsewhere by flash driver etc.
 bool backing_store_init(void);
 bool backing_store_unlock(void);
 bool backing_store_erase(void);
+#ifdef BACKING_STORE_ERASE_RANGE
+bool backing_store_erase_range(uint32_t address, uint32_t length); // must only erase the sectors within the supplied range
+#endif
 bool backing_store_write(uint32_t address, backing_store_int_t value);
 bool backing_store_write_bulk(uint32_t address, backing_store_int_t* values, size_t item_count); // weak implementation already provided, optimized implementation can be implemented by driver
 bool backing_store_lock(void);
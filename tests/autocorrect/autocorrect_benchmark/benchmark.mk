@@ -0,0 +1,5 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+# Times dictionary lookups with the default autocorrect dictionary.
+AUTOCORRECT_ENABLE = yes
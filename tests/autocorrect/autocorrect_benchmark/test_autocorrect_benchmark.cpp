@@ -0,0 +1,30 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <cstdio>
+
+#include "../test_autocorrect.cpp"
+
+// Reports how many buffer lookups per second the dictionary walk manages
+TEST_F(AutoCorrect, lookup_throughput) {
+    TestDriver driver;
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+
+    static const std::string text   = "the quick brown fox jumps over the lazy dog while seven wizards quietly judge boxing matches ";
+    const size_t             rounds = 20000;
+
+    capture_corrections = true;
+
+    FeedEnter();
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < rounds; ++i) {
+        FeedText(text);
+        captured_text.clear();
+    }
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    std::printf("[ BENCH    ] %zu lookups in %.3f s, %.0f lookups/s\n", rounds * text.size(), elapsed.count(), rounds * text.size() / elapsed.count());
+
+    VERIFY_AND_CLEAR(driver);
+}
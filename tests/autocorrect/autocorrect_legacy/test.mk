@@ -0,0 +1,5 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+# Same suite as autocorrect, against a dictionary in the pre-DAWG trie format.
+AUTOCORRECT_ENABLE = yes
@@ -1,6 +1,7 @@
 // Copyright 2021 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <string>
 #include "keycode.h"
 #include "test_common.hpp"
 
@@ -8,11 +9,52 @@ using ::testing::_;
 using ::testing::AnyNumber;
 using ::testing::InSequence;
 
+// Text edited by corrections while `capture_corrections` is set, instead of
+// tapping the keys.
+static bool        capture_corrections = false;
+static std::string captured_text;
+
+extern "C" bool apply_autocorrect(uint8_t backspaces, const char *str, char *typo, char *correct) {
+    if (!capture_corrections) {
+        return true;
+    }
+    captured_text.erase(captured_text.size() - std::min<size_t>(backspaces, captured_text.size()));
+    captured_text += str;
+    return false;
+}
+
 class AutoCorrect : public TestFixture {
    public:
     void SetUp() override {
         autocorrect_enable();
     }
+
+    void TearDown() override {
+        capture_corrections = false;
+    }
+
+    // Feeds `text` straight to process_autocorrect(), appending what would be
+    // typed to `captured_text`. A ':' stands for a space, as in the dictionary.
+    void FeedText(const std::string &text) {
+        keyrecord_t record   = {};
+        record.event.type    = KEY_EVENT;
+        record.event.pressed = true;
+        for (char c : text) {
+            uint16_t keycode = (c == ':' || c == ' ') ? KC_SPC : c == '\'' ? KC_QUOTE : KC_A + (c - 'a');
+            if (process_autocorrect(keycode, &record)) {
+                captured_text += c == ':' ? ' ' : c;
+            }
+        }
+    }
+
+    // Starts a new line, clearing the autocorrect buffer.
+    void FeedEnter(void) {
+        keyrecord_t record   = {};
+        record.event.type    = KEY_EVENT;
+        record.event.pressed = true;
+        process_autocorrect(KC_ENTER, &record);
+        captured_text.clear();
+    }
     // Convenience function to tap `key`.
     void TapKey(KeymapKey key) {
         key.press();
@@ -202,3 +244,97 @@ TEST_F(AutoCorrect, overture_should_not_autocorrect) {
 
     VERIFY_AND_CLEAR(driver);
 }
+
+// Test that every entry of the dictionary is found and corrected
+TEST_F(AutoCorrect, dictionary_entries_autocorrect) {
+    TestDriver driver;
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+
+    static const struct {
+        const char *typo;
+        const char *correction;
+    } entries[] = {
+        {":guage", "gauge"},
+        {":the:the:", "the"},
+        {":thier", "their"},
+        {":ture", "true"},
+        {"accomodate", "accommodate"},
+        {"acommodate", "accommodate"},
+        {"aparent", "apparent"},
+        {"aparrent", "apparent"},
+        {"apparant", "apparent"},
+        {"apparrent", "apparent"},
+        {"aquire", "acquire"},
+        {"becuase", "because"},
+        {"cauhgt", "caught"},
+        {"cheif", "chief"},
+        {"choosen", "chosen"},
+        {"cieling", "ceiling"},
+        {"collegue", "colleague"},
+        {"concensus", "consensus"},
+        {"contians", "contains"},
+        {"cosnt", "const"},
+        {"dervied", "derived"},
+        {"fales", "false"},
+        {"fasle", "false"},
+        {"fitler", "filter"},
+        {"flase", "false"},
+        {"foward", "forward"},
+        {"frequecy", "frequency"},
+        {"gaurantee", "guarantee"},
+        {"guaratee", "guarantee"},
+        {"heigth", "height"},
+        {"heirarchy", "hierarchy"},
+        {"inclued", "include"},
+        {"interator", "iterator"},
+        {"intput", "input"},
+        {"invliad", "invalid"},
+        {"lenght", "length"},
+        {"liasion", "liaison"},
+        {"libary", "library"},
+        {"listner", "listener"},
+        {"looses:", "loses"},
+        {"looup", "lookup"},
+        {"manefist", "manifest"},
+        {"namesapce", "namespace"},
+        {"namespcae", "namespace"},
+        {"occassion", "occasion"},
+        {"occured", "occurred"},
+        {"ouptut", "output"},
+        {"ouput", "output"},
+        {"overide", "override"},
+        {"postion", "position"},
+        {"priviledge", "privilege"},
+        {"psuedo", "pseudo"},
+        {"recieve", "receive"},
+        {"refered", "referred"},
+        {"relevent", "relevant"},
+        {"repitition", "repetition"},
+        {"retrun", "return"},
+        {"retun", "return"},
+        {"reuslt", "result"},
+        {"reutrn", "return"},
+        {"saftey", "safety"},
+        {"seperate", "separate"},
+        {"singed", "signed"},
+        {"stirng", "string"},
+        {"strign", "string"},
+        {"swithc", "switch"},
+        {"swtich", "switch"},
+        {"thresold", "threshold"},
+        {"udpate", "update"},
+        {"widht", "width"},
+    };
+
+    capture_corrections = true;
+    for (const auto &entry : entries) {
+        const std::string typo     = entry.typo;
+        const std::string expected = (typo.front() == ':' ? " " : "") + std::string(entry.correction) + (typo.back() == ':' ? " " : "");
+
+        FeedEnter();
+        FeedText(typo);
+        EXPECT_EQ(captured_text, expected) << "typo: " << typo;
+    }
+
+    VERIFY_AND_CLEAR(driver);
+}
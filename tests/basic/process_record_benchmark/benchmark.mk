@@ -0,0 +1,13 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+# Times process_record_quantum() for plain keys with a typical set of features,
+# whose handlers are skipped or called through process_record_handler_table.
+CAPS_WORD_ENABLE = yes
+LAYER_LOCK_ENABLE = yes
+GRAVE_ESC_ENABLE = yes
+MAGIC_ENABLE = yes
+UNICODE_ENABLE = yes
+TRI_LAYER_ENABLE = yes
+DYNAMIC_TAPPING_TERM_ENABLE = yes
+PROGRAMMABLE_BUTTON_ENABLE = yes
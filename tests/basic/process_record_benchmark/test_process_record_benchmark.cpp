@@ -0,0 +1,46 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <cstdio>
+
+#include "keycode.h"
+#include "test_common.hpp"
+
+using testing::_;
+
+class ProcessRecord : public TestFixture {};
+
+TEST_F(ProcessRecord, benchmark) {
+    TestDriver driver;
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(0);
+
+    // Plain keys are what the handler table is tuned for, none of the enabled
+    // features handle them.
+    KeymapKey keys[] = {
+        KeymapKey(0, 0, 0, KC_A),
+        KeymapKey(0, 1, 0, KC_LEFT_SHIFT),
+        KeymapKey(0, 2, 0, KC_SPACE),
+        KeymapKey(0, 3, 0, KC_1),
+    };
+    set_keymap({keys[0], keys[1], keys[2], keys[3]});
+
+    const unsigned rounds = 250000;
+    bool           passed = true;
+    auto           start  = std::chrono::steady_clock::now();
+    for (unsigned round = 0; round < rounds; ++round) {
+        for (KeymapKey &key : keys) {
+            keyrecord_t press   = {.event = {.key = key.position, .type = KEY_EVENT, .pressed = true}};
+            keyrecord_t release = {.event = {.key = key.position, .type = KEY_EVENT, .pressed = false}};
+            passed &= process_record_quantum(&press);
+            passed &= process_record_quantum(&release);
+        }
+    }
+    auto   end     = std::chrono::steady_clock::now();
+    double seconds = std::chrono::duration<double>(end - start).count();
+
+    unsigned records = rounds * 4 * 2;
+    printf("[ BENCH    ] %u records: %.1f ns/record\n", records, seconds * 1e9 / records);
+    EXPECT_TRUE(passed);
+    VERIFY_AND_CLEAR(driver);
+}
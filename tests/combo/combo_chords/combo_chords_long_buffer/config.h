@@ -0,0 +1,12 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define TAPPING_TERM 200
+#define EXTRA_EXTRA_LONG_COMBOS
+#define COMBO_BUFFER_LENGTH 8
+// more key_buffer slots than a combo_key_mask_t tracks
+#define COMBO_KEY_BUFFER_LENGTH 40
@@ -0,0 +1,7 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+# Same suite as combo_chords, with a key buffer longer than 32 slots.
+COMBO_ENABLE = yes
+
+INTROSPECTION_KEYMAP_C = ../test_combos_chords.c
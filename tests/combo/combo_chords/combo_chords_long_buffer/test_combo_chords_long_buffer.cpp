@@ -0,0 +1,4 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "../test_combo_chords.cpp"
@@ -0,0 +1,36 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "../test_combo_chords.cpp"
+
+TEST_F(ComboChords, full_buffer_keeps_combo_pending) {
+    TestDriver driver;
+    InSequence s;
+
+    // hi doesn't fit in the buffer holding ab and fg, it is kept pending and
+    // applied after them; c still turns ab into abc.
+    EXPECT_REPORT(driver, (KC_F1));
+    EXPECT_REPORT(driver, (KC_F1, KC_F2));
+    EXPECT_REPORT(driver, (KC_F1, KC_F2, KC_F13));
+    EXPECT_REPORT(driver, (KC_F2, KC_F13));
+    EXPECT_REPORT(driver, (KC_F13));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo(chord({KC_A, KC_B, KC_F, KC_G, KC_H, KC_I, KC_C}));
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboChords, pending_combo_superseded_by_longer_combo) {
+    TestDriver driver;
+    InSequence s;
+
+    // ab is pending behind fg and hi when c turns it into abc, which is kept
+    // pending in its place.
+    EXPECT_REPORT(driver, (KC_F1));
+    EXPECT_REPORT(driver, (KC_F1, KC_F2));
+    EXPECT_REPORT(driver, (KC_F1, KC_F2, KC_F13));
+    EXPECT_REPORT(driver, (KC_F2, KC_F13));
+    EXPECT_REPORT(driver, (KC_F13));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo(chord({KC_F, KC_G, KC_H, KC_I, KC_A, KC_B, KC_C}));
+    VERIFY_AND_CLEAR(driver);
+}
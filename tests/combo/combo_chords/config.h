@@ -0,0 +1,11 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define TAPPING_TERM 200
+#define EXTRA_EXTRA_LONG_COMBOS
+// room for the six simultaneous combos of disjoint_combos_fire_together
+#define COMBO_BUFFER_LENGTH 8
@@ -0,0 +1,89 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.h"
+#include "test_driver.hpp"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+static const uint16_t chord_keycodes[] = {
+    KC_A, KC_B, KC_C, KC_D, KC_E, KC_F, KC_G, KC_H, KC_I, KC_J, KC_K, KC_L, KC_M, KC_N, KC_O, KC_P,
+    KC_Q, KC_R, KC_S, KC_T, KC_U, KC_V, KC_W, KC_X, KC_Y, KC_Z, KC_1, KC_2, KC_3, KC_4, KC_5, KC_6,
+};
+
+class ComboChords : public TestFixture {
+   protected:
+    std::vector<KeymapKey> keys;
+
+    void SetUp() override {
+        for (uint8_t i = 0; i < sizeof(chord_keycodes) / sizeof(chord_keycodes[0]); ++i) {
+            keys.emplace_back(0, i % MATRIX_COLS, i / MATRIX_COLS, chord_keycodes[i]);
+            add_key(keys.back());
+        }
+    }
+
+    std::vector<KeymapKey> chord(std::initializer_list<uint16_t> keycodes) {
+        std::vector<KeymapKey> chord_keys;
+        for (uint16_t keycode : keycodes) {
+            for (KeymapKey &key : keys) {
+                if (key.code == keycode) {
+                    chord_keys.push_back(key);
+                }
+            }
+        }
+        return chord_keys;
+    }
+};
+
+TEST_F(ComboChords, superset_combo_wins) {
+    TestDriver driver;
+
+    EXPECT_REPORT(driver, (KC_F13));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo(chord({KC_A, KC_B, KC_C}));
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboChords, subset_combo_fires_alone) {
+    TestDriver driver;
+
+    EXPECT_REPORT(driver, (KC_F15));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo(chord({KC_C, KC_B}));
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboChords, disjoint_combos_fire_together) {
+    TestDriver driver;
+    InSequence s;
+
+    // More simultaneous combos than the default buffer of 4 would hold.
+    EXPECT_REPORT(driver, (KC_F1));
+    EXPECT_REPORT(driver, (KC_F1, KC_F2));
+    EXPECT_REPORT(driver, (KC_F1, KC_F2, KC_F3));
+    EXPECT_REPORT(driver, (KC_F1, KC_F2, KC_F3, KC_F4));
+    EXPECT_REPORT(driver, (KC_F1, KC_F2, KC_F3, KC_F4, KC_F5));
+    EXPECT_REPORT(driver, (KC_F1, KC_F2, KC_F3, KC_F4, KC_F5, KC_F6));
+    EXPECT_REPORT(driver, (KC_F2, KC_F3, KC_F4, KC_F5, KC_F6));
+    EXPECT_REPORT(driver, (KC_F3, KC_F4, KC_F5, KC_F6));
+    EXPECT_REPORT(driver, (KC_F4, KC_F5, KC_F6));
+    EXPECT_REPORT(driver, (KC_F5, KC_F6));
+    EXPECT_REPORT(driver, (KC_F6));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo(chord({KC_F, KC_G, KC_H, KC_I, KC_J, KC_K, KC_L, KC_M, KC_N, KC_O, KC_P, KC_Q}));
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboChords, thirty_two_key_combo) {
+    TestDriver driver;
+
+    EXPECT_REPORT(driver, (KC_ENTER));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo(keys);
+    VERIFY_AND_CLEAR(driver);
+}
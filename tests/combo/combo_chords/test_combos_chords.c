@@ -0,0 +1,36 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "quantum.h"
+
+enum combos { abc, ab, bc, fg, hi, jk, lm, no, pq, all };
+
+uint16_t const abc_combo[] = {KC_A, KC_B, KC_C, COMBO_END};
+uint16_t const ab_combo[]  = {KC_A, KC_B, COMBO_END};
+uint16_t const bc_combo[]  = {KC_B, KC_C, COMBO_END};
+uint16_t const fg_combo[]  = {KC_F, KC_G, COMBO_END};
+uint16_t const hi_combo[]  = {KC_H, KC_I, COMBO_END};
+uint16_t const jk_combo[]  = {KC_J, KC_K, COMBO_END};
+uint16_t const lm_combo[]  = {KC_L, KC_M, COMBO_END};
+uint16_t const no_combo[]  = {KC_N, KC_O, COMBO_END};
+uint16_t const pq_combo[]  = {KC_P, KC_Q, COMBO_END};
+
+// clang-format off
+uint16_t const all_combo[] = {
+    KC_A, KC_B, KC_C, KC_D, KC_E, KC_F, KC_G, KC_H, KC_I, KC_J, KC_K, KC_L, KC_M, KC_N, KC_O, KC_P,
+    KC_Q, KC_R, KC_S, KC_T, KC_U, KC_V, KC_W, KC_X, KC_Y, KC_Z, KC_1, KC_2, KC_3, KC_4, KC_5, KC_6,
+    COMBO_END
+};
+
+combo_t key_combos[] = {
+    [abc] = COMBO(abc_combo, KC_F13),
+    [ab]  = COMBO(ab_combo, KC_F14),
+    [bc]  = COMBO(bc_combo, KC_F15),
+    [fg]  = COMBO(fg_combo, KC_F1),
+    [hi]  = COMBO(hi_combo, KC_F2),
+    [jk]  = COMBO(jk_combo, KC_F3),
+    [lm]  = COMBO(lm_combo, KC_F4),
+    [no]  = COMBO(no_combo, KC_F5),
+    [pq]  = COMBO(pq_combo, KC_F6),
+    [all] = COMBO(all_combo, KC_ENTER),
+};
+// clang-format on
@@ -0,0 +1,7 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+# Times combo lookup with COMBO_INDEX_SIZE, compare with combo_index_scan_benchmark.
+COMBO_ENABLE = yes
+
+INTROSPECTION_KEYMAP_C = ../test_combos_index.c
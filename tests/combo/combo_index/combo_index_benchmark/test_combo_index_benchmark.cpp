@@ -0,0 +1,30 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <cstdio>
+
+#include "../test_combo_index.cpp"
+
+TEST_F(ComboIndex, benchmark) {
+    TestDriver driver;
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(0);
+
+    const unsigned rounds = 20;
+    auto           start  = std::chrono::steady_clock::now();
+    for (unsigned round = 0; round < rounds; ++round) {
+        for (uint8_t span = 1; span <= COMBO_TEST_SPAN; ++span) {
+            for (uint8_t i = 0; i < COMBO_TEST_KEY_COUNT; ++i) {
+                tap_combo({key(i), key(i + span)});
+            }
+        }
+    }
+    auto   end     = std::chrono::steady_clock::now();
+    double seconds = std::chrono::duration<double>(end - start).count();
+
+    // Each combo tap is two presses and two releases.
+    unsigned events = rounds * COMBO_TEST_GENERATED_COUNT * 4;
+    printf("[ BENCH    ] %u combos, %u key events: %.0f events/s\n", combo_count(), events, events / seconds);
+    EXPECT_EQ(combo_test_event_count, rounds * COMBO_TEST_GENERATED_COUNT);
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,7 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+# Same benchmark as combo_index_benchmark, without COMBO_INDEX_SIZE, for comparison.
+COMBO_ENABLE = yes
+
+INTROSPECTION_KEYMAP_C = ../test_combos_index.c
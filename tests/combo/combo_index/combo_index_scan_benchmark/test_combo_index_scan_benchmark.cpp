@@ -0,0 +1,4 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "../combo_index_benchmark/test_combo_index_benchmark.cpp"
@@ -0,0 +1,144 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "keymap_introspection.h"
+}
+#include "test_driver.hpp"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+using testing::_;
+
+#define COMBO_TEST_KEY_COUNT 36
+#define COMBO_TEST_SPAN 4
+#define COMBO_TEST_GENERATED_COUNT (COMBO_TEST_KEY_COUNT * COMBO_TEST_SPAN)
+
+// Generated combos, pairing each key with the next COMBO_TEST_SPAN keys (wrapping around), after the static ones.
+static uint16_t generated_keys[COMBO_TEST_GENERATED_COUNT][3];
+static combo_t  generated_combos[COMBO_TEST_GENERATED_COUNT];
+static bool     generated = false;
+
+static uint16_t combo_test_event_count = 0;
+static uint16_t combo_test_last_event  = COMBO_END;
+
+static void generate_combos(void) {
+    for (uint16_t span = 1; span <= COMBO_TEST_SPAN; ++span) {
+        for (uint16_t key = 0; key < COMBO_TEST_KEY_COUNT; ++key) {
+            uint16_t idx               = (span - 1) * COMBO_TEST_KEY_COUNT + key;
+            generated_keys[idx][0]     = KC_A + key;
+            generated_keys[idx][1]     = KC_A + (key + span) % COMBO_TEST_KEY_COUNT;
+            generated_keys[idx][2]     = COMBO_END;
+            generated_combos[idx]      = {};
+            generated_combos[idx].keys = generated_keys[idx];
+        }
+    }
+    generated = true;
+}
+
+extern "C" {
+uint16_t combo_count(void) {
+    return combo_count_raw() + COMBO_TEST_GENERATED_COUNT;
+}
+
+combo_t *combo_get(uint16_t combo_idx) {
+    if (!generated) {
+        generate_combos();
+    }
+    if (combo_idx < combo_count_raw()) {
+        return combo_get_raw(combo_idx);
+    }
+    return &generated_combos[combo_idx - combo_count_raw()];
+}
+
+void process_combo_event(uint16_t combo_index, bool pressed) {
+    if (pressed) {
+        ++combo_test_event_count;
+        combo_test_last_event = combo_index;
+    }
+}
+}
+
+class ComboIndex : public TestFixture {
+   protected:
+    std::vector<KeymapKey> keys;
+
+    void SetUp() override {
+        for (uint8_t i = 0; i < COMBO_TEST_KEY_COUNT; ++i) {
+            keys.emplace_back(0, i % MATRIX_COLS, i / MATRIX_COLS, KC_A + i);
+            add_key(keys.back());
+        }
+        combo_test_event_count = 0;
+        combo_test_last_event  = COMBO_END;
+    }
+
+    KeymapKey &key(uint8_t index) {
+        return keys[index % COMBO_TEST_KEY_COUNT];
+    }
+
+    uint16_t generated_index(uint8_t key, uint8_t span) {
+        return 1 + (span - 1) * COMBO_TEST_KEY_COUNT + key;
+    }
+};
+
+TEST_F(ComboIndex, every_generated_combo_fires) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    for (uint8_t span = 1; span <= COMBO_TEST_SPAN; ++span) {
+        for (uint8_t i = 0; i < COMBO_TEST_KEY_COUNT; ++i) {
+            tap_combo({key(i), key(i + span)});
+            EXPECT_EQ(combo_test_last_event, generated_index(i, span));
+        }
+    }
+    EXPECT_EQ(combo_test_event_count, COMBO_TEST_GENERATED_COUNT);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboIndex, reversed_press_order_fires) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    tap_combo({key(7), key(5)});
+    EXPECT_EQ(combo_test_last_event, generated_index(5, 2));
+    EXPECT_EQ(combo_test_event_count, 1);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboIndex, static_combo_fires) {
+    TestDriver driver;
+    KeymapKey  key_f1(0, 8, 3, KC_F1);
+    KeymapKey  key_f2(0, 9, 3, KC_F2);
+    add_key(key_f1);
+    add_key(key_f2);
+
+    EXPECT_REPORT(driver, (KC_ESC));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_f1, key_f2});
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_EQ(combo_test_event_count, 0);
+}
+
+TEST_F(ComboIndex, non_combo_pair_is_passed_through) {
+    TestDriver driver;
+
+    // Keys 0 and 10 are further apart than COMBO_TEST_SPAN, so they don't form a combo.
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_REPORT(driver, (KC_A, KC_K));
+    EXPECT_REPORT(driver, (KC_K));
+    EXPECT_EMPTY_REPORT(driver);
+    key(0).press();
+    run_one_scan_loop();
+    key(10).press();
+    run_one_scan_loop();
+    key(0).release();
+    run_one_scan_loop();
+    key(10).release();
+    idle_for(TAPPING_TERM);
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_EQ(combo_test_event_count, 0);
+}
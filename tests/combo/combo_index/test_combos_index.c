@@ -0,0 +1,11 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "quantum.h"
+
+uint16_t const esc_combo[] = {KC_F1, KC_F2, COMBO_END};
+
+// clang-format off
+combo_t key_combos[] = {
+    COMBO(esc_combo, KC_ESC),
+};
+// clang-format on
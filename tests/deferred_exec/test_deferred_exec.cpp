@@ -0,0 +1,214 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+
+#include "test_common.hpp"
+#include "test_fixture.hpp"
+
+extern "C" void set_time(uint32_t t);
+extern "C" void advance_time(uint32_t ms);
+
+namespace {
+
+struct record_t {
+    std::vector<int>      fired;
+    std::vector<uint32_t> fired_at;
+    uint32_t              repeat_ms;
+    int                   repeats_left;
+    deferred_token        cancel_token;
+};
+
+struct executor_arg_t {
+    record_t *record;
+    int       id;
+};
+
+uint32_t record_callback(uint32_t trigger_time, void *cb_arg) {
+    executor_arg_t *arg = (executor_arg_t *)cb_arg;
+    arg->record->fired.push_back(arg->id);
+    arg->record->fired_at.push_back(timer_read32());
+    if (arg->record->cancel_token != INVALID_DEFERRED_TOKEN) {
+        cancel_deferred_exec(arg->record->cancel_token);
+        arg->record->cancel_token = INVALID_DEFERRED_TOKEN;
+    }
+    if (arg->record->repeats_left > 0) {
+        arg->record->repeats_left--;
+        return arg->record->repeat_ms;
+    }
+    return 0;
+}
+
+} // namespace
+
+class DeferredExec : public TestFixture {
+   protected:
+    record_t       record = {};
+    executor_arg_t args[MAX_DEFERRED_EXECUTORS + 1];
+
+    // The fixture clears the timer for every test, but the executor throttles itself against the last time it ran
+    static uint32_t resume_time;
+
+    void SetUp() override {
+        set_time(resume_time);
+        for (int i = 0; i < MAX_DEFERRED_EXECUTORS + 1; i++) {
+            args[i] = {&record, i};
+        }
+    }
+
+    deferred_token defer(int id, uint32_t delay_ms) {
+        return defer_exec(delay_ms, record_callback, &args[id]);
+    }
+
+    void run_for(uint32_t ms) {
+        for (uint32_t i = 0; i < ms; i++) {
+            advance_time(1);
+            deferred_exec_task();
+        }
+    }
+
+    uint32_t next_deadline_in(void) {
+        uint32_t deadline = 0;
+        EXPECT_TRUE(deferred_exec_next_deadline(&deadline));
+        return TIMER_DIFF_32(deadline, timer_read32());
+    }
+
+    void TearDown() override {
+        record.repeats_left = 0;
+        run_for(1000);
+        uint32_t deadline;
+        EXPECT_FALSE(deferred_exec_next_deadline(&deadline));
+        resume_time = timer_read32();
+    }
+};
+
+uint32_t DeferredExec::resume_time = 0;
+
+TEST_F(DeferredExec, fires_in_deadline_order) {
+    defer(0, 30);
+    defer(1, 10);
+    defer(2, 20);
+    defer(3, 5);
+    EXPECT_EQ(next_deadline_in(), 5);
+
+    run_for(10);
+    EXPECT_EQ(record.fired, (std::vector<int>{3, 1}));
+    EXPECT_EQ(next_deadline_in(), 10);
+
+    run_for(20);
+    EXPECT_EQ(record.fired, (std::vector<int>{3, 1, 2, 0}));
+}
+
+TEST_F(DeferredExec, extend_and_cancel_reorder) {
+    deferred_token a = defer(0, 10);
+    deferred_token b = defer(1, 20);
+    deferred_token c = defer(2, 30);
+
+    EXPECT_TRUE(extend_deferred_exec(a, 40));
+    EXPECT_EQ(next_deadline_in(), 20);
+    EXPECT_TRUE(cancel_deferred_exec(b));
+    EXPECT_FALSE(cancel_deferred_exec(b));
+    EXPECT_EQ(next_deadline_in(), 30);
+
+    run_for(40);
+    EXPECT_EQ(record.fired, (std::vector<int>{2, 0}));
+    EXPECT_FALSE(extend_deferred_exec(c, 10));
+}
+
+TEST_F(DeferredExec, repeats_relative_to_previous_trigger) {
+    record.repeat_ms    = 7;
+    record.repeats_left = 2;
+    defer(0, 10);
+    defer(1, 15);
+
+    run_for(10);
+    EXPECT_EQ(record.fired, (std::vector<int>{0}));
+    EXPECT_EQ(next_deadline_in(), 5);
+
+    run_for(5);
+    EXPECT_EQ(record.fired, (std::vector<int>{0, 1}));
+    EXPECT_EQ(next_deadline_in(), 2);
+
+    run_for(9);
+    EXPECT_EQ(record.fired, (std::vector<int>{0, 1, 0, 1}));
+}
+
+TEST_F(DeferredExec, late_repeat_runs_once_per_pass) {
+    record.repeat_ms    = 1;
+    record.repeats_left = 10;
+    defer(0, 1);
+    defer(1, 3);
+
+    // Both repeat, and 0 is still due and earliest after its first call, but only runs again on the next pass
+    advance_time(5);
+    deferred_exec_task();
+    EXPECT_EQ(record.fired, (std::vector<int>{0, 1}));
+
+    advance_time(1);
+    deferred_exec_task();
+    EXPECT_EQ(record.fired, (std::vector<int>{0, 1, 0, 1}));
+}
+
+TEST_F(DeferredExec, callback_can_cancel_other_executors) {
+    defer(0, 10);
+    defer(1, 12);
+    record.cancel_token = defer(2, 11);
+    defer(3, 20);
+
+    run_for(10);
+    EXPECT_EQ(record.fired, (std::vector<int>{0}));
+    EXPECT_EQ(next_deadline_in(), 2);
+
+    run_for(10);
+    EXPECT_EQ(record.fired, (std::vector<int>{0, 1, 3}));
+}
+
+TEST_F(DeferredExec, table_full) {
+    for (int i = 0; i < MAX_DEFERRED_EXECUTORS; i++) {
+        EXPECT_NE(defer(i, 100 - i), INVALID_DEFERRED_TOKEN);
+    }
+    EXPECT_EQ(defer(MAX_DEFERRED_EXECUTORS, 1), INVALID_DEFERRED_TOKEN);
+    EXPECT_EQ(next_deadline_in(), 100 - (MAX_DEFERRED_EXECUTORS - 1));
+
+    run_for(100);
+    ASSERT_EQ(record.fired.size(), MAX_DEFERRED_EXECUTORS);
+    for (int i = 0; i < MAX_DEFERRED_EXECUTORS; i++) {
+        EXPECT_EQ(record.fired[i], MAX_DEFERRED_EXECUTORS - 1 - i);
+    }
+}
+
+TEST_F(DeferredExec, fires_on_time_after_random_operations) {
+    deferred_token tokens[MAX_DEFERRED_EXECUTORS] = {0};
+    uint32_t       due[MAX_DEFERRED_EXECUTORS]    = {0};
+    uint32_t       seed                           = 12345;
+
+    for (int step = 0; step < 500; step++) {
+        seed           = seed * 1103515245 + 12345;
+        int      id    = (seed >> 16) % MAX_DEFERRED_EXECUTORS;
+        uint32_t delay = 1 + (seed >> 8) % 50;
+
+        size_t fired = record.fired.size();
+        if (tokens[id] == INVALID_DEFERRED_TOKEN) {
+            tokens[id] = defer(id, delay);
+            due[id]    = timer_read32() + delay;
+        } else if (seed & 0x80000000) {
+            EXPECT_TRUE(cancel_deferred_exec(tokens[id]));
+            tokens[id] = INVALID_DEFERRED_TOKEN;
+        } else {
+            EXPECT_TRUE(extend_deferred_exec(tokens[id], delay));
+            due[id] = timer_read32() + delay;
+        }
+
+        run_for(1 + (seed >> 24) % 8);
+        for (size_t i = fired; i < record.fired.size(); i++) {
+            int f = record.fired[i];
+            EXPECT_EQ(record.fired_at[i], due[f]);
+            tokens[f] = INVALID_DEFERRED_TOKEN;
+        }
+        for (int i = 0; i < MAX_DEFERRED_EXECUTORS; i++) {
+            if (tokens[i] != INVALID_DEFERRED_TOKEN) {
+                EXPECT_GT((int32_t)TIMER_DIFF_32(due[i], timer_read32()), 0);
+            }
+        }
+    }
+}
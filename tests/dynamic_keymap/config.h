@@ -0,0 +1,13 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+// Only the first layer is cached, so both the cached and uncached paths are covered
+#define DYNAMIC_KEYMAP_LAYER_COUNT 2
+#define DYNAMIC_KEYMAP_CACHED_LAYER_COUNT 1
+#define DYNAMIC_KEYMAP_MACRO_COUNT 4
+
+#define TRANSIENT_EEPROM_SIZE 1024
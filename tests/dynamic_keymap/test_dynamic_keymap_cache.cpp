@@ -0,0 +1,87 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+
+#include "test_common.hpp"
+
+extern "C" {
+#include "dynamic_keymap.h"
+#include "keymap_introspection.h"
+#include "nvm_dynamic_keymap.h"
+}
+
+class DynamicKeymapCache : public TestFixture {
+   protected:
+    void SetUp() override {
+        dynamic_keymap_reset();
+    }
+
+    // Checks that every keycode read through the cache matches the one stored in NVM
+    static void expect_cache_matches_nvm() {
+        for (uint8_t layer = 0; layer < DYNAMIC_KEYMAP_LAYER_COUNT; layer++) {
+            for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+                for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                    EXPECT_EQ(dynamic_keymap_get_keycode(layer, row, col), nvm_dynamic_keymap_read_keycode(layer, row, col)) << "Cache did not match NVM at layer " << +layer << ", row " << +row << ", column " << +col;
+                }
+            }
+        }
+    }
+};
+
+TEST_F(DynamicKeymapCache, LoadedByInit) {
+    // Written behind the cache's back, a lookup loading the cache would see it
+    nvm_dynamic_keymap_update_keycode(0, 0, 0, KC_Z);
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 0, 0), keycode_at_keymap_location_raw(0, 0, 0)) << "Cache should have been loaded by keyboard_init()";
+
+    dynamic_keymap_init();
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 0, 0), KC_Z);
+    expect_cache_matches_nvm();
+}
+
+TEST_F(DynamicKeymapCache, SetKeycodeUpdatesCache) {
+    dynamic_keymap_set_keycode(0, 1, 2, KC_X);
+    dynamic_keymap_set_keycode(1, 3, 4, KC_Y);
+
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 1, 2), KC_X);
+    EXPECT_EQ(dynamic_keymap_get_keycode(1, 3, 4), KC_Y);
+    expect_cache_matches_nvm();
+}
+
+TEST_F(DynamicKeymapCache, SetBufferUpdatesCache) {
+    // Starts part way through a keycode and straddles the end of the cached layer
+    uint16_t             offset = MATRIX_ROWS * MATRIX_COLS * 2 - 3;
+    std::vector<uint8_t> data   = {0x12, 0x34, 0x56, 0x78, 0x9A};
+    dynamic_keymap_set_buffer(offset, data.size(), data.data());
+
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, MATRIX_ROWS - 1, MATRIX_COLS - 1), 0x3456);
+    EXPECT_EQ(dynamic_keymap_get_keycode(1, 0, 0), 0x789A);
+    expect_cache_matches_nvm();
+}
+
+TEST_F(DynamicKeymapCache, ResetRestoresCache) {
+    dynamic_keymap_set_keycode(0, 0, 0, KC_Z);
+    dynamic_keymap_reset();
+
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 0, 0), keycode_at_keymap_location_raw(0, 0, 0));
+    expect_cache_matches_nvm();
+}
+
+TEST_F(DynamicKeymapCache, OutOfRangePositionsIgnored) {
+    std::vector<uint8_t> before(DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2);
+    dynamic_keymap_get_buffer(0, before.size(), before.data());
+
+    // A column past the end would otherwise land on the next row of the cache
+    dynamic_keymap_set_keycode(0, 0, MATRIX_COLS, KC_Z);
+    dynamic_keymap_set_keycode(0, MATRIX_ROWS, 0, KC_Z);
+    dynamic_keymap_set_keycode(DYNAMIC_KEYMAP_LAYER_COUNT, 0, 0, KC_Z);
+
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 0, MATRIX_COLS), KC_NO);
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, MATRIX_ROWS, 0), KC_NO);
+    EXPECT_EQ(dynamic_keymap_get_keycode(DYNAMIC_KEYMAP_LAYER_COUNT, 0, 0), KC_NO);
+
+    std::vector<uint8_t> after(before.size());
+    dynamic_keymap_get_buffer(0, after.size(), after.data());
+    EXPECT_EQ(after, before) << "Out of range writes should not have changed the keymap";
+    expect_cache_matches_nvm();
+}
@@ -0,0 +1,7 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+# Same suite as key_override, without KEY_OVERRIDE_INDEX_SIZE.
+KEY_OVERRIDE_ENABLE = yes
+
+INTROSPECTION_KEYMAP_C = ../test_key_overrides.c
@@ -0,0 +1,140 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+using testing::_;
+using testing::AnyNumber;
+
+class KeyOverride : public TestFixture {};
+
+TEST_F(KeyOverride, no_mods_passes_trigger_through) {
+    TestDriver driver;
+    KeymapKey  key_bspc(0, 0, 0, KC_BSPC);
+    set_keymap({key_bspc});
+
+    EXPECT_REPORT(driver, (KC_BSPC));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_bspc);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverride, trigger_pressed_with_mods_down) {
+    TestDriver driver;
+    KeymapKey  key_bspc(0, 0, 0, KC_BSPC);
+    KeymapKey  key_lsft(0, 1, 0, KC_LSFT);
+    set_keymap({key_bspc, key_lsft});
+
+    EXPECT_REPORT(driver, (KC_LSFT));
+    key_lsft.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    // The trigger mods are suppressed while the override is active.
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_DEL))).Times(1);
+    tap_key(key_bspc);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+    EXPECT_EMPTY_REPORT(driver);
+    key_lsft.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverride, first_matching_override_wins) {
+    TestDriver driver;
+    KeymapKey  key_bspc(0, 0, 0, KC_BSPC);
+    KeymapKey  key_lalt(0, 1, 0, KC_LALT);
+    KeymapKey  key_lctl(0, 2, 0, KC_LCTL);
+    set_keymap({key_bspc, key_lalt, key_lctl});
+
+    // Alt only matches the last override in the list, which needs any one mod.
+    EXPECT_REPORT(driver, (KC_LALT));
+    key_lalt.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_TAB))).Times(1);
+    tap_key(key_bspc);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+    EXPECT_EMPTY_REPORT(driver);
+    key_lalt.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    // Ctrl matches both the ctrl and the catch-all override, the earlier one wins.
+    EXPECT_REPORT(driver, (KC_LCTL));
+    key_lctl.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_ESC))).Times(1);
+    tap_key(key_bspc);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+    EXPECT_EMPTY_REPORT(driver);
+    key_lctl.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverride, mod_pressed_after_trigger) {
+    TestDriver driver;
+    KeymapKey  key_a(0, 0, 0, KC_A);
+    KeymapKey  key_lgui(0, 1, 0, KC_LGUI);
+    set_keymap({key_a, key_lgui});
+
+    EXPECT_REPORT(driver, (KC_A));
+    key_a.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    // The replacement is registered after the key repeat delay of 500ms.
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_B))).Times(1);
+    key_lgui.press();
+    idle_for(500);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+    EXPECT_EMPTY_REPORT(driver);
+    key_a.release();
+    run_one_scan_loop();
+    key_lgui.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverride, mod_only_override) {
+    TestDriver driver;
+    KeymapKey  key_lctl(0, 0, 0, KC_LCTL);
+    KeymapKey  key_lalt(0, 1, 0, KC_LALT);
+    set_keymap({key_lctl, key_lalt});
+
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_F1))).Times(1);
+    key_lctl.press();
+    run_one_scan_loop();
+    key_lalt.press();
+    idle_for(500);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+    EXPECT_EMPTY_REPORT(driver);
+    key_lalt.release();
+    run_one_scan_loop();
+    key_lctl.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,21 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "quantum.h"
+
+// Two overrides on the same trigger, the first one in the list wins.
+const key_override_t bspc_shift_override = ko_make_basic(MOD_MASK_SHIFT, KC_BSPC, KC_DEL);
+const key_override_t bspc_ctrl_override  = ko_make_basic(MOD_MASK_CTRL, KC_BSPC, KC_ESC);
+const key_override_t bspc_any_override   = ko_make_with_layers_negmods_and_options(MOD_MASK_CSAG, KC_BSPC, KC_TAB, ~0, 0, ko_options_default | ko_option_one_mod);
+const key_override_t a_gui_override      = ko_make_basic(MOD_MASK_GUI, KC_A, KC_B);
+// Mod-only override.
+const key_override_t ctrl_alt_override   = ko_make_basic(MOD_MASK_CA, KC_NO, KC_F1);
+
+// clang-format off
+const key_override_t *key_overrides[] = {
+    &bspc_shift_override,
+    &a_gui_override,
+    &bspc_ctrl_override,
+    &ctrl_alt_override,
+    &bspc_any_override,
+};
+// clang-format on
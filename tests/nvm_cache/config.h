@@ -0,0 +1,10 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define NVM_CACHE_PAGE_SIZE 8
+#define NVM_CACHE_PAGE_COUNT 2
+#define NVM_CACHE_IDLE_TIMEOUT 500
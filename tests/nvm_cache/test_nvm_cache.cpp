@@ -0,0 +1,127 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test_common.hpp"
+
+extern "C" {
+#include "eeconfig.h"
+#include "eeprom.h"
+#include "nvm_cache.h"
+}
+
+// The test harness EEPROM only has 32 bytes
+#define TEST_ADDR 0
+
+class NvmCache : public TestFixture {
+   public:
+    void SetUp() override {
+        nvm_cache_flush();
+        nvm_cache_invalidate();
+    }
+
+    static uint8_t *addr(uintptr_t offset) {
+        return (uint8_t *)(TEST_ADDR + offset);
+    }
+};
+
+TEST_F(NvmCache, CoalescesWritesUntilIdle) {
+    TestDriver driver;
+
+    uint8_t before = eeprom_read_byte(addr(0));
+    for (uint8_t i = 1; i <= 100; i++) {
+        nvm_cache_update_byte(addr(0), before + i);
+        run_one_scan_loop();
+    }
+
+    // Nothing reaches the backing store while writes keep coming
+    EXPECT_TRUE(nvm_cache_is_dirty());
+    EXPECT_EQ(eeprom_read_byte(addr(0)), before);
+    EXPECT_EQ(nvm_cache_read_byte(addr(0)), (uint8_t)(before + 100));
+
+    idle_for(NVM_CACHE_IDLE_TIMEOUT);
+    EXPECT_FALSE(nvm_cache_is_dirty());
+    EXPECT_EQ(eeprom_read_byte(addr(0)), (uint8_t)(before + 100));
+}
+
+TEST_F(NvmCache, UnchangedDataIsNotDirty) {
+    TestDriver driver;
+
+    nvm_cache_update_byte(addr(0), eeprom_read_byte(addr(0)));
+    nvm_cache_update_dword((uint32_t *)addr(4), eeprom_read_dword((uint32_t *)addr(4)));
+    EXPECT_FALSE(nvm_cache_is_dirty());
+}
+
+TEST_F(NvmCache, BlockAcrossPages) {
+    TestDriver driver;
+
+    uint8_t data[20];
+    for (uint8_t i = 0; i < sizeof(data); i++) {
+        data[i] = 0xA0 ^ i;
+    }
+
+    // Spans three pages, with only two cache slots the first one is evicted straight away
+    nvm_cache_update_block(data, addr(3), sizeof(data));
+    EXPECT_EQ(eeprom_read_byte(addr(3)), data[0]);
+
+    uint8_t readback[sizeof(data)];
+    nvm_cache_read_block(readback, addr(3), sizeof(readback));
+    EXPECT_EQ(memcmp(readback, data, sizeof(data)), 0);
+
+    nvm_cache_flush();
+    EXPECT_FALSE(nvm_cache_is_dirty());
+    eeprom_read_block(readback, addr(3), sizeof(readback));
+    EXPECT_EQ(memcmp(readback, data, sizeof(data)), 0);
+}
+
+TEST_F(NvmCache, EvictsLeastRecentlyUsedPage) {
+    TestDriver driver;
+
+    uint8_t a = eeprom_read_byte(addr(0)) + 1;
+    uint8_t b = eeprom_read_byte(addr(NVM_CACHE_PAGE_SIZE)) + 1;
+    uint8_t c = eeprom_read_byte(addr(2 * NVM_CACHE_PAGE_SIZE)) + 1;
+
+    nvm_cache_update_byte(addr(0), a);
+    nvm_cache_update_byte(addr(NVM_CACHE_PAGE_SIZE), b);
+    nvm_cache_update_byte(addr(1), a); // First page is now the most recently used
+    nvm_cache_update_byte(addr(2 * NVM_CACHE_PAGE_SIZE), c);
+
+    EXPECT_NE(eeprom_read_byte(addr(0)), a);
+    EXPECT_EQ(eeprom_read_byte(addr(NVM_CACHE_PAGE_SIZE)), b);
+    EXPECT_NE(eeprom_read_byte(addr(2 * NVM_CACHE_PAGE_SIZE)), c);
+}
+
+TEST_F(NvmCache, EeconfigGoesThroughCache) {
+    TestDriver driver;
+
+    debug_config_t before, config, readback;
+    eeconfig_read_debug(&before);
+    config.raw = before.raw ^ 0x0F;
+
+    // Reads see the cached value, dropping the cache shows it was never committed
+    eeconfig_update_debug(&config);
+    eeconfig_read_debug(&readback);
+    EXPECT_EQ(readback.raw, config.raw);
+    nvm_cache_invalidate();
+    eeconfig_read_debug(&readback);
+    EXPECT_EQ(readback.raw, before.raw);
+
+    // Once idle, the value is committed
+    eeconfig_update_debug(&config);
+    idle_for(NVM_CACHE_IDLE_TIMEOUT + 1);
+    nvm_cache_invalidate();
+    eeconfig_read_debug(&readback);
+    EXPECT_EQ(readback.raw, config.raw);
+}
+
+TEST_F(NvmCache, FlushedOnSuspend) {
+    TestDriver driver;
+
+    uint8_t value = eeprom_read_byte(addr(0)) + 1;
+    nvm_cache_update_byte(addr(0), value);
+    EXPECT_NE(eeprom_read_byte(addr(0)), value);
+
+    suspend_power_down_quantum();
+    EXPECT_FALSE(nvm_cache_is_dirty());
+    EXPECT_EQ(eeprom_read_byte(addr(0)), value);
+    suspend_wakeup_init_quantum();
+}
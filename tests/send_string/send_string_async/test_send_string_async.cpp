@@ -0,0 +1,153 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+class SendStringAsync : public TestFixture {
+   protected:
+    void run_until_idle(void) {
+        for (int i = 0; i < 1000 && is_send_string_async_active(); i++) {
+            run_one_scan_loop();
+        }
+        EXPECT_FALSE(is_send_string_async_active());
+    }
+
+    void expect_typed_aB_newline(TestDriver &driver) {
+        EXPECT_REPORT(driver, (KC_A));
+        EXPECT_EMPTY_REPORT(driver);
+        EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+        EXPECT_REPORT(driver, (KC_LEFT_SHIFT, KC_B));
+        EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+        EXPECT_EMPTY_REPORT(driver);
+        EXPECT_REPORT(driver, (KC_ENTER));
+        EXPECT_EMPTY_REPORT(driver);
+    }
+};
+
+TEST_F(SendStringAsync, matches_blocking_send_string) {
+    TestDriver driver;
+    InSequence s;
+
+    expect_typed_aB_newline(driver);
+    send_string("aB\n");
+    VERIFY_AND_CLEAR(driver);
+
+    expect_typed_aB_newline(driver);
+    EXPECT_TRUE(send_string_async("aB\n"));
+    run_until_idle();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringAsync, one_key_event_per_task) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_NO_REPORT(driver);
+    EXPECT_TRUE(send_string_async("ab"));
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_A));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    run_until_idle();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringAsync, interval_and_delay_are_waited_for) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_TRUE(send_string_async_with_delay("a" SS_DELAY(50) "b", 10));
+
+    EXPECT_REPORT(driver, (KC_A));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    // key up after the interval
+    EXPECT_NO_REPORT(driver);
+    idle_for(9);
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(2);
+    VERIFY_AND_CLEAR(driver);
+
+    // interval after the key up, then the delay plus another interval
+    EXPECT_NO_REPORT(driver);
+    idle_for(68);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    run_until_idle();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringAsync, keys_pressed_while_typing) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  key_c(0, 0, 0, KC_C);
+    set_keymap({key_c});
+
+    EXPECT_TRUE(send_string_async_with_delay(SS_DOWN(X_A) SS_UP(X_A), 10));
+
+    EXPECT_REPORT(driver, (KC_A));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    // the matrix keeps being scanned while the string is typed
+    EXPECT_REPORT(driver, (KC_A, KC_C));
+    key_c.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_C));
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(10);
+    key_c.release();
+    run_one_scan_loop();
+    run_until_idle();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringAsync, string_too_long_is_not_queued) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    EXPECT_FALSE(send_string_async("this string does not fit in the buffer"));
+    EXPECT_FALSE(is_send_string_async_active());
+    VERIFY_AND_CLEAR(driver);
+
+    // strings are queued back to back
+    EXPECT_TRUE(send_string_async("0123456789"));
+    EXPECT_TRUE(send_string_async("0123456789"));
+    EXPECT_FALSE(send_string_async("0123456789"));
+
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(40);
+    run_until_idle();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringAsync, flush) {
+    TestDriver driver;
+    InSequence s;
+
+    expect_typed_aB_newline(driver);
+    EXPECT_TRUE(send_string_async("aB\n"));
+    send_string_async_flush();
+    EXPECT_FALSE(is_send_string_async_active());
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,115 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+class SendStringBulk : public TestFixture {};
+
+TEST_F(SendStringBulk, ascending_keys_share_a_report) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_REPORT(driver, (KC_A, KC_B, KC_C));
+    EXPECT_EMPTY_REPORT(driver);
+    send_string_bulk("abc");
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringBulk, descending_or_repeated_keys_start_a_new_report) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_REPORT(driver, (KC_C));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_A, KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    send_string_bulk("cabb");
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringBulk, modifiers_stay_held_across_batches) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT, KC_A, KC_B));
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT, KC_A));
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_A, KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    send_string_bulk("ABAab");
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringBulk, batch_limited_to_free_report_slots) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_REPORT(driver, (KC_A, KC_B, KC_C, KC_D, KC_E, KC_F));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_G, KC_H));
+    EXPECT_EMPTY_REPORT(driver);
+    send_string_bulk("abcdefgh");
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_Z));
+    register_code(KC_Z);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_Z, KC_A, KC_B, KC_C, KC_D, KC_E));
+    EXPECT_REPORT(driver, (KC_Z));
+    EXPECT_REPORT(driver, (KC_Z, KC_F, KC_G));
+    EXPECT_REPORT(driver, (KC_Z));
+    send_string_bulk("abcdefg");
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    unregister_code(KC_Z);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringBulk, sequences_are_sent_unbatched) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_REPORT(driver, (KC_A, KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_LEFT_CTRL));
+    EXPECT_REPORT(driver, (KC_LEFT_CTRL, KC_C));
+    EXPECT_REPORT(driver, (KC_LEFT_CTRL));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_C, KC_D));
+    EXPECT_EMPTY_REPORT(driver);
+    send_string_bulk("ab" SS_LCTL("c") "cd");
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringBulk, single_keys_match_send_string) {
+    TestDriver driver;
+    InSequence s;
+
+    for (int i = 0; i < 2; i++) {
+        EXPECT_REPORT(driver, (KC_B));
+        EXPECT_EMPTY_REPORT(driver);
+        EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+        EXPECT_REPORT(driver, (KC_LEFT_SHIFT, KC_A));
+        EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+        EXPECT_EMPTY_REPORT(driver);
+        EXPECT_REPORT(driver, (KC_A));
+        EXPECT_EMPTY_REPORT(driver);
+    }
+    send_string("bAa");
+    send_string_bulk("bAa");
+    VERIFY_AND_CLEAR(driver);
+}
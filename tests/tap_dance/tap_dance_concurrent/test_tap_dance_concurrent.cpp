@@ -0,0 +1,128 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "action_tapping.h"
+#include "test_keymap_key.hpp"
+#include "../examples.h"
+
+using testing::_;
+using testing::InSequence;
+
+class TapDanceConcurrent : public TestFixture {};
+
+TEST_F(TapDanceConcurrent, RollFinishesInOrder) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_esc_caps = KeymapKey{0, 1, 0, TD(TD_ESC_CAPS)};
+    auto       key_quad     = KeymapKey{0, 2, 0, TD(X_CTL)};
+
+    set_keymap({key_esc_caps, key_quad});
+
+    /* Rolling onto the second dance does not finish the first one */
+    key_esc_caps.press();
+    run_one_scan_loop();
+    key_quad.press();
+    run_one_scan_loop();
+    key_esc_caps.release();
+    run_one_scan_loop();
+    key_quad.release();
+    EXPECT_NO_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    /* Both dances time out on their own timers, in the order they started */
+    EXPECT_REPORT(driver, (KC_ESC));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_X));
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(TAPPING_TERM);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(TapDanceConcurrent, HoldAcrossOtherDance) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_esc_caps = KeymapKey{0, 1, 0, TD(TD_ESC_CAPS)};
+    auto       key_quad     = KeymapKey{0, 2, 0, TD(X_CTL)};
+
+    set_keymap({key_esc_caps, key_quad});
+
+    /* Hold the quad dance while tapping the other one */
+    key_quad.press();
+    run_one_scan_loop();
+    tap_key(key_esc_caps);
+    EXPECT_NO_REPORT(driver);
+    VERIFY_AND_CLEAR(driver);
+
+    /* The held dance resolves to a hold, the tapped one to a single tap */
+    EXPECT_REPORT(driver, (KC_LCTL));
+    EXPECT_REPORT(driver, (KC_LCTL, KC_ESC));
+    EXPECT_REPORT(driver, (KC_LCTL));
+    idle_for(TAPPING_TERM);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_quad.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(TapDanceConcurrent, RegularKeyInterruptsAll) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_esc_caps = KeymapKey{0, 1, 0, TD(TD_ESC_CAPS)};
+    auto       key_quad     = KeymapKey{0, 2, 0, TD(X_CTL)};
+    auto       regular_key  = KeymapKey(0, 3, 0, KC_A);
+
+    set_keymap({key_esc_caps, key_quad, regular_key});
+
+    tap_key(key_esc_caps);
+    tap_key(key_quad);
+    EXPECT_NO_REPORT(driver);
+    VERIFY_AND_CLEAR(driver);
+
+    /* Every active dance is finished, oldest first, before the key is handled */
+    EXPECT_REPORT(driver, (KC_ESC));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_X));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_A));
+    regular_key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    regular_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(TapDanceConcurrent, ThirdDanceInterruptsOldest) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_esc_caps = KeymapKey{0, 1, 0, TD(TD_ESC_CAPS)};
+    auto       key_quad     = KeymapKey{0, 2, 0, TD(X_CTL)};
+    auto       key_egg      = KeymapKey{0, 3, 0, TD(CT_EGG)};
+
+    set_keymap({key_esc_caps, key_quad, key_egg});
+
+    tap_key(key_esc_caps);
+    tap_key(key_quad);
+    EXPECT_NO_REPORT(driver);
+    VERIFY_AND_CLEAR(driver);
+
+    /* With both slots taken, the oldest dance is finished to make room */
+    EXPECT_REPORT(driver, (KC_ESC));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_egg);
+    VERIFY_AND_CLEAR(driver);
+
+    /* The remaining dance still times out */
+    EXPECT_REPORT(driver, (KC_X));
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(TAPPING_TERM);
+    VERIFY_AND_CLEAR(driver);
+}
@@ -37,6 +37,9 @@ class TestDriver {
     MOCK_METHOD1(send_nkro_mock, void(report_nkro_t&));
     MOCK_METHOD1(send_mouse_mock, void(report_mouse_t&));
     MOCK_METHOD1(send_extra_mock, void(report_extra_t&));
+#ifdef RAW_ENABLE
+    MOCK_METHOD2(send_raw_hid_mock, void(uint8_t*, uint8_t));
+#endif
 
    private:
     static uint8_t     keyboard_leds(void);
@@ -44,6 +47,9 @@ class TestDriver {
     static void        send_nkro(report_nkro_t* report);
     static void        send_mouse(report_mouse_t* report);
     static void        send_extra(report_extra_t* report);
+#ifdef RAW_ENABLE
+    static void send_raw_hid(uint8_t* data, uint8_t length);
+#endif
     host_driver_t      m_driver;
     uint8_t            m_leds = 0;
     static TestDriver* m_this;
@@ -0,0 +1,10 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Stands in for the version.h generated for keyboard builds, which tests don't generate.
+
+#pragma once
+
+#define QMK_VERSION "test"
+#define QMK_BUILDDATE "2026-01-01-00:00:00"
+#define QMK_GIT_HASH "test"
@@ -0,0 +1,7 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+VIA_ENABLE = yes
+
+# The test harness EEPROM is too small for the dynamic keymap
+EEPROM_DRIVER = transient
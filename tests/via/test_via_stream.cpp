@@ -0,0 +1,222 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+
+#include "test_common.hpp"
+#include "test_fixture.hpp"
+
+extern "C" {
+#include "via.h"
+#include "raw_hid.h"
+#include "dynamic_keymap.h"
+#include "usb_device_state.h"
+}
+
+using testing::_;
+using testing::Invoke;
+
+namespace {
+
+using report_t = std::vector<uint8_t>;
+
+// Size in bytes of the dynamic keymap buffer
+constexpr uint16_t keymap_buffer_size = DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2;
+
+uint16_t crc16_ccitt_false(const report_t &data) {
+    uint16_t crc = 0xFFFF;
+    for (uint8_t byte : data) {
+        crc ^= (uint16_t)byte << 8;
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+        }
+    }
+    return crc;
+}
+
+report_t keymap_buffer(uint16_t offset, uint16_t size) {
+    report_t data(size);
+    dynamic_keymap_get_buffer(offset, size, data.data());
+    return data;
+}
+
+void receive(report_t report) {
+    report.resize(RAW_EPSIZE);
+    raw_hid_receive(report.data(), report.size());
+}
+
+void request(uint8_t command_id, uint8_t value_id, uint8_t buffer_id, uint16_t offset, uint16_t size) {
+    receive({command_id, id_qmk_stream_channel, value_id, buffer_id, (uint8_t)(offset >> 8), (uint8_t)(offset & 0xFF), (uint8_t)(size >> 8), (uint8_t)(size & 0xFF)});
+}
+
+void request_get(uint8_t buffer_id, uint16_t offset, uint16_t size) {
+    request(id_custom_get_value, id_qmk_stream_get, buffer_id, offset, size);
+}
+
+void request_set(uint8_t buffer_id, uint16_t offset, uint16_t size) {
+    request(id_custom_set_value, id_qmk_stream_set, buffer_id, offset, size);
+}
+
+report_t data_report(uint8_t sequence, report_t::const_iterator begin, report_t::const_iterator end) {
+    report_t report = {id_custom_set_value, id_qmk_stream_channel, id_qmk_stream_data, sequence};
+    report.insert(report.end(), begin, end);
+    return report;
+}
+
+bool is_stream_report(const report_t &report, uint8_t command_id, uint8_t value_id) {
+    return report[0] == command_id && report[1] == id_qmk_stream_channel && report[2] == value_id;
+}
+
+} // namespace
+
+class ViaStream : public TestFixture {
+   protected:
+    // Records each raw HID report sent by the keyboard
+    void capture_reports(TestDriver &driver) {
+        EXPECT_CALL(driver, send_raw_hid_mock(_, _)).WillRepeatedly(Invoke([this](uint8_t *data, uint8_t length) {
+            EXPECT_EQ(length, RAW_EPSIZE);
+            sent.emplace_back(data, data + length);
+        }));
+    }
+
+    void SetUp() override {
+        usb_device_state_set_configuration(true, 1);
+        dynamic_keymap_reset();
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                dynamic_keymap_set_keycode(0, row, col, KC_A + row * MATRIX_COLS + col);
+            }
+        }
+    }
+
+    std::vector<report_t> sent;
+};
+
+TEST_F(ViaStream, GetSendsRangeAndCrc) {
+    TestDriver driver;
+    capture_reports(driver);
+
+    request_get(id_stream_dynamic_keymap, 10, keymap_buffer_size - 10);
+    ASSERT_EQ(sent.size(), 1);
+    EXPECT_TRUE(is_stream_report(sent[0], id_custom_get_value, id_qmk_stream_get)) << "Request was not acknowledged";
+
+    // Reports are only sent from the main loop
+    report_t received;
+    for (int i = 0; i < 10 && !is_stream_report(sent.back(), id_custom_get_value, id_qmk_stream_end); i++) {
+        via_task();
+    }
+    ASSERT_TRUE(is_stream_report(sent.back(), id_custom_get_value, id_qmk_stream_end)) << "Stream did not end";
+
+    uint8_t sequence = 0;
+    for (size_t i = 1; i + 1 < sent.size(); i++) {
+        EXPECT_TRUE(is_stream_report(sent[i], id_custom_get_value, id_qmk_stream_data));
+        EXPECT_EQ(sent[i][3], sequence++) << "Reports were not numbered in sequence";
+        size_t n = std::min<size_t>(VIA_STREAM_DATA_SIZE, keymap_buffer_size - 10 - received.size());
+        received.insert(received.end(), sent[i].begin() + 4, sent[i].begin() + 4 + n);
+    }
+    EXPECT_EQ(sequence, (keymap_buffer_size - 10 + VIA_STREAM_DATA_SIZE - 1) / VIA_STREAM_DATA_SIZE) << "Range was not split into full reports";
+    EXPECT_EQ(received, keymap_buffer(10, keymap_buffer_size - 10));
+
+    report_t &end = sent.back();
+    EXPECT_EQ(end[3], id_stream_ok);
+    EXPECT_EQ((end[4] << 8) | end[5], crc16_ccitt_false(received)) << "CRC did not cover the range";
+
+    size_t count = sent.size();
+    via_task();
+    EXPECT_EQ(sent.size(), count) << "Reports were sent after the stream ended";
+}
+
+TEST_F(ViaStream, SetWritesRangeAndCrc) {
+    TestDriver driver;
+    capture_reports(driver);
+
+    report_t data(40);
+    for (size_t i = 0; i < data.size(); i++) {
+        data[i] = i & 1 ? KC_B : 0x00;
+    }
+
+    request_set(id_stream_dynamic_keymap, 4, data.size());
+    receive(data_report(0, data.begin(), data.begin() + VIA_STREAM_DATA_SIZE));
+    EXPECT_EQ(sent.size(), 1) << "Only the request should have been acknowledged part way through";
+
+    receive(data_report(1, data.begin() + VIA_STREAM_DATA_SIZE, data.end()));
+
+    ASSERT_EQ(sent.size(), 2);
+    EXPECT_TRUE(is_stream_report(sent[1], id_custom_set_value, id_qmk_stream_end));
+    EXPECT_EQ(sent[1][3], id_stream_ok);
+    EXPECT_EQ((sent[1][4] << 8) | sent[1][5], crc16_ccitt_false(data));
+    EXPECT_EQ(keymap_buffer(4, data.size()), data) << "Range was not written";
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 0, 2), KC_B) << "Keycode did not match the written buffer";
+}
+
+TEST_F(ViaStream, SetOutOfSequenceEndsStream) {
+    TestDriver driver;
+    capture_reports(driver);
+
+    report_t before = keymap_buffer(0, keymap_buffer_size);
+    report_t data   = {0x12, 0x34};
+    request_set(id_stream_dynamic_keymap, 0, 40);
+    receive(data_report(1, data.begin(), data.end()));
+
+    ASSERT_EQ(sent.size(), 2);
+    EXPECT_TRUE(is_stream_report(sent[1], id_custom_set_value, id_qmk_stream_end));
+    EXPECT_EQ(sent[1][3], id_stream_out_of_sequence);
+    EXPECT_EQ(keymap_buffer(0, keymap_buffer_size), before) << "Out of sequence report should not have been written";
+
+    // The stream is over, so further data reports aren't part of it
+    receive(data_report(0, data.begin(), data.end()));
+    EXPECT_EQ(sent.back()[0], id_unhandled);
+    EXPECT_EQ(keymap_buffer(0, keymap_buffer_size), before);
+}
+
+TEST_F(ViaStream, GetEndsStreamWhenSuspended) {
+    TestDriver driver;
+    capture_reports(driver);
+
+    request_get(id_stream_dynamic_keymap, 0, keymap_buffer_size);
+    via_task();
+    usb_device_state_set_suspend(true, 1);
+    via_task();
+
+    ASSERT_EQ(sent.size(), 3);
+    EXPECT_TRUE(is_stream_report(sent[1], id_custom_get_value, id_qmk_stream_data));
+    EXPECT_TRUE(is_stream_report(sent[2], id_custom_get_value, id_qmk_stream_end));
+    EXPECT_EQ(sent[2][3], id_stream_send_failed);
+
+    usb_device_state_set_resume(true, 1);
+    via_task();
+    EXPECT_EQ(sent.size(), 3) << "Reports were sent after the stream failed";
+}
+
+TEST_F(ViaStream, InvalidRequestUnhandled) {
+    TestDriver driver;
+    capture_reports(driver);
+
+    request_get(id_stream_dynamic_keymap, 2, keymap_buffer_size);
+    request_get(id_stream_dynamic_keymap, 0, 0);
+    request_set(0x7F, 0, 1);
+    // Reads are requested with a get value, and writes with a set value
+    request(id_custom_set_value, id_qmk_stream_get, id_stream_dynamic_keymap, 0, 1);
+    request(id_custom_get_value, id_qmk_stream_data, id_stream_dynamic_keymap, 0, 1);
+
+    ASSERT_EQ(sent.size(), 5);
+    for (auto &report : sent) {
+        EXPECT_EQ(report[0], id_unhandled);
+    }
+    via_task();
+    EXPECT_EQ(sent.size(), 5) << "Rejected request should not have started a stream";
+}
+
+TEST_F(ViaStream, OtherCommandCancelsStream) {
+    TestDriver driver;
+    capture_reports(driver);
+
+    request_get(id_stream_dynamic_keymap_macro, 0, 8);
+    receive({id_get_protocol_version});
+    ASSERT_EQ(sent.size(), 2);
+    EXPECT_EQ(sent[1][0], id_get_protocol_version);
+    EXPECT_EQ((sent[1][1] << 8) | sent[1][2], VIA_PROTOCOL_VERSION);
+
+    via_task();
+    EXPECT_EQ(sent.size(), 2) << "Cancelled stream should not have sent anything";
+}
@@ -74,6 +74,13 @@ static void obnotify(io_buffers_queue_t *bqp) {
     }
 }
 
+static void usb_endpoint_in_reset_pending(usb_endpoint_in_t *endpoint) {
+    if (endpoint->pending != NULL) {
+        endpoint->pending->size      = 0;
+        endpoint->pending->in_flight = false;
+    }
+}
+
 /*===========================================================================*/
 /* Driver exported functions.                                                */
 /*===========================================================================*/
@@ -124,6 +131,7 @@ void usb_endpoint_in_stop(usb_endpoint_in_t *endpoint) {
 
     bqSuspendI(&endpoint->obqueue);
     obqResetI(&endpoint->obqueue);
+    usb_endpoint_in_reset_pending(endpoint);
     if (endpoint->report_storage != NULL) {
         endpoint->report_storage->reset_report(endpoint->report_storage->reports);
     }
@@ -146,6 +154,7 @@ void usb_endpoint_out_stop(usb_endpoint_out_t *endpoint) {
 void usb_endpoint_in_suspend_cb(usb_endpoint_in_t *endpoint) {
     bqSuspendI(&endpoint->obqueue);
     obqResetI(&endpoint->obqueue);
+    usb_endpoint_in_reset_pending(endpoint);
 
     if (endpoint->report_storage != NULL) {
         endpoint->report_storage->reset_report(endpoint->report_storage->reports);
@@ -168,6 +177,7 @@ void usb_endpoint_out_wakeup_cb(usb_endpoint_out_t *endpoint) {
 void usb_endpoint_in_configure_cb(usb_endpoint_in_t *endpoint) {
     usbInitEndpointI(endpoint->config.usbp, endpoint->config.ep, &endpoint->ep_config);
     obqResetI(&endpoint->obqueue);
+    usb_endpoint_in_reset_pending(endpoint);
     bqResumeX(&endpoint->obqueue);
 }
 
@@ -197,8 +207,17 @@ void usb_endpoint_in_tx_complete_cb(USBDriver *usbp, usbep_t ep) {
     /* Sending succeded, so we can reset the timed out state. */
     endpoint->timed_out = false;
 
-    /* Freeing the buffer just transmitted, if it was not a zero size packet.*/
-    if (!obqIsEmptyI(&endpoint->obqueue) && usbp->epc[ep]->in_state->txsize > 0U) {
+    usb_endpoint_in_pending_t *pending = endpoint->pending;
+
+    if (pending != NULL && pending->in_flight) {
+        /* The coalesced report was sent straight from its own buffer, nothing
+         * to release in the queue. */
+        pending->in_flight = false;
+        if (endpoint->report_storage != NULL) {
+            endpoint->report_storage->set_report(endpoint->report_storage->reports, pending->buffer[pending->index ^ 1U], usbp->epc[ep]->in_state->txsize);
+        }
+    } else if (!obqIsEmptyI(&endpoint->obqueue) && usbp->epc[ep]->in_state->txsize > 0U) {
+        /* Freeing the buffer just transmitted, if it was not a zero size packet.*/
         /* Store the last send report in the endpoint to be retrieved by a
          * GET_REPORT request or IDLE report handling. */
         if (endpoint->report_storage != NULL) {
@@ -215,6 +234,19 @@ void usb_endpoint_in_tx_complete_cb(USBDriver *usbp, usbep_t ep) {
         /* The endpoint cannot be busy, we are in the context of the callback,
            so it is safe to transmit without a check.*/
         usbStartTransmitI(usbp, ep, buffer, n);
+    } else if (pending != NULL && pending->size > 0U) {
+        /* The queue is drained, send the latest coalesced report. Reports only
+         * become pending while the queue is full, and any later report that is
+         * queued on this endpoint, such as keyboard or extra reports on a shared
+         * endpoint, takes the pending one into the queue ahead of itself, so
+         * this keeps them in order. Further reports coalesce into the other
+         * buffer meanwhile. */
+        n                  = pending->size;
+        buffer             = pending->buffer[pending->index];
+        pending->index    ^= 1U;
+        pending->size      = 0;
+        pending->in_flight = true;
+        usbStartTransmitI(usbp, ep, buffer, n);
     } else if ((usbp->epc[ep]->ep_mode == USB_EP_MODE_TYPE_BULK) && (usbp->epc[ep]->in_state->txsize > 0U) && ((usbp->epc[ep]->in_state->txsize & ((size_t)usbp->epc[ep]->in_maxsize - 1U)) == 0U)) {
         /* Transmit zero sized packet in case the last one has maximum allowed
          * size. Otherwise the recipient may expect more data coming soon and
@@ -267,8 +299,23 @@ bool usb_endpoint_in_send(usb_endpoint_in_t *endpoint, const uint8_t *data, size
     if (endpoint->timed_out && timeout != TIME_INFINITE) {
         timeout = TIME_IMMEDIATE;
     }
+
+    /* A coalesced report still waiting for the queue to drain was sent before
+     * this one, so it has to be queued first. This matters on shared
+     * endpoints, where other reports follow the mouse through the same queue.
+     * Once taken, the transfer complete callback won't touch its buffer. */
+    usb_endpoint_in_pending_t *pending      = endpoint->pending;
+    size_t                     pending_size = 0;
+    if (pending != NULL) {
+        pending_size  = pending->size;
+        pending->size = 0;
+    }
     osalSysUnlock();
 
+    if (pending_size > 0U && !usb_endpoint_in_send(endpoint, pending->buffer[pending->index], pending_size, timeout, false)) {
+        return false;
+    }
+
     while (true) {
         size_t sent = obqWriteTimeout(&endpoint->obqueue, data, size, timeout);
 
@@ -291,6 +338,49 @@ bool usb_endpoint_in_send(usb_endpoint_in_t *endpoint, const uint8_t *data, size
     }
 }
 
+/**
+ * @brief Send a report without blocking on a full endpoint queue. If the queue
+ * is full, the report is kept as the endpoint's single pending report instead,
+ * and later reports are merged into it with the endpoint's merge callback. The
+ * pending report is submitted from the transfer complete callback once the
+ * queue has drained.
+ */
+bool usb_endpoint_in_send_coalesced(usb_endpoint_in_t *endpoint, const uint8_t *data, size_t size, sysinterval_t timeout) {
+    usb_endpoint_in_pending_t *pending = endpoint->pending;
+    osalDbgCheck((pending != NULL) && (data != NULL) && (size > 0U) && (size <= endpoint->config.buffer_size));
+
+    osalSysLock();
+    if (usbGetDriverStateI(endpoint->config.usbp) != USB_ACTIVE) {
+        osalSysUnlock();
+        return false;
+    }
+
+    if (pending->size > 0U) {
+        if (pending->size == size && pending->merge_cb != NULL && pending->merge_cb(pending->buffer[pending->index], data, size)) {
+            osalSysUnlock();
+            return true;
+        }
+
+        /* The reports can't be merged, usb_endpoint_in_send() queues the
+         * pending one ahead of this one. */
+        osalSysUnlock();
+        return usb_endpoint_in_send(endpoint, data, size, timeout, false);
+    }
+
+    /* Only the transfer complete callback frees up space in the queue, so if
+     * there is room now the send below won't block. */
+    if (!obqIsFullI(&endpoint->obqueue)) {
+        osalSysUnlock();
+        return usb_endpoint_in_send(endpoint, data, size, timeout, false);
+    }
+
+    memcpy(pending->buffer[pending->index], data, size);
+    pending->size = size;
+    osalSysUnlock();
+
+    return true;
+}
+
 void usb_endpoint_in_flush(usb_endpoint_in_t *endpoint, bool padded) {
     osalDbgCheck(endpoint != NULL);
 
@@ -314,7 +404,7 @@ bool usb_endpoint_in_is_inactive(usb_endpoint_in_t *endpoint) {
     osalDbgCheck(endpoint != NULL);
 
     osalSysLock();
-    bool inactive = obqIsEmptyI(&endpoint->obqueue) && !usbGetTransmitStatusI(endpoint->config.usbp, endpoint->config.ep);
+    bool inactive = obqIsEmptyI(&endpoint->obqueue) && !usbGetTransmitStatusI(endpoint->config.usbp, endpoint->config.ep) && (endpoint->pending == NULL || endpoint->pending->size == 0U);
     osalSysUnlock();
 
     return inactive;
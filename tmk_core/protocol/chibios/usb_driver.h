@@ -154,6 +154,40 @@ typedef struct {
     uint8_t *buffer;
 } usb_endpoint_config_t;
 
+/**
+ * @brief Merges a newer report into a pending, not yet transmitted, report.
+ *
+ * @return true if the report was merged, false if both reports have to be sent.
+ */
+typedef bool (*usb_endpoint_in_merge_cb_t)(uint8_t *pending, const uint8_t *report, size_t size);
+
+typedef struct {
+    /**
+     * @brief Double buffer for the latest report, one may be in flight while the other is coalescing
+     */
+    uint8_t *buffer[2];
+
+    /**
+     * @brief Size of the pending report in `buffer[index]`, 0 if there is none
+     */
+    size_t size;
+
+    /**
+     * @brief Index of the buffer holding the pending report
+     */
+    uint8_t index;
+
+    /**
+     * @brief The other buffer is currently being transmitted
+     */
+    bool in_flight;
+
+    /**
+     * @brief Callback used to fold a newer report into the pending one
+     */
+    usb_endpoint_in_merge_cb_t merge_cb;
+} usb_endpoint_in_pending_t;
+
 typedef struct {
     output_buffers_queue_t obqueue;
     USBEndpointConfig      ep_config;
@@ -164,8 +198,9 @@ typedef struct {
 #endif
     usb_endpoint_config_t config;
     usbreqhandler_t       usb_requests_cb;
-    bool                  timed_out;
-    usb_report_storage_t *report_storage;
+    bool                       timed_out;
+    usb_report_storage_t *     report_storage;
+    usb_endpoint_in_pending_t *pending;
 } usb_endpoint_in_t;
 
 typedef struct {
@@ -185,6 +220,7 @@ void usb_endpoint_in_start(usb_endpoint_in_t *endpoint);
 void usb_endpoint_in_stop(usb_endpoint_in_t *endpoint);
 
 bool usb_endpoint_in_send(usb_endpoint_in_t *endpoint, const uint8_t *data, size_t size, sysinterval_t timeout, bool buffered);
+bool usb_endpoint_in_send_coalesced(usb_endpoint_in_t *endpoint, const uint8_t *data, size_t size, sysinterval_t timeout);
 void usb_endpoint_in_flush(usb_endpoint_in_t *endpoint, bool padded);
 bool usb_endpoint_in_is_inactive(usb_endpoint_in_t *endpoint);
 
@@ -62,6 +62,47 @@ static bool __attribute__((__unused__)) send_report_buffered(usb_endpoint_in_lut
 static void __attribute__((__unused__)) flush_report_buffered(usb_endpoint_in_lut_t endpoint, bool padded);
 static bool __attribute__((__unused__)) receive_report(usb_endpoint_out_lut_t endpoint, void *report, size_t size);
 
+#ifdef MOUSE_ENABLE
+static bool mouse_report_merge(uint8_t *pending, const uint8_t *report, size_t size);
+#endif
+
+/* Pending report storage for the endpoints that don't block when full. Mouse
+ * reports are merged by summing their movement, keyboard, NKRO and extra
+ * reports are state reports, so they are never merged: one of them can wait
+ * for the endpoint without blocking, a second one blocks until the first has
+ * been queued, so that no key state is lost. */
+#if !defined(KEYBOARD_SHARED_EP)
+static _Alignas(4) uint8_t       keyboard_pending_buffers[2][KEYBOARD_EPSIZE];
+static usb_endpoint_in_pending_t keyboard_pending = {
+    .buffer = {keyboard_pending_buffers[0], keyboard_pending_buffers[1]},
+};
+#endif
+
+#if defined(MOUSE_ENABLE) && !defined(MOUSE_SHARED_EP)
+static _Alignas(4) uint8_t       mouse_pending_buffers[2][sizeof(report_mouse_t)];
+static usb_endpoint_in_pending_t mouse_pending = {
+    .buffer   = {mouse_pending_buffers[0], mouse_pending_buffers[1]},
+    .merge_cb = mouse_report_merge,
+};
+#endif
+
+#if defined(SHARED_EP_ENABLE)
+static _Alignas(4) uint8_t       shared_pending_buffers[2][SHARED_EPSIZE];
+static usb_endpoint_in_pending_t shared_pending = {
+    .buffer = {shared_pending_buffers[0], shared_pending_buffers[1]},
+#    if defined(MOUSE_ENABLE) && defined(MOUSE_SHARED_EP)
+    .merge_cb = mouse_report_merge,
+#    endif
+};
+#endif
+
+#if defined(USB_HIGH_SPEED) && defined(DSTS_ENUMSPD_MASK)
+/* STM32 OTG peripherals report the speed negotiated during the bus reset */
+bool usb_device_is_high_speed(void) {
+    return (USB_DRIVER.otg->DSTS & DSTS_ENUMSPD_MASK) == DSTS_ENUMSPD_HS_480;
+}
+#endif
+
 /* ---------------------------------------------------------
  *            Descriptors and USB driver objects
  * ---------------------------------------------------------
@@ -336,6 +377,18 @@ static const USBConfig usbcfg = {
 };
 
 void init_usb_driver(USBDriver *usbp) {
+    /* Keyboard, mouse, NKRO and extra reports wait in the pending storage
+     * instead of blocking on a full endpoint */
+#if !defined(KEYBOARD_SHARED_EP)
+    usb_endpoints_in[USB_ENDPOINT_IN_KEYBOARD].pending = &keyboard_pending;
+#endif
+#if defined(MOUSE_ENABLE) && !defined(MOUSE_SHARED_EP)
+    usb_endpoints_in[USB_ENDPOINT_IN_MOUSE].pending = &mouse_pending;
+#endif
+#if defined(SHARED_EP_ENABLE)
+    usb_endpoints_in[USB_ENDPOINT_IN_SHARED].pending = &shared_pending;
+#endif
+
     for (int i = 0; i < USB_ENDPOINT_IN_COUNT; i++) {
         usb_endpoint_in_init(&usb_endpoints_in[i]);
         usb_endpoint_in_start(&usb_endpoints_in[i]);
@@ -405,6 +458,22 @@ bool send_report(usb_endpoint_in_lut_t endpoint, void *report, size_t size) {
     return usb_endpoint_in_send(&usb_endpoints_in[endpoint], (uint8_t *)report, size, TIME_MS2I(100), false);
 }
 
+/**
+ * @brief Send a report to the host without blocking on a full endpoint. If the
+ * endpoint is busy the report is kept pending and reports sent in the meantime
+ * are merged into it, it is then submitted as soon as the endpoint drains. A
+ * report that can't be merged blocks until the pending one has been queued.
+ *
+ * @param endpoint USB IN endpoint to send the report from, must have pending storage
+ * @param report pointer to the report
+ * @param size size of the report
+ * @return true Success
+ * @return false Failure
+ */
+static bool send_report_coalesced(usb_endpoint_in_lut_t endpoint, void *report, size_t size) {
+    return usb_endpoint_in_send_coalesced(&usb_endpoints_in[endpoint], (uint8_t *)report, size, TIME_MS2I(100));
+}
+
 /**
  * @brief Send a report to the host, but delay the sending until the size of
  * endpoint report is reached or the incompletely filled buffer is flushed with
@@ -449,15 +518,15 @@ static bool receive_report(usb_endpoint_out_lut_t endpoint, void *report, size_t
 void send_keyboard(report_keyboard_t *report) {
     /* If we're in Boot Protocol, don't send any report ID or other funky fields */
     if (usb_device_state_get_protocol() == USB_PROTOCOL_BOOT) {
-        send_report(USB_ENDPOINT_IN_KEYBOARD, &report->mods, 8);
+        send_report_coalesced(USB_ENDPOINT_IN_KEYBOARD, &report->mods, 8);
     } else {
-        send_report(USB_ENDPOINT_IN_KEYBOARD, report, KEYBOARD_REPORT_SIZE);
+        send_report_coalesced(USB_ENDPOINT_IN_KEYBOARD, report, KEYBOARD_REPORT_SIZE);
     }
 }
 
 void send_nkro(report_nkro_t *report) {
 #ifdef NKRO_ENABLE
-    send_report(USB_ENDPOINT_IN_SHARED, report, sizeof(report_nkro_t));
+    send_report_coalesced(USB_ENDPOINT_IN_SHARED, report, sizeof(report_nkro_t));
 #endif
 }
 
@@ -466,9 +535,53 @@ void send_nkro(report_nkro_t *report) {
  * ---------------------------------------------------------
  */
 
+#ifdef MOUSE_ENABLE
+static inline int32_t mouse_clamp(int32_t value, int32_t min, int32_t max) {
+    return value < min ? min : (value > max ? max : value);
+}
+
+/**
+ * @brief Folds a newer mouse report into a pending one by summing the
+ * movement. Reports with different buttons are kept apart, so clicks stay in
+ * order with the movement around them, as are reports that would saturate.
+ */
+static bool mouse_report_merge(uint8_t *pending, const uint8_t *report, size_t size) {
+    report_mouse_t *      a = (report_mouse_t *)pending;
+    const report_mouse_t *b = (const report_mouse_t *)report;
+
+    if (size != sizeof(report_mouse_t) || a->buttons != b->buttons) {
+        return false;
+    }
+#    ifdef MOUSE_SHARED_EP
+    /* Other reports of the same size can be pending on a shared endpoint */
+    if (a->report_id != REPORT_ID_MOUSE || b->report_id != REPORT_ID_MOUSE) {
+        return false;
+    }
+#    endif
+
+    int32_t x = (int32_t)a->x + b->x;
+    int32_t y = (int32_t)a->y + b->y;
+    int32_t v = (int32_t)a->v + b->v;
+    int32_t h = (int32_t)a->h + b->h;
+    if (x != mouse_clamp(x, MOUSE_REPORT_XY_MIN, MOUSE_REPORT_XY_MAX) || y != mouse_clamp(y, MOUSE_REPORT_XY_MIN, MOUSE_REPORT_XY_MAX) || v != mouse_clamp(v, MOUSE_REPORT_HV_MIN, MOUSE_REPORT_HV_MAX) || h != mouse_clamp(h, MOUSE_REPORT_HV_MIN, MOUSE_REPORT_HV_MAX)) {
+        return false;
+    }
+
+    a->x = x;
+    a->y = y;
+    a->v = v;
+    a->h = h;
+#    ifdef MOUSE_EXTENDED_REPORT
+    a->boot_x = mouse_clamp(x, -127, 127);
+    a->boot_y = mouse_clamp(y, -127, 127);
+#    endif
+    return true;
+}
+#endif
+
 void send_mouse(report_mouse_t *report) {
 #ifdef MOUSE_ENABLE
-    send_report(USB_ENDPOINT_IN_MOUSE, report, sizeof(report_mouse_t));
+    send_report_coalesced(USB_ENDPOINT_IN_MOUSE, report, sizeof(report_mouse_t));
 #endif
 }
 
@@ -479,7 +592,7 @@ void send_mouse(report_mouse_t *report) {
 
 void send_extra(report_extra_t *report) {
 #ifdef EXTRAKEY_ENABLE
-    send_report(USB_ENDPOINT_IN_SHARED, report, sizeof(report_extra_t));
+    send_report_coalesced(USB_ENDPOINT_IN_SHARED, report, sizeof(report_extra_t));
 #endif
 }
 
@@ -36,6 +36,7 @@
     this software.
 */
 
+#include <string.h>
 #include "util.h"
 #include "report.h"
 #include "usb_descriptor.h"
@@ -532,6 +533,57 @@ const USB_Descriptor_Device_t PROGMEM DeviceDescriptor = {
 #    define USB_POLLING_INTERVAL_MS 1
 #endif
 
+/* Only the declared polling intervals change with USB_HIGH_SPEED, reports are
+ * still produced at most once per matrix scan */
+#ifdef USB_HIGH_SPEED
+#    if !defined(PROTOCOL_CHIBIOS)
+#        error "USB_HIGH_SPEED requires a ChibiOS target with a high-speed capable USB peripheral"
+#    endif
+#    if defined(MIDI_ENABLE) || defined(VIRTSER_ENABLE)
+#        error "USB_HIGH_SPEED is not compatible with the bulk endpoints used by MIDI_ENABLE and VIRTSER_ENABLE"
+#    endif
+#    ifndef USB_POLLING_INTERVAL_US
+#        define USB_POLLING_INTERVAL_US 125
+#    endif
+/* High-speed interrupt endpoints are polled every 2^(bInterval-1) microframes of 125us */
+#    if USB_POLLING_INTERVAL_US <= 125
+#        define USB_HID_POLLING_INTERVAL 1
+#    elif USB_POLLING_INTERVAL_US <= 250
+#        define USB_HID_POLLING_INTERVAL 2
+#    elif USB_POLLING_INTERVAL_US <= 500
+#        define USB_HID_POLLING_INTERVAL 3
+#    elif USB_POLLING_INTERVAL_US <= 1000
+#        define USB_HID_POLLING_INTERVAL 4
+#    elif USB_POLLING_INTERVAL_US <= 2000
+#        define USB_HID_POLLING_INTERVAL 5
+#    elif USB_POLLING_INTERVAL_US <= 4000
+#        define USB_HID_POLLING_INTERVAL 6
+#    else
+#        define USB_HID_POLLING_INTERVAL 7
+#    endif
+#else
+#    define USB_HID_POLLING_INTERVAL USB_POLLING_INTERVAL_MS
+#endif
+
+#ifdef USB_HIGH_SPEED
+/*
+ * Device qualifier descriptor, required for high-speed capable devices
+ */
+const USB_Descriptor_DeviceQualifier_t PROGMEM DeviceQualifierDescriptor = {
+    .Header = {
+        .Size                   = sizeof(USB_Descriptor_DeviceQualifier_t),
+        .Type                   = DTYPE_DeviceQualifier
+    },
+    .USBSpecification           = VERSION_BCD(2, 0, 0),
+    .Class                      = USB_CSCP_NoDeviceClass,
+    .SubClass                   = USB_CSCP_NoDeviceSubclass,
+    .Protocol                   = USB_CSCP_NoDeviceProtocol,
+    .Endpoint0Size              = FIXED_CONTROL_ENDPOINT_SIZE,
+    .NumberOfConfigurations     = FIXED_NUM_CONFIGURATIONS,
+    .Reserved                   = 0x00
+};
+#endif
+
 /*
  * Configuration descriptors
  */
@@ -584,7 +636,7 @@ const USB_Descriptor_Configuration_t PROGMEM ConfigurationDescriptor = {
         .EndpointAddress        = (ENDPOINT_DIR_IN | KEYBOARD_IN_EPNUM),
         .Attributes             = (EP_TYPE_INTERRUPT | ENDPOINT_ATTR_NO_SYNC | ENDPOINT_USAGE_DATA),
         .EndpointSize           = KEYBOARD_EPSIZE,
-        .PollingIntervalMS      = USB_POLLING_INTERVAL_MS
+        .PollingIntervalMS      = USB_HID_POLLING_INTERVAL
     },
 #endif
 
@@ -674,7 +726,7 @@ const USB_Descriptor_Configuration_t PROGMEM ConfigurationDescriptor = {
         .EndpointAddress        = (ENDPOINT_DIR_IN | MOUSE_IN_EPNUM),
         .Attributes             = (EP_TYPE_INTERRUPT | ENDPOINT_ATTR_NO_SYNC | ENDPOINT_USAGE_DATA),
         .EndpointSize           = MOUSE_EPSIZE,
-        .PollingIntervalMS      = USB_POLLING_INTERVAL_MS
+        .PollingIntervalMS      = USB_HID_POLLING_INTERVAL
     },
 #endif
 
@@ -719,7 +771,7 @@ const USB_Descriptor_Configuration_t PROGMEM ConfigurationDescriptor = {
         .EndpointAddress        = (ENDPOINT_DIR_IN | SHARED_IN_EPNUM),
         .Attributes             = (EP_TYPE_INTERRUPT | ENDPOINT_ATTR_NO_SYNC | ENDPOINT_USAGE_DATA),
         .EndpointSize           = SHARED_EPSIZE,
-        .PollingIntervalMS      = USB_POLLING_INTERVAL_MS
+        .PollingIntervalMS      = USB_HID_POLLING_INTERVAL
     },
 #endif
 
@@ -1054,7 +1106,7 @@ const USB_Descriptor_Configuration_t PROGMEM ConfigurationDescriptor = {
         .EndpointAddress        = (ENDPOINT_DIR_IN | JOYSTICK_IN_EPNUM),
         .Attributes             = (EP_TYPE_INTERRUPT | ENDPOINT_ATTR_NO_SYNC | ENDPOINT_USAGE_DATA),
         .EndpointSize           = JOYSTICK_EPSIZE,
-        .PollingIntervalMS      = USB_POLLING_INTERVAL_MS
+        .PollingIntervalMS      = USB_HID_POLLING_INTERVAL
     },
 #endif
 
@@ -1094,7 +1146,7 @@ const USB_Descriptor_Configuration_t PROGMEM ConfigurationDescriptor = {
         .EndpointAddress        = (ENDPOINT_DIR_IN | DIGITIZER_IN_EPNUM),
         .Attributes             = (EP_TYPE_INTERRUPT | ENDPOINT_ATTR_NO_SYNC | ENDPOINT_USAGE_DATA),
         .EndpointSize           = DIGITIZER_EPSIZE,
-        .PollingIntervalMS      = USB_POLLING_INTERVAL_MS
+        .PollingIntervalMS      = USB_HID_POLLING_INTERVAL
     },
 #endif
 };
@@ -1195,6 +1247,46 @@ void set_serial_number_descriptor(void) {
  * is called so that the descriptor details can be passed back and the appropriate descriptor sent back to the
  * USB host.
  */
+#ifdef USB_HIGH_SPEED
+/*
+ * The configuration descriptor above holds high-speed bInterval values. When
+ * the device runs at full speed, or the host asks for the other speed
+ * configuration, a copy is served with full-speed values instead.
+ */
+static USB_Descriptor_Configuration_t SpeedConfigurationDescriptor;
+
+__attribute__((weak)) bool usb_device_is_high_speed(void) {
+    return true;
+}
+
+/* Converts a high-speed interrupt bInterval, 2^(bInterval-1) microframes, into milliseconds, rounding up */
+static uint8_t usb_full_speed_polling_interval(uint8_t interval) {
+    return interval <= 4 ? 1 : 1 << (MIN(interval, 11) - 4);
+}
+
+static const void* get_speed_configuration_descriptor(bool other_speed) {
+    bool full_speed = usb_device_is_high_speed() == other_speed;
+    if (!full_speed && !other_speed) {
+        return &ConfigurationDescriptor;
+    }
+
+    memcpy(&SpeedConfigurationDescriptor, &ConfigurationDescriptor, sizeof(USB_Descriptor_Configuration_t));
+    uint8_t* descriptor = (uint8_t*)&SpeedConfigurationDescriptor;
+    if (other_speed) {
+        descriptor[1] = DTYPE_Other;
+    }
+    if (full_speed) {
+        for (uint16_t i = 0; i + 1 < sizeof(USB_Descriptor_Configuration_t) && descriptor[i] > 0; i += descriptor[i]) {
+            USB_Descriptor_Endpoint_t* endpoint = (USB_Descriptor_Endpoint_t*)&descriptor[i];
+            if (endpoint->Header.Type == DTYPE_Endpoint && (endpoint->Attributes & EP_TYPE_MASK) == EP_TYPE_INTERRUPT) {
+                endpoint->PollingIntervalMS = usb_full_speed_polling_interval(endpoint->PollingIntervalMS);
+            }
+        }
+    }
+    return &SpeedConfigurationDescriptor;
+}
+#endif
+
 uint16_t get_usb_descriptor(const uint16_t wValue, const uint16_t wIndex, const uint16_t wLength, const void** const DescriptorAddress) {
     const uint8_t DescriptorType  = (wValue >> 8);
     const uint8_t DescriptorIndex = (wValue & 0xFF);
@@ -1208,10 +1300,26 @@ uint16_t get_usb_descriptor(const uint16_t wValue, const uint16_t wIndex, const
 
             break;
         case DTYPE_Configuration:
+#ifdef USB_HIGH_SPEED
+            Address = get_speed_configuration_descriptor(false);
+#else
             Address = &ConfigurationDescriptor;
+#endif
+            Size = sizeof(USB_Descriptor_Configuration_t);
+
+            break;
+#ifdef USB_HIGH_SPEED
+        case DTYPE_Other:
+            Address = get_speed_configuration_descriptor(true);
             Size    = sizeof(USB_Descriptor_Configuration_t);
 
             break;
+        case DTYPE_DeviceQualifier:
+            Address = &DeviceQualifierDescriptor;
+            Size    = sizeof(USB_Descriptor_DeviceQualifier_t);
+
+            break;
+#endif
         case DTYPE_String:
             switch (DescriptorIndex) {
                 case 0x00:
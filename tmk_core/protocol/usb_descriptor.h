@@ -295,3 +295,12 @@ enum usb_endpoints {
 #define DIGITIZER_EPSIZE 8
 
 uint16_t get_usb_descriptor(const uint16_t wValue, const uint16_t wIndex, const uint16_t wLength, const void** const DescriptorAddress);
+
+#ifdef USB_HIGH_SPEED
+/**
+ * \brief Whether the device enumerated at high speed, which selects the bInterval values served to the host.
+ *
+ * Defaults to true, platforms which can detect a fall back to full speed override this.
+ */
+bool usb_device_is_high_speed(void);
+#endif